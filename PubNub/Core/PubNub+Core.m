@@ -97,6 +97,7 @@ NS_ASSUME_NONNULL_BEGIN
 @property(strong, nonatomic) id<PNTransport> subscriptionNetwork;
 @property(assign, nonatomic) PNStatusCategory recentClientStatus;
 @property(strong, nonatomic) PNPublishSequence *sequenceManager;
+@property(strong, nullable, nonatomic) PNPublishQueue *publishQueue;
 @property(strong, nonatomic) PNClientState *clientStateManager;
 @property(strong, nonatomic) PNStateListener *listenersManager;
 @property(strong, nonatomic) PNSubscriber *subscriberManager;
@@ -151,9 +152,20 @@ NS_ASSUME_NONNULL_BEGIN
 
 /// Create transport instance with limited concurrent connections.
 ///
-/// - Parameter maximumConnections: Maximum number of concurrent connections (requests).
+/// - Parameters:
+///   - maximumConnections: Maximum number of concurrent connections (requests).
+///   - shared: Whether transport should share connection pool with other clients or not.
 /// - Returns: Configured and ready to use requests transport instance.
-- (id<PNTransport>)transportWithMaximumConnections:(NSUInteger)maximumConnections;
+- (id<PNTransport>)transportWithMaximumConnections:(NSUInteger)maximumConnections shared:(BOOL)shared;
+
+/// Retrieve transport which is shared between clients with same origin and connection settings.
+///
+/// > Note: Transport is configured by the first client which started to use it (with its retry configuration and
+/// logger). Configuration of other clients is ignored while transport is in use.
+///
+/// - Parameter maximumConnections: Maximum number of concurrent connections (requests).
+/// - Returns: Transport instance from shared pools registry.
+- (PNURLSessionTransport *)sharedTransportWithMaximumConnections:(NSUInteger)maximumConnections;
 
 
 #if TARGET_OS_OSX || TARGET_OS_IOS && !defined(TARGET_IS_EXTENSION)
@@ -245,6 +257,14 @@ NS_ASSUME_NONNULL_END
         _listenersManager = [PNStateListener stateListenerForClient:self];
         _heartbeatManager = [PNHeartbeat heartbeatForClient:self];
 
+        NSUInteger maximumInFlightPublishRequests = _configuration.maximumInFlightPublishRequests;
+        if (maximumInFlightPublishRequests > 0) {
+            NSUInteger maximumInFlightPerChannel = _configuration.maximumInFlightPublishRequestsPerChannel;
+            _publishQueue = [PNPublishQueue queueWithMaximumInFlightRequests:maximumInFlightPublishRequests
+                                                                  perChannel:maximumInFlightPerChannel
+                                                               maximumLength:_configuration.maximumPublishQueueLength];
+        }
+
         [self addListener:self];
 
 #if TARGET_OS_OSX || TARGET_OS_IOS && !defined(TARGET_IS_EXTENSION)
@@ -365,12 +385,18 @@ NS_ASSUME_NONNULL_END
 #pragma mark - PubNub Network managers
 
 - (void)prepareNetworkManagers {
-    _subscriptionNetwork = [self transportWithMaximumConnections:1];
-    _serviceNetwork = [self transportWithMaximumConnections:3];
+    NSUInteger maximumServiceConnections = MAX(_configuration.maximumServiceConnections, 1);
+
+    _subscriptionNetwork = [self transportWithMaximumConnections:1 shared:NO];
+    _serviceNetwork = [self transportWithMaximumConnections:maximumServiceConnections
+                                                     shared:_configuration.shouldShareConnectionPool];
 }
 
-- (id<PNTransport>)transportWithMaximumConnections:(NSUInteger)maximumConnections {
-    PNURLSessionTransport *transport = [PNURLSessionTransport new];
+- (id<PNTransport>)transportWithMaximumConnections:(NSUInteger)maximumConnections shared:(BOOL)shared {
+    PNURLSessionTransport *transport = nil;
+    if (shared) transport = [self sharedTransportWithMaximumConnections:maximumConnections];
+    else transport = [PNURLSessionTransport new];
+
     PNTransportMiddlewareConfiguration *configuration;
     configuration = [PNTransportMiddlewareConfiguration configurationWithClientConfiguration:_configuration
                                                                             clientInstanceId:self.instanceID
@@ -381,6 +407,33 @@ NS_ASSUME_NONNULL_END
     return [PNTransportMiddleware middlewareWithConfiguration:configuration];
 }
 
+- (PNURLSessionTransport *)sharedTransportWithMaximumConnections:(NSUInteger)maximumConnections {
+    static NSMapTable<NSString *, PNURLSessionTransport *> *_sharedTransports;
+    static dispatch_once_t onceToken;
+    PNURLSessionTransport *transport = nil;
+
+    dispatch_once(&onceToken, ^{
+        _sharedTransports = [NSMapTable strongToWeakObjectsMapTable];
+    });
+
+    NSString *identifier = PNStringFormat(@"%@://%@/%@/%@",
+                                          _configuration.isTLSEnabled ? @"https" : @"http",
+                                          _configuration.origin,
+                                          @(maximumConnections),
+                                          _configuration.shouldMultiplexRequests ? @"multiplexed" : @"pooled");
+
+    @synchronized (_sharedTransports) {
+        transport = [_sharedTransports objectForKey:identifier];
+
+        if (!transport) {
+            transport = [PNURLSessionTransport new];
+            [_sharedTransports setObject:transport forKey:identifier];
+        }
+    }
+
+    return transport;
+}
+
 
 #pragma mark - Requests helper
 
@@ -402,7 +455,13 @@ NS_ASSUME_NONNULL_END
         };
     } else {
         handler = ^(PNTransportRequest *request, id<PNTransportResponse> response, NSURL *location, PNError *error) {
-            NSData *data = location ? [NSData dataWithContentsOfURL:location] : response.body;
+            NSData *data = response.body;
+
+            // Successfully downloaded file content isn't used by error-only parser and may be too large to load.
+            if (location && (!parser.errorOnly || response.statusCode >= 400)) {
+                data = [NSData dataWithContentsOfURL:location options:NSDataReadingMappedIfSafe error:nil];
+            }
+
             PNOperationDataParseResult *result = [parser parseOperation:userRequest.operation
                                                             withRequest:request
                                                                response:response
@@ -595,6 +654,7 @@ NS_ASSUME_NONNULL_END
     
     self.logger = [PNLoggerManager managerWithClientIdentifier:[_instanceID substringToIndex:6]
                                                       logLevel:_configuration.logLevel
+                                                    bufferSize:_configuration.logEntriesBufferSize
                                                     andLoggers:loggers];
 }
 
@@ -616,6 +676,7 @@ NS_ASSUME_NONNULL_END
     [_serviceNetwork invalidate];
     _serviceNetwork = nil;
     _filesManager = nil;
+    [_logger flush];
 }
 
 #pragma mark -
@@ -11,6 +11,7 @@
 #import "PNBaseRequest+Private.h"
 #import "PNPrivateStructures.h"
 #import "PNPublishSequence.h"
+#import "PNPublishQueue.h"
 #import "PNStateListener.h"
 #import "PNLoggerManager.h"
 #import "PNFilesManager.h"
@@ -55,6 +56,11 @@ typedef void(^PNParsedRequestCompletionBlock)(PNTransportRequest *,
 /// Publish sequence manager.
 @property (nonatomic, readonly, strong) PNPublishSequence *sequenceManager;
 
+/// Client-side publish requests queue.
+///
+/// Queue created only if client configured with non-zero `maximumInFlightPublishRequests`.
+@property (nonatomic, nullable, readonly, strong) PNPublishQueue *publishQueue;
+
 /// Client's state manager to store user's state for chats and group.
 @property (nonatomic, readonly, strong) PNClientState *clientStateManager;
 
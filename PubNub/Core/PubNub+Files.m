@@ -13,6 +13,7 @@
 #import "PNStringLogEntry+Private.h"
 #import "PNFileSendData+Private.h"
 #import "PNBaseRequest+Private.h"
+#import "PNSendFileStatus+Private.h"
 #import "PNFileUploadRequest.h"
 #import "PNErrorData+Private.h"
 #import "PubNub+CorePrivate.h"
@@ -95,10 +96,12 @@ NS_ASSUME_NONNULL_BEGIN
 ///   - fileName: Actual file name which has been used to store uploaded data (can be different from what has been
 ///   configured with ``sendFileRequest``).
 ///   - sendFileRequest: Original `send file` request used to trigger `file upload`.
+///   - uploadRequest: Request which has been used to upload file data.
 ///   - block: `Send file` request processing completion block.
 - (void)handleUploadFileSuccessWithFileIdentifier:(NSString *)fileIdentifier
                                          fileName:(NSString *)fileName
                                   sendFileRequest:(PNSendFileRequest *)sendFileRequest
+                                    uploadRequest:(PNFileUploadRequest *)uploadRequest
                                        completion:(PNSendFileCompletionBlock)block;
 
 /// Handle `file upload` failure.
@@ -108,10 +111,12 @@ NS_ASSUME_NONNULL_BEGIN
 ///   - fileName: Actual file name which has been used to store uploaded data (can be different from what has been 
 ///   configured with ``sendFileRequest``).
 ///   - category: File upload request processing error category.
+///   - uploadRequest: Request which has been used to upload file data.
 ///   - block: `Send file` request processing completion block.
 - (void)handleUploadFileErrorWithFileIdentifier:(NSString *)fileIdentifier
                                            name:(NSString *)fileName
                                        category:(PNStatusCategory)category
+                                  uploadRequest:(PNFileUploadRequest *)uploadRequest
                                      completion:(PNSendFileCompletionBlock)block;
 
 #pragma mark -
@@ -374,6 +379,9 @@ NS_ASSUME_NONNULL_END
         PNStrongify(self);
         BOOL temporary = userRequest.targetURL == nil;
 
+        // Keep received part of the file, so the next download attempt won't start from the beginning.
+        [self.filesManager storeResumeData:request.resumeData forFileWithIdentifier:userRequest.identifier];
+
         [self.filesManager handleDownloadedFileAtURL:url 
                                         withStoreURL:userRequest.targetURL
                                         cryptoModule:userRequest.cryptoModule
@@ -412,6 +420,10 @@ NS_ASSUME_NONNULL_END
                                             operation:PNFilesLogMessageOperation];
     }];
 
+    if (userRequest.identifier.length) {
+        userRequest.resumeData = [self.filesManager resumeDataForFileWithIdentifier:userRequest.identifier];
+    }
+
     [self performRequest:userRequest withParser:responseParser completion:handler];
 }
 
@@ -476,11 +488,13 @@ NS_ASSUME_NONNULL_END
             [self handleUploadFileErrorWithFileIdentifier:generateStatus.data.fileIdentifier
                                                      name:generateStatus.data.filename
                                                  category:result.status.category
+                                            uploadRequest:userRequest
                                                completion:block];
         } else {
             [self handleUploadFileSuccessWithFileIdentifier:generateStatus.data.fileIdentifier
                                                    fileName:generateStatus.data.filename
                                             sendFileRequest:sendFileRequest
+                                              uploadRequest:userRequest
                                                  completion:block];
         }
     };
@@ -504,6 +518,7 @@ NS_ASSUME_NONNULL_END
 - (void)handleUploadFileSuccessWithFileIdentifier:(NSString *)fileIdentifier
                                          fileName:(NSString *)fileName
                                   sendFileRequest:(PNSendFileRequest *)sendFileRequest
+                                    uploadRequest:(PNFileUploadRequest *)uploadRequest
                                        completion:(PNSendFileCompletionBlock)handlerBlock {
     NSUInteger fileMessagePublishRetryLimit = self.configuration.fileMessagePublishRetryLimit;
     PNSendFileCompletionBlock block = [handlerBlock copy];
@@ -550,6 +565,7 @@ NS_ASSUME_NONNULL_END
                                                               response:data];
             }
             
+            [sendFileStatus updateUploadMetricsFromRequest:uploadRequest];
             sendFileStatus.data.fileUploaded = YES;
             sendFileStatus.error = status.isError;
             
@@ -572,10 +588,12 @@ NS_ASSUME_NONNULL_END
 - (void)handleUploadFileErrorWithFileIdentifier:(NSString *)fileIdentifier
                                            name:(NSString *)fileName
                                        category:(PNStatusCategory)category
+                                  uploadRequest:(PNFileUploadRequest *)uploadRequest
                                      completion:(PNSendFileCompletionBlock)block {
     PNFileSendData *data = [PNFileSendData fileDataWithId:fileIdentifier name:fileName];
     category = category != PNUnknownCategory ? category : PNSendFileErrorCategory;
     PNSendFileStatus *status = [PNSendFileStatus objectWithOperation:PNSendFileOperation category:category response:data];
+    [status updateUploadMetricsFromRequest:uploadRequest];
     status.error = YES;
 
     [self callBlock:block status:YES withResult:nil andStatus:status];
@@ -4,10 +4,12 @@
 #import <PubNub/PNHistoryMessagesCountRequest.h>
 #import <PubNub/PNHistoryMessagesDeleteRequest.h>
 #import <PubNub/PNHistoryFetchRequest.h>
+#import <PubNub/PNHistoryBackfillRequest.h>
 
 // Response
 #import <PubNub/PNMessageCountResult.h>
 #import <PubNub/PNHistoryResult.h>
+#import <PubNub/PNHistoryBackfillProgress.h>
 
 // Deprecated
 #import <PubNub/PNDeleteMessageAPICallBuilder.h>
@@ -672,6 +674,44 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)fetchMessagesCountWithRequest:(PNHistoryMessagesCountRequest *)request
                            completion:(PNMessageCountCompletionBlock)block;
 
+
+#pragma mark - History backfill
+
+/// Backfill `channels` history for timetoken range.
+///
+/// Range split into ``PNHistoryBackfillRequest/windowsCount`` timetoken windows and history of each channel in each
+/// window fetched concurrently (limited by ``PNHistoryBackfillRequest/maximumConcurrentRequests``). Messages from all
+/// channels merged in timetoken order and passed to the `batchBlock` window by window, from the oldest to the newest.
+///
+/// #### Example:
+/// ```objc
+/// PNHistoryBackfillRequest *request = [PNHistoryBackfillRequest requestWithChannels:@[@"chat", @"news"]
+///                                                                              start:@(16000000000000000)
+///                                                                                end:@(16000864000000000)];
+/// request.progressToken = self.savedProgressToken;
+///
+/// [self.client backfillHistoryWithRequest:request
+///                                 batches:^(NSArray<NSDictionary *> *messages,
+///                                           PNHistoryBackfillProgress *progress,
+///                                           BOOL *stop) {
+///     // Store `messages` (each has `channel` key) and `progress.token` to resume backfill later.
+/// } completion:^(PNHistoryBackfillProgress *progress, PNErrorStatus *status) {
+///     if (!status) {
+///         // All windows has been processed. Throughput available here: `progress.messagesPerSecond`.
+///     } else {
+///         // Handle backfill error. `progress.token` can be used to resume from the first unprocessed window.
+///     }
+/// }];
+/// ```
+///
+/// - Parameters:
+///   - request: Request with information about backfill range and channels.
+///   - batchBlock: Window messages batch handler block.
+///   - block: Backfill completion handler block.
+- (void)backfillHistoryWithRequest:(PNHistoryBackfillRequest *)request
+                           batches:(PNHistoryBackfillBatchBlock)batchBlock
+                        completion:(nullable PNHistoryBackfillCompletionBlock)block;
+
 #pragma mark -
 
 
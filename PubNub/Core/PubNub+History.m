@@ -1,4 +1,5 @@
 #import "PubNub+History.h"
+#import "PNHistoryBackfillRequest+Private.h"
 #import "PNHistoryFetchRequest+Private.h"
 #import "PNDictionaryLogEntry+Private.h"
 #import "PNBaseOperationData+Private.h"
@@ -7,6 +8,7 @@
 #import "PNErrorStatus+Private.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
+#import "PNHistoryBackfill.h"
 #import "PNFunctions.h"
 
 // Deprecated
@@ -541,6 +543,57 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - History backfill
+
+- (void)backfillHistoryWithRequest:(PNHistoryBackfillRequest *)request
+                           batches:(PNHistoryBackfillBatchBlock)batchBlock
+                        completion:(PNHistoryBackfillCompletionBlock)block {
+    NSUInteger maximumConcurrentRequests = request.maximumConcurrentRequests;
+    if (maximumConcurrentRequests == 0) maximumConcurrentRequests = self.configuration.maximumServiceConnections;
+    BOOL includeMetadata = request.includeMetadata;
+
+    [self.logger debugWithLocation:@"PubNub" andMessageFactory:^PNLogEntry * {
+        return [PNDictionaryLogEntry entryWithMessage:[request dictionaryRepresentation]
+                                              details:@"Backfill history with parameters:"
+                                            operation:PNMessageStorageLogMessageOperation];
+    }];
+
+    PNWeakify(self);
+    PNHistoryBackfillFetchBlock fetchBlock = ^(NSString *channel,
+                                               NSNumber *lowerBound,
+                                               NSNumber *upperBound,
+                                               PNHistoryBackfillPageBlock pageBlock) {
+        PNStrongify(self);
+        if (!self) {
+            pageBlock(nil, nil, nil);
+            return;
+        }
+
+        PNHistoryFetchRequest *fetchRequest = [PNHistoryFetchRequest requestWithChannel:channel];
+        fetchRequest.includeMetadata = includeMetadata;
+        fetchRequest.includeTimeToken = YES;
+        fetchRequest.start = upperBound;
+        fetchRequest.end = lowerBound;
+        fetchRequest.limit = 100;
+
+        [self fetchHistoryWithRequest:fetchRequest completion:^(PNHistoryResult *result, PNErrorStatus *status) {
+            NSArray<NSDictionary *> *messages = result.data.messages;
+            // Full page means that there may be more messages between window start and oldest received message.
+            NSNumber *next = messages.count == fetchRequest.limit ? result.data.start : nil;
+
+            pageBlock(messages, next, status.isError ? status : nil);
+        }];
+    };
+
+    [[PNHistoryBackfill backfillWithRequest:request
+                  maximumConcurrentRequests:maximumConcurrentRequests
+                                 fetchBlock:fetchBlock
+                              callbackQueue:self.callbackQueue
+                                 batchBlock:batchBlock
+                            completionBlock:block] start];
+}
+
+
 #pragma mark - Handlers
 
 - (void)handleHistoryResult:(PNHistoryResult *)result
@@ -575,6 +575,83 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)channelMembersWithRequest:(PNFetchChannelMembersRequest *)request
                        completion:(PNFetchChannelMembersCompletionBlock)block;
 
+
+#pragma mark - Objects streaming
+
+/// `Stream all UUID metadata`.
+///
+/// Fetch all pages starting from the one specified by `request` and pass `UUID metadata` objects in page-sized
+/// batches to the `batchBlock`. Next page request is sent while the current batch is processed, and at most one
+/// prefetched page is held in memory.
+///
+/// #### Example:
+/// ```objc
+/// PNFetchAllUUIDMetadataRequest *request = [PNFetchAllUUIDMetadataRequest new];
+/// request.includeFields = PNUUIDCustomField;
+/// request.limit = 100;
+///
+/// [self.client streamAllUUIDMetadataWithRequest:request batches:^(NSArray<PNUUIDMetadata *> *metadata, BOOL *stop) {
+///     // Process batch of UUID metadata. Set `*stop = YES` to stop streaming.
+/// } completion:^(NSUInteger count, PNErrorStatus *status) {
+///     if (!status) {
+///         // All UUID metadata successfully streamed.
+///     } else {
+///         // Handle UUID metadata fetch error. Check `category` property to find out possible issue because of which
+///         // request did fail.
+///     }
+/// }];
+/// ```
+///
+/// - Parameters:
+///   - request: `Fetch all UUID metadata` request object which should be used to fetch first page.
+///   - batchBlock: `UUID metadata` batch handler block.
+///   - block: `Stream all UUID metadata` completion block.
+- (void)streamAllUUIDMetadataWithRequest:(PNFetchAllUUIDMetadataRequest *)request
+                                 batches:(PNObjectsStreamBatchBlock)batchBlock
+                              completion:(nullable PNObjectsStreamCompletionBlock)block;
+
+/// `Stream all channels metadata`.
+///
+/// Fetch all pages starting from the one specified by `request` and pass `channel metadata` objects in page-sized
+/// batches to the `batchBlock`. Next page request is sent while the current batch is processed, and at most one
+/// prefetched page is held in memory.
+///
+/// - Parameters:
+///   - request: `Fetch all channels metadata` request object which should be used to fetch first page.
+///   - batchBlock: `Channel metadata` batch handler block.
+///   - block: `Stream all channels metadata` completion block.
+- (void)streamAllChannelsMetadataWithRequest:(PNFetchAllChannelsMetadataRequest *)request
+                                     batches:(PNObjectsStreamBatchBlock)batchBlock
+                                  completion:(nullable PNObjectsStreamCompletionBlock)block;
+
+/// `Stream UUID's memberships`.
+///
+/// Fetch all pages starting from the one specified by `request` and pass `membership` objects in page-sized batches
+/// to the `batchBlock`. Next page request is sent while the current batch is processed, and at most one prefetched
+/// page is held in memory.
+///
+/// - Parameters:
+///   - request: `Fetch UUID's memberships` request object which should be used to fetch first page.
+///   - batchBlock: `Membership` batch handler block.
+///   - block: `Stream UUID's memberships` completion block.
+- (void)streamMembershipsWithRequest:(PNFetchMembershipsRequest *)request
+                             batches:(PNObjectsStreamBatchBlock)batchBlock
+                          completion:(nullable PNObjectsStreamCompletionBlock)block;
+
+/// `Stream channel's members`.
+///
+/// Fetch all pages starting from the one specified by `request` and pass `member` objects in page-sized batches to
+/// the `batchBlock`. Next page request is sent while the current batch is processed, and at most one prefetched page
+/// is held in memory.
+///
+/// - Parameters:
+///   - request: `Fetch channel's members` request object which should be used to fetch first page.
+///   - batchBlock: `Member` batch handler block.
+///   - block: `Stream channel's members` completion block.
+- (void)streamChannelMembersWithRequest:(PNFetchChannelMembersRequest *)request
+                                batches:(PNObjectsStreamBatchBlock)batchBlock
+                             completion:(nullable PNObjectsStreamCompletionBlock)block;
+
 #pragma mark -
 
 
@@ -4,6 +4,7 @@
 #import "PNStringLogEntry+Private.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
+#import "PNPageStream.h"
 #import "PNFunctions.h"
 #import "PNHelpers.h"
 
@@ -117,6 +118,19 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)sendFetchChannelMembersRequestUsingBuilderParameters:(NSDictionary *)parameters;
 
 
+#pragma mark - Objects streaming
+
+/// Stream objects from pages fetched by `fetchBlock`.
+///
+/// - Parameters:
+///   - fetchBlock: Block which should fetch page which follows previously fetched page.
+///   - batchBlock: Objects batch handler block.
+///   - block: Streaming completion block.
+- (void)streamObjectsWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                            batches:(PNObjectsStreamBatchBlock)batchBlock
+                         completion:(nullable PNObjectsStreamCompletionBlock)block;
+
+
 #pragma mark - Misc
 
 /// Add common parameters for multi-paged request suing information passed to builder-based API.
@@ -127,6 +141,16 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)addObjectsPaginationOptionsToRequest:(PNObjectsPaginatedRequest *)request
                       usingBuilderParameters:(NSDictionary *)parameters;
 
+/// Copy multi-paged request parameters from user-provided request to the request for next page.
+///
+/// - Parameters:
+///   - request: Request for next page for which properties should be set.
+///   - userRequest: User-provided request with page configuration.
+///   - start: Cursor of the page which should be fetched.
+- (void)copyObjectsPaginationOptionsToRequest:(PNObjectsPaginatedRequest *)request
+                                  fromRequest:(PNObjectsPaginatedRequest *)userRequest
+                                    withStart:(nullable NSString *)start;
+
 #pragma mark -
 
 
@@ -993,6 +1017,112 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Objects streaming
+
+- (void)streamAllUUIDMetadataWithRequest:(PNFetchAllUUIDMetadataRequest *)request
+                                 batches:(PNObjectsStreamBatchBlock)batchBlock
+                              completion:(PNObjectsStreamCompletionBlock)block {
+    __block NSString *start = request.start;
+    PNWeakify(self);
+    [self streamObjectsWithFetchBlock:^(PNPageStreamPageBlock pageBlock) {
+        PNStrongify(self);
+        if (!self) {
+            pageBlock(nil, NO, nil);
+            return;
+        }
+
+        PNFetchAllUUIDMetadataRequest *pageRequest = [PNFetchAllUUIDMetadataRequest new];
+        [self copyObjectsPaginationOptionsToRequest:pageRequest fromRequest:request withStart:start];
+        [self allUUIDMetadataWithRequest:pageRequest
+                              completion:^(PNFetchAllUUIDMetadataResult *result, PNErrorStatus *status) {
+            start = result.data.next;
+            pageBlock(result.data.metadata, result.data.next.length > 0, status);
+        }];
+    } batches:batchBlock completion:block];
+}
+
+- (void)streamAllChannelsMetadataWithRequest:(PNFetchAllChannelsMetadataRequest *)request
+                                     batches:(PNObjectsStreamBatchBlock)batchBlock
+                                  completion:(PNObjectsStreamCompletionBlock)block {
+    __block NSString *start = request.start;
+    PNWeakify(self);
+    [self streamObjectsWithFetchBlock:^(PNPageStreamPageBlock pageBlock) {
+        PNStrongify(self);
+        if (!self) {
+            pageBlock(nil, NO, nil);
+            return;
+        }
+
+        PNFetchAllChannelsMetadataRequest *pageRequest = [PNFetchAllChannelsMetadataRequest new];
+        [self copyObjectsPaginationOptionsToRequest:pageRequest fromRequest:request withStart:start];
+        [self allChannelsMetadataWithRequest:pageRequest
+                                  completion:^(PNFetchAllChannelsMetadataResult *result, PNErrorStatus *status) {
+            start = result.data.next;
+            pageBlock(result.data.metadata, result.data.next.length > 0, status);
+        }];
+    } batches:batchBlock completion:block];
+}
+
+- (void)streamMembershipsWithRequest:(PNFetchMembershipsRequest *)request
+                             batches:(PNObjectsStreamBatchBlock)batchBlock
+                          completion:(PNObjectsStreamCompletionBlock)block {
+    __block NSString *start = request.start;
+    PNWeakify(self);
+    [self streamObjectsWithFetchBlock:^(PNPageStreamPageBlock pageBlock) {
+        PNStrongify(self);
+        if (!self) {
+            pageBlock(nil, NO, nil);
+            return;
+        }
+
+        PNFetchMembershipsRequest *pageRequest = [PNFetchMembershipsRequest requestWithUUID:request.identifier];
+        [self copyObjectsPaginationOptionsToRequest:pageRequest fromRequest:request withStart:start];
+        [self membershipsWithRequest:pageRequest
+                          completion:^(PNFetchMembershipsResult *result, PNErrorStatus *status) {
+            start = result.data.next;
+            pageBlock(result.data.memberships, result.data.next.length > 0, status);
+        }];
+    } batches:batchBlock completion:block];
+}
+
+- (void)streamChannelMembersWithRequest:(PNFetchChannelMembersRequest *)request
+                                batches:(PNObjectsStreamBatchBlock)batchBlock
+                             completion:(PNObjectsStreamCompletionBlock)block {
+    __block NSString *start = request.start;
+    PNWeakify(self);
+    [self streamObjectsWithFetchBlock:^(PNPageStreamPageBlock pageBlock) {
+        PNStrongify(self);
+        if (!self) {
+            pageBlock(nil, NO, nil);
+            return;
+        }
+
+        PNFetchChannelMembersRequest *pageRequest;
+        pageRequest = [PNFetchChannelMembersRequest requestWithChannel:request.identifier];
+        [self copyObjectsPaginationOptionsToRequest:pageRequest fromRequest:request withStart:start];
+        [self channelMembersWithRequest:pageRequest
+                             completion:^(PNFetchChannelMembersResult *result, PNErrorStatus *status) {
+            start = result.data.next;
+            pageBlock(result.data.members, result.data.next.length > 0, status);
+        }];
+    } batches:batchBlock completion:block];
+}
+
+- (void)streamObjectsWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                            batches:(PNObjectsStreamBatchBlock)batchBlock
+                         completion:(PNObjectsStreamCompletionBlock)block {
+    [self.logger debugWithLocation:@"PubNub" andMessageFactory:^PNLogEntry * {
+        return [PNStringLogEntry entryWithMessage:@"Stream App Context objects."
+                                        operation:PNAppContextLogMessageOperation];
+    }];
+
+    [[PNPageStream streamWithFetchBlock:fetchBlock
+                          callbackQueue:self.callbackQueue
+                             batchBlock:batchBlock
+                        completionBlock:block] start];
+}
+
+
 #pragma mark - Misc
 
 - (void)addObjectsPaginationOptionsToRequest:(PNObjectsPaginatedRequest *)request
@@ -1009,6 +1139,18 @@ NS_ASSUME_NONNULL_END
     if (includeFields) request.includeFields = includeFields.unsignedIntegerValue;
 }
 
+- (void)copyObjectsPaginationOptionsToRequest:(PNObjectsPaginatedRequest *)request
+                                  fromRequest:(PNObjectsPaginatedRequest *)userRequest
+                                    withStart:(NSString *)start {
+    request.arbitraryQueryParameters = userRequest.arbitraryQueryParameters;
+    request.includeFields = userRequest.includeFields;
+    request.filter = userRequest.filter;
+    request.limit = userRequest.limit;
+    request.sort = userRequest.sort;
+    request.end = userRequest.end;
+    request.start = start;
+}
+
 #pragma mark -
 
 
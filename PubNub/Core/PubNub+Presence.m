@@ -492,22 +492,11 @@ NS_ASSUME_NONNULL_END
 }
 
 - (NSArray<NSString *> *)channelsForHeartbeat {
-    NSArray *subscribedChannels = nil;
-    
-    if (self.configuration.shouldManagePresenceListManually) subscribedChannels = [self.heartbeatManager channels];
-    else subscribedChannels = [self.subscriberManager channels];
-
-    return [PNChannel objectsWithOutPresenceFrom:subscribedChannels];
+    return [self.heartbeatManager channelsForHeartbeat];
 }
 
 - (NSArray<NSString *> *)channelGroupsForHeartbeat {
-    NSArray *subscribedChannelGroups = nil;
-    
-    if (self.configuration.shouldManagePresenceListManually) {
-        subscribedChannelGroups = [self.heartbeatManager channelGroups];
-    } else subscribedChannelGroups = [self.subscriberManager channelGroups];
-    
-    return [PNChannel objectsWithOutPresenceFrom:subscribedChannelGroups];
+    return [self.heartbeatManager channelGroupsForHeartbeat];
 }
 
 #pragma mark -
@@ -94,12 +94,34 @@ NS_ASSUME_NONNULL_BEGIN
 /// }];
 /// ```
 ///
+/// > Note: If client configured with `maximumInFlightPublishRequests`, request will be sent through client-side publish
+/// queue and `block` will be called with `PNPublishQueueFullCategory` error status if queue is full.
+///
 /// - Parameters:
 ///   - request: Request with information required to publish provided data.
 ///   - block: Data publish request completion block.
 - (void)publishWithRequest:(PNPublishRequest *)request completion:(nullable PNPublishCompletionBlock)block;
 
 
+#pragma mark - Publish queue information
+
+/// Number of publish requests which are waiting in client-side publish queue.
+///
+/// - Returns: Number of waiting publish requests or `0` if publish queue is disabled.
+- (NSUInteger)publishQueueDepth;
+
+/// Number of publish requests from client-side publish queue which are being sent.
+///
+/// - Returns: Number of sent publish requests or `0` if publish queue is disabled.
+- (NSUInteger)publishQueueInFlightCount;
+
+/// Average time (in seconds) between publish call and its completion for publish requests from client-side publish
+/// queue.
+///
+/// - Returns: Exponentially weighted moving average of publish latency or `0` if publish queue is disabled.
+- (NSTimeInterval)publishQueueLatency;
+
+
 #pragma mark - Plain message publish
 
 /// Send provided Foundation object to **PubNub** service.
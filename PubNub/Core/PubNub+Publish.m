@@ -250,7 +250,28 @@ NS_ASSUME_NONNULL_END
                                             operation:PNMessageSendLogMessageOperation];
     }];
 
-    [self performRequest:userRequest withParser:responseParser completion:handler];
+    // Request without channel won't pass validation, so it shouldn't take place in the publish queue.
+    if (!self.publishQueue || userRequest.channel.length == 0) {
+        [self performRequest:userRequest withParser:responseParser completion:handler];
+        return;
+    }
+
+    BOOL enqueued = [self.publishQueue enqueueForChannel:userRequest.channel withBlock:^(dispatch_block_t completion) {
+        [self performRequest:userRequest
+                  withParser:responseParser
+                  completion:^(PNTransportRequest *request, id<PNTransportResponse> response, NSURL *location,
+                               PNOperationDataParseResult *result) {
+            completion();
+            handler(request, response, location, result);
+        }];
+    }];
+
+    if (!enqueued) {
+        PNPublishStatus *status = [PNPublishStatus objectWithOperation:userRequest.operation
+                                                              category:PNPublishQueueFullCategory
+                                                              response:nil];
+        [self callBlock:block status:YES withResult:nil andStatus:status];
+    }
 }
 
 - (void)publish:(id)message toChannel:(NSString *)channel withCompletion:(PNPublishCompletionBlock)block {
@@ -475,6 +496,21 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Publish queue information
+
+- (NSUInteger)publishQueueDepth {
+    return self.publishQueue.depth;
+}
+
+- (NSUInteger)publishQueueInFlightCount {
+    return self.publishQueue.inFlightCount;
+}
+
+- (NSTimeInterval)publishQueueLatency {
+    return self.publishQueue.averageLatency;
+}
+
+
 #pragma mark - Signal
 
 - (void)sendSignalWithRequest:(PNSignalRequest *)userRequest completion:(PNSignalCompletionBlock)handlerBlock {
@@ -69,6 +69,27 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Parameter listener: Listener which would like to receive updates.
 - (void)addListener:(id<PNEventsListener>)listener NS_SWIFT_NAME(addListener(_:));
 
+/// Add observer which conform to ``PNEventsListener`` protocol and would like to receive updates only from specific
+/// channels and channel groups.
+///
+/// Real-time updates routed to the listener using channel and channel group routing table, so listener won't be
+/// called for updates from other channels. Status change events delivered to the listener as usual.
+///
+/// #### Example:
+/// ```objc
+/// [self.client addListener:self forChannels:@[@"chat", @"news.*"] channelGroups:@[@"friends"]];
+/// ```
+///
+/// - Parameters:
+///   - listener: Listener which would like to receive updates.
+///   - channels: List of channel names for which listener would like to receive updates. Channel name which ends
+///   with `.*` is treated as wildcard pattern.
+///   - channelGroups: List of channel group names for which listener would like to receive updates.
+- (void)addListener:(id<PNEventsListener>)listener
+        forChannels:(nullable NSArray<NSString *> *)channels
+      channelGroups:(nullable NSArray<NSString *> *)channelGroups
+    NS_SWIFT_NAME(addListener(_:channels:channelGroups:));
+
 /// Remove listener from list for callback calls.
 ///
 /// When listener not interested in live feed updates it can remove itself from updates list using this method.
@@ -17,17 +17,9 @@
 #import "PNAPICallBuilder+Private.h"
 
 
-#pragma mark Constants
-
-/// Subscribe REST API path prefix.
-///
-/// Prefix used for faster request identification (w/o performing search of range with options).
-static NSString * const kPNSubscribeAPIPrefix = @"/v2/subscribe/";
-
-
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark - Private interface declaration
+#pragma mark Private interface declaration
 
 /// **PubNub** `Subscribe` APIs private extension.
 @interface PubNub (SubscribeProtected)
@@ -124,6 +116,12 @@ NS_ASSUME_NONNULL_END
     [self.listenersManager addListener:listener];
 }
 
+- (void)addListener:(id <PNEventsListener>)listener
+        forChannels:(NSArray<NSString *> *)channels
+      channelGroups:(NSArray<NSString *> *)channelGroups {
+    [self.listenersManager addListener:listener forChannels:channels channelGroups:channelGroups];
+}
+
 - (void)removeListener:(id <PNEventsListener>)listener {
     [self.listenersManager removeListener:listener];
 }
@@ -434,12 +432,8 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Misc
 
 - (void)cancelSubscribeOperations {
-    [self.subscriptionNetwork requestsWithBlock:^(NSArray<PNTransportRequest *> *requests) {
-        for(PNTransportRequest *request in requests) {
-            dispatch_block_t cancelBlock = request.cancel;
-            if ([request.path hasPrefix:kPNSubscribeAPIPrefix] && cancelBlock) cancelBlock();
-        }
-    }];
+    // Middleware falls back to active requests scan if transport doesn't keep tagged requests index.
+    [self.subscriptionNetwork cancelRequestsWithTag:PNOperationTypeStrings[PNSubscribeOperation]];
 }
 
 #pragma mark -
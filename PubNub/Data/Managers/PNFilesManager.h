@@ -36,6 +36,26 @@ NS_ASSUME_NONNULL_BEGIN
                      cryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
                        completion:(void(^)( NSURL * _Nullable location, NSError * _Nullable error))block;
 
+
+#pragma mark - Resumable download
+
+/// Retrieve information stored for interrupted file download.
+///
+/// - Parameter identifier: Unique `file` identifier which has been assigned during `file` upload.
+/// - Returns: Information which allows continuing download from the received offset or `nil` if there is no interrupted
+/// download for file.
+- (nullable NSData *)resumeDataForFileWithIdentifier:(NSString *)identifier;
+
+/// Store information about interrupted file download.
+///
+/// Information is stored on the local file system, so download can be continued even after application restart.
+///
+/// - Parameters:
+///   - resumeData: Information which allows continuing download from the received offset or `nil` to remove
+///   previously stored information.
+///   - identifier: Unique `file` identifier which has been assigned during `file` upload.
+- (void)storeResumeData:(nullable NSData *)resumeData forFileWithIdentifier:(NSString *)identifier;
+
 #pragma mark -
 
 
@@ -6,9 +6,23 @@
 #import "PNError.h"
 
 
+#pragma mark Constants
+
+/// Minimum size of buffer which is used to write decrypted file content.
+static NSUInteger const kPNMinimumDecryptionBufferSize = 16 * 1024;
+
+/// Maximum size of buffer which is used to write decrypted file content.
+///
+/// Decrypted data written to the file chunk by chunk, so buffer size doesn't need to grow with the file size.
+static NSUInteger const kPNMaximumDecryptionBufferSize = 256 * 1024;
+
+/// Name of directory (inside of caches directory) where information about interrupted downloads is stored.
+static NSString * const kPNResumableDownloadsDirectory = @"com.pubnub.downloads";
+
+
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Protected interface declaration
+#pragma mark - Protected interface declaration
 
 /// Files manager private extension.
 @interface PNFilesManager ()
@@ -37,6 +51,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Helpers
 
+/// Location where information about interrupted file download should be stored.
+///
+/// - Parameter identifier: Unique `file` identifier which has been assigned during `file` upload.
+/// - Returns: Location of the file with information for interrupted download or `nil` if caches directory not
+/// available.
+- (nullable NSURL *)resumeDataURLForFileWithIdentifier:(NSString *)identifier;
+
 /// Create data download error using information received from the service.
 ///
 /// - Parameter error: Download request processing error.
@@ -78,7 +99,10 @@ NS_ASSUME_NONNULL_END
                      withStoreURL:(NSURL *)localURL
                      cryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
                        completion:(void(^)( NSURL *location, NSError *error))block {
-    if (!location) block(nil, nil);
+    if (!location) {
+        block(nil, nil);
+        return;
+    }
     
     cryptoModule = cryptoModule ?: self.cryptoModule;
     BOOL temporary = !localURL;
@@ -107,6 +131,7 @@ NS_ASSUME_NONNULL_END
     } else if(cryptoModule) {
         NSDictionary *fileAttributes = [fileManager attributesOfItemAtPath:location.path error:nil];
         NSUInteger fileSize = ((NSNumber *)[fileAttributes objectForKey:NSFileSize]).unsignedIntegerValue;
+        NSUInteger bufferSize = MIN(MAX(fileSize, kPNMinimumDecryptionBufferSize), kPNMaximumDecryptionBufferSize);
         NSInputStream *sourceStream = [NSInputStream inputStreamWithURL:location];
 
         dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
@@ -114,10 +139,10 @@ NS_ASSUME_NONNULL_END
             NSError *decryptError = decryptResult.error;
 
             if (!decryptResult.isError) {
-                [decryptResult.data pn_writeToFileAtURL:storeURL withBufferSize:1024 * 1024 error:&decryptError];
+                [decryptResult.data pn_writeToFileAtURL:storeURL withBufferSize:bufferSize error:&decryptError];
             }
 
-            block(!decryptResult.isError ? storeURL : nil, decryptError);
+            block(!decryptError ? storeURL : nil, decryptError);
 
             if (temporary && !decryptError && ![fileManager removeItemAtURL:location error:&decryptError]) {
                 [self.logger debugWithLocation:@"PNFilesManager" andMessageFactory:^PNLogEntry * {
@@ -142,8 +167,51 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Resumable download
+
+- (NSData *)resumeDataForFileWithIdentifier:(NSString *)identifier {
+    NSURL *url = [self resumeDataURLForFileWithIdentifier:identifier];
+    return url ? [NSData dataWithContentsOfURL:url] : nil;
+}
+
+- (void)storeResumeData:(NSData *)resumeData forFileWithIdentifier:(NSString *)identifier {
+    NSURL *url = [self resumeDataURLForFileWithIdentifier:identifier];
+    NSFileManager *fileManager = NSFileManager.defaultManager;
+    NSError *error = nil;
+
+    if (!url) return;
+    if (!resumeData) {
+        if ([url checkResourceIsReachableAndReturnError:nil]) [fileManager removeItemAtURL:url error:&error];
+    } else if ([fileManager createDirectoryAtURL:url.URLByDeletingLastPathComponent
+                     withIntermediateDirectories:YES
+                                      attributes:nil
+                                           error:&error]) {
+        [resumeData writeToURL:url options:NSDataWritingAtomic error:&error];
+    }
+
+    if (error) {
+        [self.logger debugWithLocation:@"PNFilesManager" andMessageFactory:^PNLogEntry * {
+            NSString *message = error.localizedFailureReason ?: error.localizedDescription;
+            return [PNDictionaryLogEntry entryWithMessage:@{ @"error": message }
+                                                  details:@"Download resume information update error:"];
+        }];
+    }
+}
+
+
 #pragma mark - Misc
 
+- (NSURL *)resumeDataURLForFileWithIdentifier:(NSString *)identifier {
+    NSFileManager *fileManager = NSFileManager.defaultManager;
+    NSURL *caches = [fileManager URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    NSCharacterSet *allowedCharacters = NSCharacterSet.alphanumericCharacterSet;
+    NSString *filename = [identifier stringByAddingPercentEncodingWithAllowedCharacters:allowedCharacters];
+    if (!caches || filename.length == 0) return nil;
+
+    NSURL *directory = [caches URLByAppendingPathComponent:kPNResumableDownloadsDirectory isDirectory:YES];
+    return [directory URLByAppendingPathComponent:[filename stringByAppendingPathExtension:@"resume"]];
+}
+
 - (NSError *)downloadErrorForError:(NSError *)error {
     NSDictionary *userInfo = PNErrorUserInfo(error.localizedDescription, error.localizedFailureReason, nil, error);
     return [PNError errorWithDomain:PNStorageErrorDomain code:PNErrorUnknown userInfo:userInfo];
@@ -88,6 +88,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)setConnected:(BOOL)connected forChannelGroups:(NSArray<NSString *> *)channelGroups;
 
+/**
+ * @brief List of channels which should be used in heartbeat request.
+ *
+ * @discussion List built from subscribed channels (or channels for which presence managed manually) and rebuilt only
+ * when list of source channels changes.
+ *
+ * @return List of channels without presence channels.
+ */
+- (NSArray<NSString *> *)channelsForHeartbeat;
+
+/**
+ * @brief List of channel groups which should be used in heartbeat request.
+ *
+ * @discussion List built from subscribed channel groups (or groups for which presence managed manually) and rebuilt
+ * only when list of source channel groups changes.
+ *
+ * @return List of channel groups without presence groups.
+ */
+- (NSArray<NSString *> *)channelGroupsForHeartbeat;
+
 
 #pragma mark - State manipulation
 
@@ -101,6 +121,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)stopHeartbeatIfPossible;
 
+
+#pragma mark - Handlers
+
+/**
+ * @brief Process heartbeat timer fire event and send heartbeat request to \b PubNub service.
+ *
+ * @discussion Called by shared heartbeat scheduler with the rest of heartbeat managers from the same group.
+ */
+- (void)handleHeartbeatTimer;
+
 #pragma mark -
 
 
@@ -4,6 +4,7 @@
  */
 #import "PNHeartbeat.h"
 #import "PubNub+PresencePrivate.h"
+#import "PNHeartbeatScheduler.h"
 #import "PubNub+CorePrivate.h"
 #import "PNConfiguration.h"
 #import "PNStructures.h"
@@ -40,9 +41,34 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong) NSMutableArray *presenceChannelGroups;
 
 /**
- * @brief Stores reference on timer used to trigger heartbeat requests.
+ * @brief Whether heartbeat manager has been scheduled in shared heartbeat scheduler or not.
  */
-@property (nonatomic, nullable, strong) dispatch_source_t heartbeatTimer;
+@property (nonatomic, assign, getter = isScheduled) BOOL scheduled;
+
+/**
+ * @brief Version of list of channels and groups for which client's connected state has been changed manually.
+ */
+@property (nonatomic, assign) NSUInteger presenceObjectsVersion;
+
+/**
+ * @brief Version of source objects list which has been used to build heartbeat channels and groups.
+ */
+@property (nonatomic, assign) NSUInteger heartbeatObjectsVersion;
+
+/**
+ * @brief Subscriber which has been used as source of objects for heartbeat channels and groups.
+ */
+@property (nonatomic, nullable, weak) PNSubscriber *heartbeatObjectsSubscriber;
+
+/**
+ * @brief Channels which should be used in heartbeat request.
+ */
+@property (nonatomic, nullable, strong) NSArray<NSString *> *heartbeatChannels;
+
+/**
+ * @brief Channel groups which should be used in heartbeat request.
+ */
+@property (nonatomic, nullable, strong) NSArray<NSString *> *heartbeatChannelGroups;
 
 /**
  * @brief Stores reference on queue which is used to serialize access to shared heartbeat information.
@@ -62,15 +88,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initForClient:(PubNub *)client;
 
 
-#pragma mark - Handlers
+#pragma mark - Misc
 
 /**
- * @brief Process heartbeat timer fire event and send heartbeat request to \b PubNub service.
+ * @brief Rebuild list of channels and groups for heartbeat request if source list has been changed.
  */
-- (void)handleHeartbeatTimer;
-
-
-#pragma mark - Misc
+- (void)updateHeartbeatObjectsIfRequired;
 
 /**
  * @brief Check whether current configuration require inform about heartbeat request processing \c status or not.
@@ -91,8 +114,6 @@ NS_ASSUME_NONNULL_END
 
 @implementation PNHeartbeat
 
-@synthesize heartbeatTimer = _heartbeatTimer;
-
 
 #pragma mark - Initialization and Configuration
 
@@ -112,22 +133,6 @@ NS_ASSUME_NONNULL_END
     return self;
 }
 
-- (dispatch_source_t)heartbeatTimer {
-    __block dispatch_source_t timer = nil;
-    
-    pn_safe_property_read(self.resourceAccessQueue, ^{
-        timer = self->_heartbeatTimer;
-    });
-    
-    return timer;
-}
-
-- (void)setHeartbeatTimer:(dispatch_source_t)heartbeatTimer {
-    pn_safe_property_write(self.resourceAccessQueue, ^{
-        self->_heartbeatTimer = heartbeatTimer;
-    });
-}
-
 
 #pragma mark - Client presence
 
@@ -171,6 +176,8 @@ NS_ASSUME_NONNULL_END
             } else {
                 [self->_presenceChannels removeObjectsInArray:channels];
             }
+
+            self->_presenceObjectsVersion++;
         });
     }
 }
@@ -182,12 +189,36 @@ NS_ASSUME_NONNULL_END
                 [self->_presenceChannelGroups addObjectsFromArray:channelGroups];
             } else {
                 [self->_presenceChannelGroups removeObjectsInArray:channelGroups];
-
             }
+
+            self->_presenceObjectsVersion++;
         });
     }
 }
 
+- (NSArray<NSString *> *)channelsForHeartbeat {
+    __block NSArray<NSString *> *channels = nil;
+    [self updateHeartbeatObjectsIfRequired];
+
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        channels = self->_heartbeatChannels;
+    });
+
+    return channels ?: @[];
+}
+
+- (NSArray<NSString *> *)channelGroupsForHeartbeat {
+    __block NSArray<NSString *> *channelGroups = nil;
+    [self updateHeartbeatObjectsIfRequired];
+
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        channelGroups = self->_heartbeatChannelGroups;
+    });
+
+    return channelGroups ?: @[];
+}
+
+
 #pragma mark - State manipulation
 
 - (void)startHeartbeatIfRequired {
@@ -203,17 +234,17 @@ NS_ASSUME_NONNULL_END
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
     if (self.client.configuration.presenceHeartbeatInterval > 0 && heartbeatTimerStopped) {
-        __weak __typeof(self) weakSelf = self;
-        dispatch_queue_t timerQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
-        dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, timerQueue);
-        dispatch_source_set_event_handler(timer, ^{
-            [weakSelf handleHeartbeatTimer];
+        PNConfiguration *configuration = self.client.configuration;
+        // Heartbeat requests from clients with same origin and keyset sent together with single timer fire.
+        NSString *group = [NSString stringWithFormat:@"%@|%@", configuration.origin, configuration.subscribeKey];
+
+        pn_safe_property_write(self.resourceAccessQueue, ^{
+            self->_scheduled = YES;
         });
-        uint64_t offset = (uint64_t)self.client.configuration.presenceHeartbeatInterval * NSEC_PER_SEC;
-        dispatch_time_t start = dispatch_time(DISPATCH_TIME_NOW, (int64_t)offset);
-        dispatch_source_set_timer(timer, start, offset, NSEC_PER_SEC);
-        self.heartbeatTimer = timer;
-        dispatch_resume(timer);
+
+        [[PNHeartbeatScheduler sharedScheduler] scheduleHeartbeat:self
+                                                     withInterval:configuration.presenceHeartbeatInterval
+                                                            group:group];
     }
     #pragma clang diagnostic pop
 }
@@ -227,17 +258,12 @@ NS_ASSUME_NONNULL_END
          * which is not part of subscription loop and user's presence on them kept only by heartbeat.
          */
         if (self->_presenceChannels.count || self->_presenceChannelGroups.count) {
-            shouldStopHeartbeatTimer = !self->_heartbeatTimer;
-        }
-        
-        if (shouldStopHeartbeatTimer && self->_heartbeatTimer != NULL &&
-            dispatch_source_testcancel(self->_heartbeatTimer) == 0) {
-            
-            dispatch_source_cancel(self->_heartbeatTimer);
+            shouldStopHeartbeatTimer = !self->_scheduled;
         }
         
-        if (shouldStopHeartbeatTimer) {
-            self->_heartbeatTimer = nil;
+        if (shouldStopHeartbeatTimer && self->_scheduled) {
+            [[PNHeartbeatScheduler sharedScheduler] unscheduleHeartbeat:self];
+            self->_scheduled = NO;
         }
     });
     
@@ -256,9 +282,12 @@ NS_ASSUME_NONNULL_END
      */
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    if ([PNChannel objectsWithOutPresenceFrom:[self.client.subscriberManager allObjects]].count ||
-        [self allObjects].count) {
-        
+    __block BOOL hasPresenceObjects = NO;
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        hasPresenceObjects = self->_presenceChannels.count || self->_presenceChannelGroups.count;
+    });
+
+    if (self.channelsForHeartbeat.count || self.channelGroupsForHeartbeat.count || hasPresenceObjects) {
         __weak __typeof(self) weakSelf = self;
         [self.client heartbeatWithCompletion:^(PNStatus *status) {
             if ([weakSelf shouldNotifyAboutHeartbeatWithStatus:status]) {
@@ -274,6 +303,34 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Misc
 
+- (void)updateHeartbeatObjectsIfRequired {
+    BOOL managePresenceListManually = self.client.configuration.shouldManagePresenceListManually;
+    PNSubscriber *subscriber = managePresenceListManually ? nil : self.client.subscriberManager;
+    __block NSUInteger version = subscriber.objectsVersion;
+    __block BOOL upToDate = NO;
+
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        if (managePresenceListManually) version = self->_presenceObjectsVersion;
+        upToDate = self->_heartbeatChannels && self->_heartbeatObjectsVersion == version &&
+                   self->_heartbeatObjectsSubscriber == subscriber;
+    });
+
+    // Channels list rebuilt only when subscription (or manual presence) objects list changed.
+    if (upToDate) return;
+
+    NSArray<NSString *> *groups = subscriber ? subscriber.channelGroups : self.channelGroups;
+    NSArray<NSString *> *channels = subscriber ? subscriber.channels : self.channels;
+    groups = [PNChannel objectsWithOutPresenceFrom:groups];
+    channels = [PNChannel objectsWithOutPresenceFrom:channels];
+
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        self->_heartbeatObjectsSubscriber = subscriber;
+        self->_heartbeatObjectsVersion = version;
+        self->_heartbeatChannelGroups = groups;
+        self->_heartbeatChannels = channels;
+    });
+}
+
 - (BOOL)shouldNotifyAboutHeartbeatWithStatus:(PNStatus *)status {
     PNHeartbeatNotificationOptions heartbeatOptions = self.client.configuration.heartbeatNotificationOptions;
     BOOL shouldNotify = !((heartbeatOptions & PNHeartbeatNotifyNone) == PNHeartbeatNotifyNone);
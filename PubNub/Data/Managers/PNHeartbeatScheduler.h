@@ -0,0 +1,63 @@
+#import <Foundation/Foundation.h>
+
+
+#pragma mark Class forward
+
+@class PNHeartbeat;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Shared presence heartbeat scheduler.
+///
+/// Scheduler coalesces heartbeat timers of all **PubNub** client instances in the process. Heartbeat managers of
+/// clients which use the same origin, keyset and heartbeat interval share a single timer, so their heartbeat requests
+/// are sent together with one device wakeup.
+///
+/// > Note: Timers are created with leeway, which lets the system align them with other wakeups.
+@interface PNHeartbeatScheduler : NSObject
+
+
+#pragma mark - Initialization and configuration
+
+/// Shared heartbeat scheduler.
+///
+/// - Returns: Heartbeat scheduler which is shared between all **PubNub** client instances.
++ (instancetype)sharedScheduler;
+
+
+#pragma mark - Scheduling
+
+/// Add heartbeat manager to the group of periodically triggered heartbeat managers.
+///
+/// Heartbeat manager's `-handleHeartbeatTimer` will be called with the next group timer fire. If heartbeat manager
+/// already scheduled in another group, it will be moved to the new one.
+///
+/// > Note: Scheduler holds weak reference to the heartbeat manager.
+///
+/// - Parameters:
+///   - heartbeat: Heartbeat manager which should be triggered periodically.
+///   - interval: Interval (in seconds) between heartbeat timer fires.
+///   - group: Identifier of the heartbeat group (origin and keyset of **PubNub** client).
+- (void)scheduleHeartbeat:(PNHeartbeat *)heartbeat withInterval:(NSTimeInterval)interval group:(NSString *)group;
+
+/// Remove heartbeat manager from the group of periodically triggered heartbeat managers.
+///
+/// > Note: Group timer will be cancelled when the last heartbeat manager removed from it.
+///
+/// - Parameter heartbeat: Heartbeat manager which shouldn't be triggered anymore.
+- (void)unscheduleHeartbeat:(PNHeartbeat *)heartbeat;
+
+/// Number of timers which is used by scheduler at this moment.
+///
+/// - Returns: Number of active heartbeat groups.
+- (NSUInteger)timersCount;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,212 @@
+#import "PNHeartbeatScheduler.h"
+#import "PNHeartbeat.h"
+#import "PNLock.h"
+
+
+#pragma mark Constants
+
+/// Fraction of heartbeat interval which system can use to coalesce group timer with other wakeups.
+static double const kPNHeartbeatTimerLeewayFraction = 0.1f;
+
+/// Minimum leeway (in seconds) of group timer.
+static NSTimeInterval const kPNHeartbeatTimerMinimumLeeway = 1.f;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interfaces declaration
+
+/// Group of heartbeat managers triggered by single timer.
+@interface PNHeartbeatSchedulerGroup : NSObject
+
+
+#pragma mark - Properties
+
+/// Heartbeat managers which should be triggered by group timer.
+@property(strong, nonatomic) NSHashTable<PNHeartbeat *> *heartbeats;
+
+/// Timer which triggers group heartbeat managers.
+@property(strong, nullable, nonatomic) dispatch_source_t timer;
+
+#pragma mark -
+
+
+@end
+
+
+/// Shared heartbeat scheduler private extension.
+@interface PNHeartbeatScheduler ()
+
+
+#pragma mark - Properties
+
+/// Map of heartbeat group identifiers to the groups.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, PNHeartbeatSchedulerGroup *> *groups;
+
+/// Map of scheduled heartbeat managers to the identifiers of groups in which they are scheduled.
+@property(strong, nonatomic) NSMapTable<PNHeartbeat *, NSString *> *heartbeatGroups;
+
+/// Resources access lock.
+@property(strong, nonatomic) PNLock *lock;
+
+
+#pragma mark - Handlers
+
+/// Handle group timer fire.
+///
+/// - Parameter identifier: Identifier of the heartbeat group for which timer fired.
+- (void)handleTimerForGroup:(NSString *)identifier;
+
+
+#pragma mark - Helpers
+
+/// Remove heartbeat manager from the group.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Parameter heartbeat: Heartbeat manager which should be removed.
+- (void)removeHeartbeat:(PNHeartbeat *)heartbeat;
+
+/// Cancel group timer and remove group.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Parameter identifier: Identifier of the heartbeat group which should be removed.
+- (void)removeGroup:(NSString *)identifier;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNHeartbeatSchedulerGroup
+
+@end
+
+
+@implementation PNHeartbeatScheduler
+
+
+#pragma mark - Initialization and configuration
+
++ (instancetype)sharedScheduler {
+    static PNHeartbeatScheduler *_sharedScheduler;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        _sharedScheduler = [self new];
+    });
+
+    return _sharedScheduler;
+}
+
+- (instancetype)init {
+    if ((self = [super init])) {
+        _lock = [PNLock lockWithIsolationQueueName:@"heartbeat-scheduler"
+                          subsystemQueueIdentifier:@"com.pubnub.core"
+                                           backend:PNLockUnfairBackend];
+        _heartbeatGroups = [NSMapTable weakToStrongObjectsMapTable];
+        _groups = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+
+#pragma mark - Scheduling
+
+- (void)scheduleHeartbeat:(PNHeartbeat *)heartbeat withInterval:(NSTimeInterval)interval group:(NSString *)group {
+    NSString *identifier = [NSString stringWithFormat:@"%@|%@", group, @(interval)];
+
+    [self.lock syncWriteAccessWithBlock:^{
+        [self removeHeartbeat:heartbeat];
+
+        PNHeartbeatSchedulerGroup *heartbeatGroup = self.groups[identifier];
+        if (!heartbeatGroup) {
+            uint64_t leeway = (uint64_t)(MAX(interval * kPNHeartbeatTimerLeewayFraction,
+                                             kPNHeartbeatTimerMinimumLeeway) * NSEC_PER_SEC);
+            dispatch_queue_t timerQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+            heartbeatGroup = [PNHeartbeatSchedulerGroup new];
+            heartbeatGroup.heartbeats = [NSHashTable weakObjectsHashTable];
+            heartbeatGroup.timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, timerQueue);
+            self.groups[identifier] = heartbeatGroup;
+
+            __weak __typeof(self) weakSelf = self;
+            dispatch_source_set_event_handler(heartbeatGroup.timer, ^{
+                [weakSelf handleTimerForGroup:identifier];
+            });
+
+            uint64_t offset = (uint64_t)(interval * NSEC_PER_SEC);
+            dispatch_source_set_timer(heartbeatGroup.timer,
+                                      dispatch_time(DISPATCH_TIME_NOW, (int64_t)offset),
+                                      offset,
+                                      leeway);
+            dispatch_resume(heartbeatGroup.timer);
+        }
+
+        [heartbeatGroup.heartbeats addObject:heartbeat];
+        [self.heartbeatGroups setObject:identifier forKey:heartbeat];
+    }];
+}
+
+- (void)unscheduleHeartbeat:(PNHeartbeat *)heartbeat {
+    [self.lock syncWriteAccessWithBlock:^{
+        [self removeHeartbeat:heartbeat];
+    }];
+}
+
+- (NSUInteger)timersCount {
+    __block NSUInteger count = 0;
+
+    [self.lock syncReadAccessWithBlock:^{
+        count = self.groups.count;
+    }];
+
+    return count;
+}
+
+
+#pragma mark - Handlers
+
+- (void)handleTimerForGroup:(NSString *)identifier {
+    __block NSArray<PNHeartbeat *> *heartbeats = nil;
+
+    [self.lock syncWriteAccessWithBlock:^{
+        heartbeats = self.groups[identifier].heartbeats.allObjects;
+        // Clients which has been deallocated without heartbeat stop automatically removed from weak hash table.
+        if (heartbeats.count == 0) [self removeGroup:identifier];
+    }];
+
+    // Heartbeat managers may unschedule themselves while handling the timer.
+    for (PNHeartbeat *heartbeat in heartbeats) [heartbeat handleHeartbeatTimer];
+}
+
+
+#pragma mark - Helpers
+
+- (void)removeHeartbeat:(PNHeartbeat *)heartbeat {
+    NSString *identifier = [self.heartbeatGroups objectForKey:heartbeat];
+    if (!identifier) return;
+
+    PNHeartbeatSchedulerGroup *group = self.groups[identifier];
+    [self.heartbeatGroups removeObjectForKey:heartbeat];
+    [group.heartbeats removeObject:heartbeat];
+
+    if (group.heartbeats.allObjects.count == 0) [self removeGroup:identifier];
+}
+
+- (void)removeGroup:(NSString *)identifier {
+    PNHeartbeatSchedulerGroup *group = self.groups[identifier];
+    if (group.timer && dispatch_source_testcancel(group.timer) == 0) dispatch_source_cancel(group.timer);
+    [self.groups removeObjectForKey:identifier];
+}
+
+#pragma mark -
+
+
+@end
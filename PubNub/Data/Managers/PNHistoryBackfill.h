@@ -0,0 +1,80 @@
+#import <Foundation/Foundation.h>
+#import "PNHistoryBackfillRequest.h"
+#import "PNHistoryBackfillProgress.h"
+#import "PNErrorStatus.h"
+#import "PNStructures.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Types and structures
+
+/// Fetched history page handler block.
+///
+/// - Parameters:
+///   - messages: List of messages from fetched page (each should have `timetoken` key).
+///   - next: Exclusive upper bound for the next page request or `nil` if there is no more messages in window.
+///   - status: Fetch request error (if any).
+typedef void(^PNHistoryBackfillPageBlock)(NSArray<NSDictionary *> * _Nullable messages,
+                                          NSNumber * _Nullable next,
+                                          PNErrorStatus * _Nullable status);
+
+/// Channel history page fetch block.
+///
+/// - Parameters:
+///   - channel: Name of channel for which messages should be fetched.
+///   - lowerBound: Timetoken of the oldest message which can be fetched (inclusive).
+///   - upperBound: Timetoken of the newest message which can be fetched (exclusive).
+///   - pageBlock: Block which should be called with fetched page.
+typedef void(^PNHistoryBackfillFetchBlock)(NSString *channel,
+                                           NSNumber *lowerBound,
+                                           NSNumber *upperBound,
+                                           PNHistoryBackfillPageBlock pageBlock);
+
+
+#pragma mark - Interface declaration
+
+/// History backfill engine.
+///
+/// Engine split request's timetoken range into equal windows and fetch history for each `channel` / `window` pair
+/// concurrently (up to the requests budget). Messages of the window merged in timetoken order and passed to the batch
+/// block as soon as the window and all windows before it has been fetched, so batches always come in timetoken order.
+///
+/// > Note: Requests for the windows which are too far ahead of the one which is processed by the batch block won't be
+/// sent, so the engine holds in memory at most as many windows as its requests budget allows.
+@interface PNHistoryBackfill : NSObject
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure history backfill engine.
+///
+/// - Parameters:
+///   - request: Request with information about backfill range and channels.
+///   - budget: Maximum number of concurrent `fetchBlock` calls.
+///   - fetchBlock: Channel history page fetch block.
+///   - queue: Queue on which `batchBlock` and `block` should be called.
+///   - batchBlock: Window messages batch handler block.
+///   - block: Backfill completion handler block.
+/// - Returns: Configured and ready to use history backfill engine.
++ (instancetype)backfillWithRequest:(PNHistoryBackfillRequest *)request
+          maximumConcurrentRequests:(NSUInteger)budget
+                         fetchBlock:(PNHistoryBackfillFetchBlock)fetchBlock
+                      callbackQueue:(dispatch_queue_t)queue
+                         batchBlock:(PNHistoryBackfillBatchBlock)batchBlock
+                    completionBlock:(nullable PNHistoryBackfillCompletionBlock)block;
+
+
+#pragma mark - Backfill
+
+/// Start history backfill.
+///
+/// > Note: Engine retains itself until `completionBlock` is called.
+- (void)start;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
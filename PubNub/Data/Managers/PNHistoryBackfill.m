@@ -0,0 +1,515 @@
+#import "PNHistoryBackfill.h"
+#import "PNHistoryBackfillProgress+Private.h"
+#import "PNStatus+Private.h"
+#import "PNNumber.h"
+#import "PNJSON.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// Backfill range timetoken window.
+@interface PNHistoryBackfillWindow : NSObject
+
+
+#pragma mark - Properties
+
+/// Exclusive upper bound for the next page request of each channel which has more messages.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSNumber *> *cursors;
+
+/// Names of channels for which next page request should be sent.
+@property(strong, nonatomic) NSMutableArray<NSString *> *pendingChannels;
+
+/// Messages fetched for the window from all channels.
+@property(strong, nonatomic) NSMutableArray<NSDictionary *> *messages;
+
+/// Timetoken of the oldest message which can be fetched for window (inclusive).
+@property(strong, nonatomic) NSNumber *lowerBound;
+
+/// Timetoken of the newest message which can be fetched for window (exclusive).
+@property(strong, nonatomic) NSNumber *upperBound;
+
+/// Number of in-flight page requests for window.
+@property(assign, nonatomic) NSUInteger activeRequests;
+
+/// Whether all channels' messages for window has been fetched or not.
+@property(assign, nonatomic, readonly, getter = isCompleted) BOOL completed;
+
+#pragma mark -
+
+
+@end
+
+
+/// History backfill engine private extension.
+@interface PNHistoryBackfill ()
+
+
+#pragma mark - Properties
+
+/// Windows which has been scheduled for fetch but not passed to the batch handler block yet.
+@property(strong, nonatomic) NSMutableDictionary<NSNumber *, PNHistoryBackfillWindow *> *windows;
+
+/// Channel history page fetch block.
+@property(copy, nonatomic) PNHistoryBackfillFetchBlock fetchBlock;
+
+/// Backfill completion handler block.
+@property(copy, nullable, nonatomic) PNHistoryBackfillCompletionBlock completionBlock;
+
+/// Window messages batch handler block.
+@property(copy, nonatomic) PNHistoryBackfillBatchBlock batchBlock;
+
+/// Queue which is used to serialize access to the backfill state.
+@property(strong, nonatomic) dispatch_queue_t resourceAccessQueue;
+
+/// Queue on which `batchBlock` and `completionBlock` should be called.
+@property(strong, nonatomic) dispatch_queue_t callbackQueue;
+
+/// Request with information about backfill range and channels.
+@property(strong, nonatomic) PNHistoryBackfillRequest *request;
+
+/// Backfill self-reference which keeps it alive until completion.
+@property(strong, nullable, nonatomic) PNHistoryBackfill *activeBackfill;
+
+/// Page fetch request error.
+@property(strong, nullable, nonatomic) PNErrorStatus *status;
+
+/// Backfill start time.
+@property(assign, nonatomic) CFAbsoluteTime startTime;
+
+/// Timetoken of the oldest message in backfill range (inclusive).
+@property(assign, nonatomic) unsigned long long lowerBound;
+
+/// Timetoken of the newest message in backfill range (exclusive).
+@property(assign, nonatomic) unsigned long long upperBound;
+
+/// Maximum number of concurrent `fetchBlock` calls.
+@property(assign, nonatomic) NSUInteger budget;
+
+/// Number of in-flight page requests.
+@property(assign, nonatomic) NSUInteger activeRequests;
+
+/// Total number of timetoken windows in backfill range.
+@property(assign, nonatomic) NSUInteger windowsCount;
+
+/// Index of the window which should be passed to the batch handler block next.
+@property(assign, nonatomic) NSUInteger nextWindow;
+
+/// Number of messages which has been passed to the batch handler block.
+@property(assign, nonatomic) NSUInteger messagesCount;
+
+/// Number of completed page requests.
+@property(assign, nonatomic) NSUInteger requestsCount;
+
+/// Whether batch handler block is processing window messages or not.
+@property(assign, nonatomic) BOOL processing;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize history backfill engine.
+///
+/// - Parameters:
+///   - request: Request with information about backfill range and channels.
+///   - budget: Maximum number of concurrent `fetchBlock` calls.
+///   - fetchBlock: Channel history page fetch block.
+///   - queue: Queue on which `batchBlock` and `block` should be called.
+///   - batchBlock: Window messages batch handler block.
+///   - block: Backfill completion handler block.
+/// - Returns: Initialized history backfill engine.
+- (instancetype)initWithRequest:(PNHistoryBackfillRequest *)request
+      maximumConcurrentRequests:(NSUInteger)budget
+                     fetchBlock:(PNHistoryBackfillFetchBlock)fetchBlock
+                  callbackQueue:(dispatch_queue_t)queue
+                     batchBlock:(PNHistoryBackfillBatchBlock)batchBlock
+                completionBlock:(nullable PNHistoryBackfillCompletionBlock)block;
+
+
+#pragma mark - Backfill
+
+/// Compute backfill range and windows from request and progress token.
+///
+/// - Returns: `YES` if request describe valid backfill range.
+- (BOOL)prepareRange;
+
+/// Send page requests for the nearest windows while there is room in requests budget.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)scheduleRequests;
+
+/// Request next channel's history page for window.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+///
+/// - Parameters:
+///   - channel: Name of channel for which page should be fetched.
+///   - window: Timetoken window for which page should be fetched.
+- (void)fetchChannel:(NSString *)channel inWindow:(PNHistoryBackfillWindow *)window;
+
+/// Handle fetched channel's history page.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+///
+/// - Parameters:
+///   - messages: List of messages from fetched page.
+///   - next: Exclusive upper bound for the next page request.
+///   - status: Fetch request error (if any).
+///   - channel: Name of channel for which page has been fetched.
+///   - window: Timetoken window for which page has been fetched.
+- (void)handleMessages:(nullable NSArray<NSDictionary *> *)messages
+                  next:(nullable NSNumber *)next
+                status:(nullable PNErrorStatus *)status
+            forChannel:(NSString *)channel
+              inWindow:(PNHistoryBackfillWindow *)window;
+
+/// Pass next window messages to the batch handler block or complete backfill if there is nothing left to process.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)processNextWindow;
+
+/// Complete backfill and release resources.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)complete;
+
+
+#pragma mark - Misc
+
+/// Retrieve window for index.
+///
+/// Window will be created if it has been requested for the first time.
+///
+/// - Parameter index: Index of window in backfill range.
+/// - Returns: Timetoken window.
+- (PNHistoryBackfillWindow *)windowAtIndex:(NSUInteger)index;
+
+/// Compute timetoken of the oldest message in window.
+///
+/// - Parameter index: Index of window in backfill range.
+/// - Returns: Window lower bound timetoken.
+- (unsigned long long)lowerBoundForWindowAtIndex:(NSUInteger)index;
+
+/// Merge messages from different channels in timetoken order.
+///
+/// - Parameter messages: Window messages from all channels.
+/// - Returns: Sorted list of window messages.
+- (NSArray<NSDictionary *> *)sortedMessages:(NSArray<NSDictionary *> *)messages;
+
+/// Create snapshot of current backfill progress.
+///
+/// - Returns: Backfill progress object.
+- (PNHistoryBackfillProgress *)progress;
+
+/// Create token which allows to resume backfill from `nextWindow`.
+///
+/// - Returns: Base64-encoded progress token.
+- (NSString *)progressToken;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNHistoryBackfillWindow
+
+
+#pragma mark - Properties
+
+- (BOOL)isCompleted {
+    return self.pendingChannels.count == 0 && self.activeRequests == 0;
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation PNHistoryBackfill
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)backfillWithRequest:(PNHistoryBackfillRequest *)request
+          maximumConcurrentRequests:(NSUInteger)budget
+                         fetchBlock:(PNHistoryBackfillFetchBlock)fetchBlock
+                      callbackQueue:(dispatch_queue_t)queue
+                         batchBlock:(PNHistoryBackfillBatchBlock)batchBlock
+                    completionBlock:(PNHistoryBackfillCompletionBlock)block {
+    return [[self alloc] initWithRequest:request
+               maximumConcurrentRequests:budget
+                              fetchBlock:fetchBlock
+                           callbackQueue:queue
+                              batchBlock:batchBlock
+                         completionBlock:block];
+}
+
+- (instancetype)initWithRequest:(PNHistoryBackfillRequest *)request
+      maximumConcurrentRequests:(NSUInteger)budget
+                     fetchBlock:(PNHistoryBackfillFetchBlock)fetchBlock
+                  callbackQueue:(dispatch_queue_t)queue
+                     batchBlock:(PNHistoryBackfillBatchBlock)batchBlock
+                completionBlock:(PNHistoryBackfillCompletionBlock)block {
+    if ((self = [super init])) {
+        _resourceAccessQueue = dispatch_queue_create("com.pubnub.history-backfill", DISPATCH_QUEUE_SERIAL);
+        _windows = [NSMutableDictionary new];
+        _completionBlock = [block copy];
+        _batchBlock = [batchBlock copy];
+        _fetchBlock = [fetchBlock copy];
+        _budget = MAX(budget, 1);
+        _callbackQueue = queue;
+        _request = request;
+    }
+
+    return self;
+}
+
+
+#pragma mark - Backfill
+
+- (void)start {
+    dispatch_async(self.resourceAccessQueue, ^{
+        if (self.activeBackfill) return;
+
+        self.activeBackfill = self;
+        self.startTime = CFAbsoluteTimeGetCurrent();
+
+        if (![self prepareRange]) {
+            self.status = [PNErrorStatus objectWithOperation:PNHistoryOperation
+                                                    category:PNBadRequestCategory
+                                                    response:nil];
+            [self complete];
+            return;
+        }
+
+        [self scheduleRequests];
+        [self processNextWindow];
+    });
+}
+
+- (BOOL)prepareRange {
+    PNHistoryBackfillRequest *request = self.request;
+    if (request.channels.count == 0 || !request.start || !request.end) return NO;
+
+    unsigned long long start = [PNNumber timeTokenFromNumber:request.start].unsignedLongLongValue;
+    unsigned long long end = [PNNumber timeTokenFromNumber:request.end].unsignedLongLongValue;
+    NSUInteger windowsCount = request.windowsCount;
+    NSUInteger nextWindow = 0;
+
+    if (start > end || end == ULLONG_MAX) return NO;
+
+    if (request.progressToken.length) {
+        NSData *tokenData = [[NSData alloc] initWithBase64EncodedString:request.progressToken options:0];
+        NSString *tokenString = nil;
+        if (tokenData) tokenString = [[NSString alloc] initWithData:tokenData encoding:NSUTF8StringEncoding];
+        NSDictionary *token = tokenString ? [PNJSON JSONObjectFrom:tokenString withError:nil] : nil;
+        if (![token isKindOfClass:[NSDictionary class]]) return NO;
+
+        // Token can be used only to resume backfill of the same range.
+        if ([token[@"s"] unsignedLongLongValue] != start || [token[@"e"] unsignedLongLongValue] != end) return NO;
+
+        windowsCount = [token[@"w"] unsignedIntegerValue];
+        nextWindow = [token[@"n"] unsignedIntegerValue];
+        if (windowsCount == 0 || nextWindow > windowsCount) return NO;
+    }
+
+    self.lowerBound = start;
+    self.upperBound = end + 1;
+    self.windowsCount = (NSUInteger)MIN((unsigned long long)MAX(windowsCount, 1), self.upperBound - self.lowerBound);
+    self.nextWindow = MIN(nextWindow, self.windowsCount);
+
+    return YES;
+}
+
+- (void)scheduleRequests {
+    if (!self.activeBackfill || self.status) return;
+
+    // Look ahead not further than requests budget to limit number of windows kept in memory.
+    NSUInteger lastWindow = MIN(self.nextWindow + self.budget, self.windowsCount);
+
+    for (NSUInteger idx = self.nextWindow; idx < lastWindow && self.activeRequests < self.budget; idx++) {
+        PNHistoryBackfillWindow *window = [self windowAtIndex:idx];
+
+        while (window.pendingChannels.count && self.activeRequests < self.budget) {
+            NSString *channel = window.pendingChannels.firstObject;
+            [window.pendingChannels removeObjectAtIndex:0];
+            [self fetchChannel:channel inWindow:window];
+        }
+    }
+}
+
+- (void)fetchChannel:(NSString *)channel inWindow:(PNHistoryBackfillWindow *)window {
+    NSNumber *upperBound = window.cursors[channel] ?: window.upperBound;
+    window.activeRequests++;
+    self.activeRequests++;
+
+    PNHistoryBackfillPageBlock pageBlock = ^(NSArray *messages, NSNumber *next, PNErrorStatus *status) {
+        dispatch_async(self.resourceAccessQueue, ^{
+            [self handleMessages:messages next:next status:status forChannel:channel inWindow:window];
+        });
+    };
+
+    self.fetchBlock(channel, window.lowerBound, upperBound, pageBlock);
+}
+
+- (void)handleMessages:(NSArray<NSDictionary *> *)messages
+                  next:(NSNumber *)next
+                status:(PNErrorStatus *)status
+            forChannel:(NSString *)channel
+              inWindow:(PNHistoryBackfillWindow *)window {
+    window.activeRequests--;
+    self.activeRequests--;
+    self.requestsCount++;
+
+    // Backfill has been stopped while page has been fetched.
+    if (!self.activeBackfill) return;
+
+    if (status) {
+        if (!self.status) self.status = status;
+    } else {
+        for (NSDictionary *message in messages) {
+            NSMutableDictionary *channelMessage = [message mutableCopy];
+            channelMessage[@"channel"] = channel;
+            [window.messages addObject:channelMessage];
+        }
+
+        if (messages.count && next && next.unsignedLongLongValue > window.lowerBound.unsignedLongLongValue) {
+            window.cursors[channel] = next;
+            [window.pendingChannels addObject:channel];
+        }
+    }
+
+    [self scheduleRequests];
+    if (!self.processing) [self processNextWindow];
+}
+
+- (void)processNextWindow {
+    if (self.nextWindow >= self.windowsCount) {
+        [self complete];
+        return;
+    }
+
+    PNHistoryBackfillWindow *window = self.windows[@(self.nextWindow)];
+    if (!window.isCompleted) {
+        // Window won't be completed after error, so wait only for in-flight requests.
+        if (self.status && self.activeRequests == 0) [self complete];
+        return;
+    }
+
+    NSArray<NSDictionary *> *messages = [self sortedMessages:window.messages];
+    [self.windows removeObjectForKey:@(self.nextWindow)];
+    self.messagesCount += messages.count;
+    self.processing = YES;
+    self.nextWindow++;
+
+    PNHistoryBackfillProgress *progress = [self progress];
+
+    // Request next windows while current is processed by the batch handler block.
+    [self scheduleRequests];
+
+    dispatch_async(self.callbackQueue, ^{
+        BOOL stop = NO;
+        self.batchBlock(messages, progress, &stop);
+
+        dispatch_async(self.resourceAccessQueue, ^{
+            self.processing = NO;
+
+            if (stop) [self complete];
+            else [self processNextWindow];
+        });
+    });
+}
+
+- (void)complete {
+    if (!self.activeBackfill) return;
+
+    PNHistoryBackfillCompletionBlock block = self.completionBlock;
+    PNHistoryBackfillProgress *progress = [self progress];
+    PNErrorStatus *status = self.status;
+
+    [self.windows removeAllObjects];
+    self.completionBlock = nil;
+    self.activeBackfill = nil;
+
+    if (block) {
+        dispatch_async(self.callbackQueue, ^{
+            block(progress, status);
+        });
+    }
+}
+
+
+#pragma mark - Misc
+
+- (PNHistoryBackfillWindow *)windowAtIndex:(NSUInteger)index {
+    PNHistoryBackfillWindow *window = self.windows[@(index)];
+    if (window) return window;
+
+    window = [PNHistoryBackfillWindow new];
+    window.lowerBound = @([self lowerBoundForWindowAtIndex:index]);
+    window.upperBound = @([self lowerBoundForWindowAtIndex:index + 1]);
+    window.pendingChannels = [self.request.channels mutableCopy];
+    window.cursors = [NSMutableDictionary new];
+    window.messages = [NSMutableArray new];
+    self.windows[@(index)] = window;
+
+    return window;
+}
+
+- (unsigned long long)lowerBoundForWindowAtIndex:(NSUInteger)index {
+    unsigned long long span = self.upperBound - self.lowerBound;
+    unsigned long long windowSpan = span / self.windowsCount;
+
+    // Remainder spread across first windows, so bounds computed without overflow of `span * index`.
+    return self.lowerBound + windowSpan * index + MIN((unsigned long long)index, span % self.windowsCount);
+}
+
+- (NSArray<NSDictionary *> *)sortedMessages:(NSArray<NSDictionary *> *)messages {
+    NSMutableDictionary<NSString *, NSNumber *> *channelsOrder = [NSMutableDictionary new];
+    [self.request.channels enumerateObjectsUsingBlock:^(NSString *channel, NSUInteger idx, BOOL *stop) {
+        if (!channelsOrder[channel]) channelsOrder[channel] = @(idx);
+    }];
+
+    return [messages sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(NSDictionary *lhs,
+                                                                                             NSDictionary *rhs) {
+        NSComparisonResult result = [(NSNumber *)(lhs[@"timetoken"] ?: @0) compare:rhs[@"timetoken"] ?: @0];
+        if (result != NSOrderedSame) return result;
+
+        return [channelsOrder[lhs[@"channel"]] compare:channelsOrder[rhs[@"channel"]]];
+    }];
+}
+
+- (PNHistoryBackfillProgress *)progress {
+    PNHistoryBackfillProgress *progress = [PNHistoryBackfillProgress new];
+    progress.duration = CFAbsoluteTimeGetCurrent() - self.startTime;
+    progress.completedWindows = self.nextWindow;
+    progress.totalWindows = self.windowsCount;
+    progress.messagesCount = self.messagesCount;
+    progress.requestsCount = self.requestsCount;
+    progress.token = [self progressToken];
+
+    return progress;
+}
+
+- (NSString *)progressToken {
+    NSDictionary *token = @{
+        @"s": @(self.lowerBound),
+        @"e": @(self.upperBound > 0 ? self.upperBound - 1 : 0),
+        @"w": @(self.windowsCount),
+        @"n": @(self.nextWindow)
+    };
+    NSString *tokenString = [PNJSON JSONStringFrom:token withError:nil] ?: @"";
+
+    return [[tokenString dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:0];
+}
+
+#pragma mark -
+
+
+@end
@@ -14,6 +14,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Configured minimum log entries level.
 @property(assign, atomic) PNLogLevel logLevel;
 
+/// Total number of log entries which have been dropped or sampled out because of loggers overload.
+@property(assign, nonatomic, readonly) NSUInteger droppedEntriesCount;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -22,13 +25,22 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Parameters:
 ///   - clientIdentifier: Unique **PubNub** client identifier.
 ///   - minimumLogLevel: Minimum log entries level to be logged.
+///   - bufferSize: Maximum number of log entries which can wait for loggers. Log entries are passed to the loggers on
+///   the caller's thread if set to `0`.
 ///   - loggers: List of additional loggers that should be used along with user-provided custom loggers.
 /// - Returns: Ready-to-use loggers' manager.
 ///
 + (instancetype)managerWithClientIdentifier:(NSString *)clientIdentifier
                                    logLevel:(PNLogLevel)minimumLogLevel
+                                 bufferSize:(NSUInteger)bufferSize
                                  andLoggers:(NSArray<id<PNLogger>> *)loggers;
 
+
+#pragma mark - Logging
+
+/// Wait until all buffered log entries will be passed to the loggers.
+- (void)flush;
+
 #pragma mark -
 
 
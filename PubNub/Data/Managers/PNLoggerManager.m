@@ -1,20 +1,57 @@
 #import "PNLoggerManager+Private.h"
 #import "PNNetworkResponseLogEntry.h"
 #import "PNNetworkRequestLogEntry.h"
+#import "PNStringLogEntry+Private.h"
 #import "PNLogEntry+Private.h"
+#import "PNLogRingBuffer.h"
 #import "PNStructures.h"
+#import <stdatomic.h>
+
+
+#pragma mark Constants
+
+/// Share of the log entries buffer after which `trace` and `debug` entries are sampled.
+static double const kPNLoggerManagerSamplingThreshold = 0.75f;
+
+/// Only one of this number of `trace` and `debug` entries is kept while buffer is above sampling threshold.
+static NSUInteger const kPNLoggerManagerSamplingRate = 8;
+
+/// Key which is used to identify the ``writerQueue``.
+static char kPNLoggerManagerWriterQueueKey;
 
 
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Private interface declaration
+#pragma mark - Private interface declaration
 
 /// Loggers' manager private extension.
-@interface PNLoggerManager ()
+@interface PNLoggerManager () {
+    /// Whether buffered log entries processing has been scheduled on the ``writerQueue``.
+    _Atomic(BOOL) _drainScheduled;
+
+    /// Total number of log entries which have been dropped or sampled out because of loggers overload.
+    _Atomic(NSUInteger) _droppedEntriesCount;
+
+    /// Number of `trace` and `debug` entries which came while buffer has been above sampling threshold.
+    _Atomic(NSUInteger) _sampledEntriesCount;
+
+    /// Number of dropped log entries which already has been reported to the loggers.
+    ///
+    /// > Important: Accessed only from the ``writerQueue``.
+    NSUInteger _reportedDroppedEntriesCount;
+}
 
 
 #pragma mark - Properties
 
+/// Log entries which are waiting to be passed to the loggers.
+///
+/// > Note: Buffer is `nil` if log entries should be passed to the loggers on the caller's thread.
+@property(strong, nullable, nonatomic) PNLogRingBuffer *buffer;
+
+/// Queue on which buffered log entries are formatted and passed to the loggers.
+@property(strong, nullable, nonatomic) dispatch_queue_t writerQueue;
+
 /// List of additional loggers that should be used along with user-provided custom loggers.
 @property(copy, nonatomic) NSArray<id<PNLogger>> *loggers;
 
@@ -32,11 +69,14 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Parameters:
 ///   - clientIdentifier: Unique **PubNub** client identifier.
 ///   - minimumLogLevel: Minimum log entries level to be logged.
+///   - bufferSize: Maximum number of log entries which can wait for loggers. Log entries are passed to the loggers on
+///   the caller's thread if set to `0`.
 ///   - loggers: List of additional loggers that should be used along with user-provided custom loggers.
 /// - Returns: Initialized loggers' manager.
 ///
 - (instancetype)initWithClientIdentifier:(NSString *)clientIdentifier
                                 logLevel:(PNLogLevel)minimumLogLevel
+                              bufferSize:(NSUInteger)bufferSize
                               andLoggers:(NSArray<id<PNLogger>> *)loggers;
 
 
@@ -50,6 +90,39 @@ NS_ASSUME_NONNULL_BEGIN
 ///   - message: Log entry message, which should be passed to the loggers.
 - (void)logWithLevel:(PNLogLevel)logLevel location:(NSString *)location andMessage:(nullable PNLogEntry *)message;
 
+/// Add log entry to the buffer.
+///
+/// `trace` and `debug` entries are sampled while buffer is almost full, and any entry is dropped when buffer is full.
+///
+/// - Parameter message: Log entry which should be passed to the loggers from the ``writerQueue``.
+- (void)enqueueMessage:(PNLogEntry *)message;
+
+/// Pass log entry to the loggers after all buffered log entries.
+///
+/// Method returns only after the loggers processed log entry, so `warn` and `error` entries aren't lost if the
+/// application terminates right after they have been logged.
+///
+/// - Parameter message: Log entry which should be passed to the loggers.
+- (void)dispatchMessageAfterBufferedEntries:(PNLogEntry *)message;
+
+/// Schedule buffered log entries processing on the ``writerQueue`` if it hasn't been scheduled yet.
+- (void)scheduleDrain;
+
+/// Pass all buffered log entries to the loggers.
+///
+/// > Important: Method should be called from the ``writerQueue``.
+- (void)drain;
+
+/// Pass log entry with number of recently dropped log entries to the loggers.
+///
+/// > Important: Method should be called from the ``writerQueue``.
+- (void)reportDroppedEntries;
+
+/// Pass log entry to the loggers.
+///
+/// - Parameter message: Log entry which should be passed to the loggers.
+- (void)dispatchMessage:(PNLogEntry *)message;
+
 
 #pragma mark - Helpers
 
@@ -72,21 +145,45 @@ NS_ASSUME_NONNULL_END
 @implementation PNLoggerManager
 
 
+#pragma mark - Properties
+
+- (NSUInteger)droppedEntriesCount {
+    return atomic_load_explicit(&_droppedEntriesCount, memory_order_relaxed);
+}
+
+
 #pragma mark - Initialization and Configuration
 
 + (instancetype)managerWithClientIdentifier:(NSString *)clientIdentifier
                                    logLevel:(PNLogLevel)minimumLogLevel
+                                 bufferSize:(NSUInteger)bufferSize
                                  andLoggers:(NSArray<id<PNLogger>> *)loggers {
-    return [[self alloc] initWithClientIdentifier:clientIdentifier logLevel:minimumLogLevel andLoggers:loggers];
+    return [[self alloc] initWithClientIdentifier:clientIdentifier
+                                         logLevel:minimumLogLevel
+                                       bufferSize:bufferSize
+                                       andLoggers:loggers];
 }
 
 - (instancetype)initWithClientIdentifier:(NSString *)clientIdentifier
                                 logLevel:(PNLogLevel)minimumLogLevel
+                              bufferSize:(NSUInteger)bufferSize
                               andLoggers:(NSArray<id<PNLogger>> *)loggers {
     if ((self = [super init])) {
         _clientIdentifier = [clientIdentifier copy];
         _logLevel = minimumLogLevel;
         _loggers = [loggers copy];
+        atomic_init(&_drainScheduled, NO);
+        atomic_init(&_droppedEntriesCount, 0);
+        atomic_init(&_sampledEntriesCount, 0);
+
+        if (bufferSize > 0) {
+            dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL,
+                                                                                       QOS_CLASS_UTILITY,
+                                                                                       0);
+            _writerQueue = dispatch_queue_create("com.pubnub.logger", attributes);
+            dispatch_queue_set_specific(_writerQueue, &kPNLoggerManagerWriterQueueKey, (__bridge void *)self, NULL);
+            _buffer = [PNLogRingBuffer bufferWithCapacity:bufferSize];
+        }
     }
     
     return self;
@@ -156,6 +253,75 @@ NS_ASSUME_NONNULL_END
     // Assign operation for network request / response log messages.
     if (message.operation == PNUnknownLogMessageOperation) message.operation = [self logOperationFromMessage:message];
     
+    if (!self.buffer) [self dispatchMessage:message];
+    else if (logLevel >= PNWarnLogLevel) [self dispatchMessageAfterBufferedEntries:message];
+    else [self enqueueMessage:message];
+}
+
+- (void)enqueueMessage:(PNLogEntry *)message {
+    BOOL shouldSample = message.logLevel <= PNDebugLogLevel &&
+        self.buffer.count >= (NSUInteger)(self.buffer.capacity * kPNLoggerManagerSamplingThreshold);
+    BOOL sampledOut = shouldSample &&
+        atomic_fetch_add_explicit(&_sampledEntriesCount, 1, memory_order_relaxed) % kPNLoggerManagerSamplingRate != 0;
+
+    if (sampledOut || ![self.buffer enqueueEntry:message]) {
+        atomic_fetch_add_explicit(&_droppedEntriesCount, 1, memory_order_relaxed);
+        return;
+    }
+
+    [self scheduleDrain];
+}
+
+- (void)dispatchMessageAfterBufferedEntries:(PNLogEntry *)message {
+    // Logger may log from the writer queue (for example through PubNub client API).
+    if (dispatch_get_specific(&kPNLoggerManagerWriterQueueKey) == (__bridge void *)self) {
+        [self dispatchMessage:message];
+        return;
+    }
+
+    dispatch_sync(self.writerQueue, ^{
+        [self drain];
+        [self dispatchMessage:message];
+    });
+}
+
+- (void)scheduleDrain {
+    if (atomic_exchange_explicit(&_drainScheduled, YES, memory_order_acq_rel)) return;
+
+    dispatch_async(self.writerQueue, ^{
+        [self drain];
+    });
+}
+
+- (void)drain {
+    do {
+        PNLogEntry *message;
+        while ((message = [self.buffer dequeueEntry])) [self dispatchMessage:message];
+        [self reportDroppedEntries];
+
+        atomic_store_explicit(&_drainScheduled, NO, memory_order_release);
+        // Entries which have been added after last dequeue, but before flag reset, may not have scheduled drain.
+    } while (self.buffer.count > 0 && !atomic_exchange_explicit(&_drainScheduled, YES, memory_order_acq_rel));
+}
+
+- (void)reportDroppedEntries {
+    NSUInteger droppedEntriesCount = self.droppedEntriesCount;
+    NSUInteger count = droppedEntriesCount - _reportedDroppedEntriesCount;
+    _reportedDroppedEntriesCount = droppedEntriesCount;
+    if (count == 0 || self.logLevel > PNWarnLogLevel) return;
+
+    NSString *text = [NSString stringWithFormat:@"%@ log entries have been dropped because loggers can't keep up.",
+                      @(count)];
+    PNLogEntry *message = [PNStringLogEntry entryWithMessage:text operation:PNUnknownLogMessageOperation];
+    message.pubNubId = self.clientIdentifier;
+    message.minimumLogLevel = self.logLevel;
+    message.location = @"PNLoggerManager";
+    message.logLevel = PNWarnLogLevel;
+
+    [self dispatchMessage:message];
+}
+
+- (void)dispatchMessage:(PNLogEntry *)message {
     for (id<PNLogger> logger in self.loggers) {
         if (message.logLevel == PNTraceLogLevel) [logger traceWithMessage:message];
         else if (message.logLevel == PNDebugLogLevel) [logger debugWithMessage:message];
@@ -165,6 +331,18 @@ NS_ASSUME_NONNULL_END
     }
 }
 
+- (void)flush {
+    if (!self.buffer) return;
+    if (dispatch_get_specific(&kPNLoggerManagerWriterQueueKey) == (__bridge void *)self) {
+        [self drain];
+        return;
+    }
+
+    dispatch_sync(self.writerQueue, ^{
+        [self drain];
+    });
+}
+
 
 #pragma mark - Helpers
 
@@ -0,0 +1,69 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Real-time messages de-duplication cache.
+///
+/// Fixed-capacity ring buffer of message identity entries (publish timetoken, channel hash and payload fingerprint)
+/// indexed by open-addressed hash table. Insertion, lookup and eviction of the oldest entry are constant-time
+/// operations.
+///
+/// > Important: Cache doesn't provide any synchronization and should be accessed from single queue.
+@interface PNMessageDeduplicationCache : NSObject <NSCopying>
+
+
+#pragma mark - Properties
+
+/// Maximum number of entries which can be stored in cache.
+@property(assign, nonatomic, readonly) NSUInteger capacity;
+
+/// Number of entries stored in cache.
+@property(assign, nonatomic, readonly) NSUInteger count;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure messages de-duplication cache.
+///
+/// - Parameter capacity: Maximum number of entries which can be stored in cache.
+/// - Returns: Ready to use messages de-duplication cache.
++ (instancetype)cacheWithCapacity:(NSUInteger)capacity;
+
+/// Change maximum number of entries which can be stored in cache.
+///
+/// If new capacity is smaller than number of stored entries, oldest entries will be evicted.
+///
+/// - Parameter capacity: New maximum number of entries which can be stored in cache.
+- (void)resizeToCapacity:(NSUInteger)capacity;
+
+
+#pragma mark - Storage
+
+/// Store message identity in cache.
+///
+/// If cache is full, oldest entry will be evicted to make room for new entry.
+///
+/// - Parameters:
+///   - timetoken: Message publish timetoken.
+///   - channel: Name of channel to which message has been published.
+///   - fingerprint: Message payload fingerprint.
+/// - Returns: `NO` in case if same message already has been stored in cache (duplicate).
+- (BOOL)storeMessageWithTimetoken:(uint64_t)timetoken channel:(NSString *)channel fingerprint:(uint32_t)fingerprint;
+
+/// Remove messages with same or newer publish timetoken.
+///
+/// - Parameter timetoken: Timetoken starting from which messages should be removed from cache.
+- (void)removeMessagesNewerThan:(uint64_t)timetoken;
+
+/// Remove all stored entries.
+- (void)removeAllMessages;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
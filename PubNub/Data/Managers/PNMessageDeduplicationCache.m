@@ -0,0 +1,342 @@
+#import "PNMessageDeduplicationCache.h"
+
+
+#pragma mark Types and structures
+
+/// Value which is used to mark empty hash table bucket.
+static const int32_t kPNEmptyBucket = -1;
+
+/// Cached message identity.
+typedef struct PNMessageCacheEntry {
+    /// Message publish timetoken.
+    uint64_t timetoken;
+
+    /// FNV-1a hash of the message channel name.
+    uint64_t channelHash;
+
+    /// Message payload fingerprint.
+    uint32_t fingerprint;
+} PNMessageCacheEntry;
+
+
+#pragma mark - Helpers
+
+/// Compute FNV-1a hash of the channel name UTF-8 representation.
+///
+/// - Parameter channel: Channel name for which hash should be computed.
+/// - Returns: 64-bit channel name hash.
+static uint64_t PNMessageCacheChannelHash(NSString *channel) {
+    const char *bytes = channel ? CFStringGetCStringPtr((__bridge CFStringRef)channel, kCFStringEncodingUTF8) : NULL;
+    if (!bytes) bytes = channel.UTF8String;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (; bytes && *bytes; bytes++) {
+        hash ^= (uint8_t)*bytes;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/// Compute hash table bucket hash for cached message identity.
+///
+/// - Parameter entry: Message identity for which hash should be computed.
+/// - Returns: Well-mixed 64-bit hash.
+static inline uint64_t PNMessageCacheEntryHash(const PNMessageCacheEntry *entry) {
+    uint64_t hash = entry->timetoken ^ (entry->channelHash * 0x9e3779b97f4a7c15ULL) ^ entry->fingerprint;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+
+    return hash ^ (hash >> 31);
+}
+
+/// Check whether two message identities are equal.
+static inline BOOL PNMessageCacheEntryIsEqual(const PNMessageCacheEntry *lhs, const PNMessageCacheEntry *rhs) {
+    return lhs->timetoken == rhs->timetoken && lhs->channelHash == rhs->channelHash &&
+           lhs->fingerprint == rhs->fingerprint;
+}
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNMessageDeduplicationCache ()
+
+
+#pragma mark - Properties
+
+/// Ring buffer with cached message identities.
+@property(assign, nonatomic) PNMessageCacheEntry *entries;
+
+/// Hash table with indices of cached message identities in ring buffer.
+@property(assign, nonatomic) int32_t *buckets;
+
+/// Hash table buckets index mask (number of buckets minus one).
+@property(assign, nonatomic) NSUInteger bucketsMask;
+
+/// Index of oldest entry in ring buffer.
+@property(assign, nonatomic) NSUInteger head;
+
+/// Whether entries has been added in non-decreasing timetoken order or not.
+///
+/// Ordered cache allows to drop newer messages by trimming ring buffer tail.
+@property(assign, nonatomic, getter = isOrdered) BOOL ordered;
+
+/// Maximum number of entries which can be stored in cache.
+@property(assign, nonatomic) NSUInteger capacity;
+
+/// Number of entries stored in cache.
+@property(assign, nonatomic) NSUInteger count;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize messages de-duplication cache.
+///
+/// - Parameter capacity: Maximum number of entries which can be stored in cache.
+/// - Returns: Initialized messages de-duplication cache.
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+
+#pragma mark - Storage
+
+/// Allocate storage for cache with specified capacity.
+///
+/// - Parameter capacity: Maximum number of entries which can be stored in cache.
+- (void)allocateStorageWithCapacity:(NSUInteger)capacity;
+
+/// Release allocated storage.
+- (void)releaseStorage;
+
+/// Store entry in ring buffer and index it in hash table.
+///
+/// - Parameter entry: Message identity which should be stored.
+- (void)appendEntry:(const PNMessageCacheEntry *)entry;
+
+/// Remove entry from hash table.
+///
+/// Backward shift deletion used to keep linear probing chains intact without tombstones.
+///
+/// - Parameter slot: Index of entry in ring buffer which should be removed from hash table.
+- (void)removeEntryAtSlotFromIndex:(NSUInteger)slot;
+
+/// Re-create cache storage with new capacity and re-add entries which pass filter.
+///
+/// - Parameters:
+///   - capacity: Maximum number of entries which can be stored in cache.
+///   - timetoken: Entries with same or newer timetoken will be dropped (pass `UINT64_MAX` to keep all).
+- (void)rebuildWithCapacity:(NSUInteger)capacity droppingMessagesNewerThan:(uint64_t)timetoken;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNMessageDeduplicationCache
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)cacheWithCapacity:(NSUInteger)capacity {
+    return [[self alloc] initWithCapacity:capacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    if ((self = [super init])) [self allocateStorageWithCapacity:capacity];
+
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    PNMessageDeduplicationCache *cache = [[[self class] allocWithZone:zone] initWithCapacity:self.capacity];
+
+    if (self.capacity > 0) {
+        memcpy(cache.entries, self.entries, sizeof(PNMessageCacheEntry) * self.capacity);
+        memcpy(cache.buckets, self.buckets, sizeof(int32_t) * (self.bucketsMask + 1));
+    }
+
+    cache.ordered = self.isOrdered;
+    cache.count = self.count;
+    cache.head = self.head;
+
+    return cache;
+}
+
+- (void)resizeToCapacity:(NSUInteger)capacity {
+    if (capacity != self.capacity) [self rebuildWithCapacity:capacity droppingMessagesNewerThan:UINT64_MAX];
+}
+
+- (void)dealloc {
+    [self releaseStorage];
+}
+
+
+#pragma mark - Storage
+
+- (BOOL)storeMessageWithTimetoken:(uint64_t)timetoken channel:(NSString *)channel fingerprint:(uint32_t)fingerprint {
+    if (self.capacity == 0) return YES;
+
+    PNMessageCacheEntry entry = { timetoken, PNMessageCacheChannelHash(channel), fingerprint };
+    NSUInteger bucket = (NSUInteger)PNMessageCacheEntryHash(&entry) & self.bucketsMask;
+    int32_t slot;
+
+    while ((slot = self.buckets[bucket]) != kPNEmptyBucket) {
+        if (PNMessageCacheEntryIsEqual(&self.entries[slot], &entry)) return NO;
+        bucket = (bucket + 1) & self.bucketsMask;
+    }
+
+    if (self.count == self.capacity) {
+        [self removeEntryAtSlotFromIndex:self.head];
+        self.head = (self.head + 1) % self.capacity;
+        self.count--;
+    }
+
+    [self appendEntry:&entry];
+
+    return YES;
+}
+
+- (void)removeMessagesNewerThan:(uint64_t)timetoken {
+    if (self.count == 0) return;
+
+    if (!self.isOrdered) {
+        [self rebuildWithCapacity:self.capacity droppingMessagesNewerThan:timetoken];
+        return;
+    }
+
+    // Entries sorted by timetoken, so newer messages can be dropped from the ring buffer tail.
+    while (self.count > 0) {
+        NSUInteger slot = (self.head + self.count - 1) % self.capacity;
+        if (self.entries[slot].timetoken < timetoken) break;
+
+        [self removeEntryAtSlotFromIndex:slot];
+        self.count--;
+    }
+}
+
+- (void)removeAllMessages {
+    if (self.capacity > 0) memset(self.buckets, 0xFF, sizeof(int32_t) * (self.bucketsMask + 1));
+
+    self.ordered = YES;
+    self.count = 0;
+    self.head = 0;
+}
+
+- (void)allocateStorageWithCapacity:(NSUInteger)capacity {
+    NSUInteger bucketsCount = 2;
+
+    capacity = MIN(capacity, (NSUInteger)INT32_MAX / 2);
+    while (bucketsCount < capacity * 2) bucketsCount <<= 1;
+
+    _entries = capacity > 0 ? calloc(capacity, sizeof(PNMessageCacheEntry)) : NULL;
+    _buckets = capacity > 0 ? malloc(sizeof(int32_t) * bucketsCount) : NULL;
+    _bucketsMask = bucketsCount - 1;
+    _capacity = capacity;
+
+    [self removeAllMessages];
+}
+
+- (void)releaseStorage {
+    if (_entries) free(_entries);
+    if (_buckets) free(_buckets);
+
+    _entries = NULL;
+    _buckets = NULL;
+}
+
+- (void)appendEntry:(const PNMessageCacheEntry *)entry {
+    NSUInteger slot = (self.head + self.count) % self.capacity;
+    NSUInteger bucket = (NSUInteger)PNMessageCacheEntryHash(entry) & self.bucketsMask;
+
+    if (self.count > 0) {
+        NSUInteger newestSlot = (self.head + self.count - 1) % self.capacity;
+        if (entry->timetoken < self.entries[newestSlot].timetoken) self.ordered = NO;
+    }
+
+    while (self.buckets[bucket] != kPNEmptyBucket) bucket = (bucket + 1) & self.bucketsMask;
+
+    self.entries[slot] = *entry;
+    self.buckets[bucket] = (int32_t)slot;
+    self.count++;
+}
+
+- (void)removeEntryAtSlotFromIndex:(NSUInteger)slot {
+    NSUInteger mask = self.bucketsMask;
+    NSUInteger bucket = (NSUInteger)PNMessageCacheEntryHash(&self.entries[slot]) & mask;
+    int32_t *buckets = self.buckets;
+
+    while (buckets[bucket] != (int32_t)slot) {
+        if (buckets[bucket] == kPNEmptyBucket) return;
+        bucket = (bucket + 1) & mask;
+    }
+
+    NSUInteger next = bucket;
+    while (YES) {
+        next = (next + 1) & mask;
+        if (buckets[next] == kPNEmptyBucket) break;
+
+        // Move entry into the freed bucket only if its home bucket isn't within (bucket, next] cyclic range.
+        NSUInteger home = (NSUInteger)PNMessageCacheEntryHash(&self.entries[buckets[next]]) & mask;
+        BOOL inRange = bucket <= next ? (home > bucket && home <= next) : (home > bucket || home <= next);
+
+        if (!inRange) {
+            buckets[bucket] = buckets[next];
+            bucket = next;
+        }
+    }
+
+    buckets[bucket] = kPNEmptyBucket;
+}
+
+- (void)rebuildWithCapacity:(NSUInteger)capacity droppingMessagesNewerThan:(uint64_t)timetoken {
+    NSUInteger oldCapacity = self.capacity;
+    PNMessageCacheEntry *oldEntries = self.entries;
+    NSUInteger oldCount = self.count;
+    NSUInteger oldHead = self.head;
+
+    if (oldCapacity == capacity) {
+        // Ring buffer storage will be re-used, so entries should be copied before reset.
+        oldEntries = oldCount > 0 ? malloc(sizeof(PNMessageCacheEntry) * oldCount) : NULL;
+
+        for (NSUInteger idx = 0; idx < oldCount; idx++) oldEntries[idx] = self.entries[(oldHead + idx) % oldCapacity];
+        oldCapacity = oldCount;
+        oldHead = 0;
+
+        [self removeAllMessages];
+    } else {
+        if (_buckets) free(_buckets);
+        _buckets = NULL;
+        _entries = NULL;
+
+        [self allocateStorageWithCapacity:capacity];
+    }
+
+    NSUInteger skipCount = 0;
+    if (timetoken == UINT64_MAX && oldCount > self.capacity) skipCount = oldCount - self.capacity;
+
+    for (NSUInteger idx = skipCount; idx < oldCount && self.capacity > 0; idx++) {
+        PNMessageCacheEntry *entry = &oldEntries[(oldHead + idx) % oldCapacity];
+        if (entry->timetoken >= timetoken) continue;
+
+        if (self.count == self.capacity) {
+            [self removeEntryAtSlotFromIndex:self.head];
+            self.head = (self.head + 1) % self.capacity;
+            self.count--;
+        }
+
+        [self appendEntry:entry];
+    }
+
+    if (oldEntries) free(oldEntries);
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,81 @@
+#import <Foundation/Foundation.h>
+#import "PNErrorStatus.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Types and structures
+
+/// Fetched page handler block.
+///
+/// - Parameters:
+///   - objects: List of objects from fetched page.
+///   - hasMore: Whether there is more pages which can be fetched or not.
+///   - status: Fetch request error (if any).
+typedef void(^PNPageStreamPageBlock)(NSArray * _Nullable objects, BOOL hasMore, PNErrorStatus * _Nullable status);
+
+/// Next page fetch block.
+///
+/// Block responsible for cursor management: each call should fetch page which follows previously fetched page.
+///
+/// - Parameter pageBlock: Block which should be called with fetched page.
+typedef void(^PNPageStreamFetchBlock)(PNPageStreamPageBlock pageBlock);
+
+/// Streamed objects batch handler block.
+///
+/// - Parameters:
+///   - objects: List of objects from fetched page.
+///   - stop: Pointer to the flag which can be set to `YES` to stop streaming.
+typedef void(^PNPageStreamBatchBlock)(NSArray *objects, BOOL *stop);
+
+/// Streaming completion handler block.
+///
+/// - Parameters:
+///   - count: Total number of objects which has been passed to the batch handler block.
+///   - status: Page fetch request error (if any).
+typedef void(^PNPageStreamCompletionBlock)(NSUInteger count, PNErrorStatus * _Nullable status);
+
+
+#pragma mark - Interface declaration
+
+/// Multi-page objects stream.
+///
+/// Stream fetch pages one by one and pass their objects to the batch handler block. Request for the next page sent
+/// as soon as the current page is handed to the batch handler block, so the network round-trip overlaps with the
+/// objects processing.
+///
+/// > Note: Stream holds at most two pages in memory: the one which is processed by the batch handler block and the
+/// one which has been prefetched. Next page won't be requested until the batch handler block completes processing of
+/// the current page.
+@interface PNPageStream : NSObject
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure multi-page objects stream.
+///
+/// - Parameters:
+///   - fetchBlock: Next page fetch block.
+///   - queue: Queue on which `batchBlock` and `block` should be called.
+///   - batchBlock: Streamed objects batch handler block.
+///   - block: Streaming completion handler block.
+/// - Returns: Configured and ready to use objects stream.
++ (instancetype)streamWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                       callbackQueue:(dispatch_queue_t)queue
+                          batchBlock:(PNPageStreamBatchBlock)batchBlock
+                     completionBlock:(nullable PNPageStreamCompletionBlock)block;
+
+
+#pragma mark - Streaming
+
+/// Start pages fetch.
+///
+/// > Note: Stream retains itself until `completionBlock` is called.
+- (void)start;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
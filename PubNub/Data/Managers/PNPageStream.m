@@ -0,0 +1,211 @@
+#import "PNPageStream.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// Multi-page objects stream private extension.
+@interface PNPageStream ()
+
+
+#pragma mark - Properties
+
+/// Queue which is used to serialize access to the stream state.
+@property(strong, nonatomic) dispatch_queue_t resourceAccessQueue;
+
+/// Queue on which `batchBlock` and `completionBlock` should be called.
+@property(strong, nonatomic) dispatch_queue_t callbackQueue;
+
+/// Streaming completion handler block.
+@property(copy, nullable, nonatomic) PNPageStreamCompletionBlock completionBlock;
+
+/// Streamed objects batch handler block.
+@property(copy, nonatomic) PNPageStreamBatchBlock batchBlock;
+
+/// Next page fetch block.
+@property(copy, nonatomic) PNPageStreamFetchBlock fetchBlock;
+
+/// Page which has been fetched while previous page has been processed by the batch handler block.
+@property(strong, nullable, nonatomic) NSArray *prefetchedPage;
+
+/// Page fetch request error.
+@property(strong, nullable, nonatomic) PNErrorStatus *status;
+
+/// Stream self-reference which keeps it alive until completion.
+@property(strong, nullable, nonatomic) PNPageStream *activeStream;
+
+/// Total number of objects which has been passed to the batch handler block.
+@property(assign, nonatomic) NSUInteger count;
+
+/// Whether there is more pages which can be fetched or not.
+@property(assign, nonatomic) BOOL hasMore;
+
+/// Whether next page fetch is in progress or not.
+@property(assign, nonatomic) BOOL fetching;
+
+/// Whether batch handler block is processing page or not.
+@property(assign, nonatomic) BOOL processing;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize multi-page objects stream.
+///
+/// - Parameters:
+///   - fetchBlock: Next page fetch block.
+///   - queue: Queue on which `batchBlock` and `block` should be called.
+///   - batchBlock: Streamed objects batch handler block.
+///   - block: Streaming completion handler block.
+/// - Returns: Initialized objects stream.
+- (instancetype)initWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                     callbackQueue:(dispatch_queue_t)queue
+                        batchBlock:(PNPageStreamBatchBlock)batchBlock
+                   completionBlock:(nullable PNPageStreamCompletionBlock)block;
+
+
+#pragma mark - Streaming
+
+/// Request next page.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)fetchNextPage;
+
+/// Handle fetched page.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+///
+/// - Parameters:
+///   - objects: List of objects from fetched page.
+///   - hasMore: Whether there is more pages which can be fetched or not.
+///   - status: Fetch request error (if any).
+- (void)handlePage:(nullable NSArray *)objects hasMore:(BOOL)hasMore status:(nullable PNErrorStatus *)status;
+
+/// Pass prefetched page to the batch handler block or complete streaming if there is nothing left to process.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)processNextPage;
+
+/// Complete streaming and release resources.
+///
+/// > Important: Method should be called on `resourceAccessQueue`.
+- (void)complete;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNPageStream
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)streamWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                       callbackQueue:(dispatch_queue_t)queue
+                          batchBlock:(PNPageStreamBatchBlock)batchBlock
+                     completionBlock:(PNPageStreamCompletionBlock)block {
+    return [[self alloc] initWithFetchBlock:fetchBlock callbackQueue:queue batchBlock:batchBlock completionBlock:block];
+}
+
+- (instancetype)initWithFetchBlock:(PNPageStreamFetchBlock)fetchBlock
+                     callbackQueue:(dispatch_queue_t)queue
+                        batchBlock:(PNPageStreamBatchBlock)batchBlock
+                   completionBlock:(PNPageStreamCompletionBlock)block {
+    if ((self = [super init])) {
+        _resourceAccessQueue = dispatch_queue_create("com.pubnub.page-stream", DISPATCH_QUEUE_SERIAL);
+        _completionBlock = [block copy];
+        _batchBlock = [batchBlock copy];
+        _fetchBlock = [fetchBlock copy];
+        _callbackQueue = queue;
+    }
+
+    return self;
+}
+
+
+#pragma mark - Streaming
+
+- (void)start {
+    dispatch_async(self.resourceAccessQueue, ^{
+        if (self.activeStream) return;
+
+        self.activeStream = self;
+        [self fetchNextPage];
+    });
+}
+
+- (void)fetchNextPage {
+    self.fetching = YES;
+
+    self.fetchBlock(^(NSArray *objects, BOOL hasMore, PNErrorStatus *status) {
+        dispatch_async(self.resourceAccessQueue, ^{
+            [self handlePage:objects hasMore:hasMore status:status];
+        });
+    });
+}
+
+- (void)handlePage:(NSArray *)objects hasMore:(BOOL)hasMore status:(PNErrorStatus *)status {
+    self.fetching = NO;
+    // Stream has been stopped while page has been fetched.
+    if (!self.activeStream) return;
+
+    self.prefetchedPage = objects.count ? objects : nil;
+    self.hasMore = !status && hasMore && objects.count > 0;
+    self.status = status;
+
+    if (!self.processing) [self processNextPage];
+}
+
+- (void)processNextPage {
+    NSArray *page = self.prefetchedPage;
+    if (!page) {
+        if (!self.fetching) [self complete];
+        return;
+    }
+
+    self.prefetchedPage = nil;
+    self.processing = YES;
+
+    // Request next page while current is processed by the batch handler block.
+    if (self.hasMore) [self fetchNextPage];
+
+    dispatch_async(self.callbackQueue, ^{
+        BOOL stop = NO;
+        self.batchBlock(page, &stop);
+
+        dispatch_async(self.resourceAccessQueue, ^{
+            self.count += page.count;
+            self.processing = NO;
+
+            if (stop) [self complete];
+            else [self processNextPage];
+        });
+    });
+}
+
+- (void)complete {
+    PNPageStreamCompletionBlock block = self.completionBlock;
+    PNErrorStatus *status = self.status;
+    NSUInteger count = self.count;
+
+    self.completionBlock = nil;
+    self.prefetchedPage = nil;
+    self.activeStream = nil;
+
+    if (block) {
+        dispatch_async(self.callbackQueue, ^{
+            block(count, status);
+        });
+    }
+}
+
+#pragma mark -
+
+
+@end
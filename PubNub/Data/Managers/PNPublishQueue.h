@@ -0,0 +1,92 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Types and structures
+
+/// Publish request send block.
+///
+/// - Parameter completion: Block which should be called when publish request processing completes.
+typedef void(^PNPublishQueueSendBlock)(dispatch_block_t completion);
+
+
+#pragma mark - Interface declaration
+
+/// Client-side publish requests queue.
+///
+/// Queue limits number of simultaneously sent publish requests and number of simultaneously sent publish requests to
+/// the same channel (``maximumInFlightRequestsPerChannel``). With default per-channel limit of `1` queue keeps
+/// per-channel publish order: publish to the channel won't be sent until the previous publish to the same channel
+/// completes. Publish requests to different channels are sent concurrently (up to ``maximumInFlightRequests``).
+///
+/// > Note: Queue doesn't accept new publish requests while ``maximumLength`` requests are waiting or being sent.
+@interface PNPublishQueue : NSObject
+
+
+#pragma mark - Properties
+
+/// Maximum number of simultaneously sent publish requests.
+@property(assign, nonatomic, readonly) NSUInteger maximumInFlightRequests;
+
+/// Maximum number of simultaneously sent publish requests to the same channel.
+///
+/// > Important: When more than `1`, publish requests to the same channel may be stored in different order.
+@property(assign, nonatomic, readonly) NSUInteger maximumInFlightRequestsPerChannel;
+
+/// Maximum number of publish requests which can be waiting or being sent.
+@property(assign, nonatomic, readonly) NSUInteger maximumLength;
+
+/// Number of publish requests which are waiting to be sent.
+@property(assign, nonatomic, readonly) NSUInteger depth;
+
+/// Number of publish requests which are being sent.
+@property(assign, nonatomic, readonly) NSUInteger inFlightCount;
+
+/// Average time (in seconds) between publish request enqueue and its completion.
+///
+/// Latency is exponentially weighted moving average, so recent publish requests affect it more.
+@property(assign, nonatomic, readonly) NSTimeInterval averageLatency;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure publish requests queue.
+///
+/// - Parameters:
+///   - count: Maximum number of simultaneously sent publish requests.
+///   - length: Maximum number of publish requests which can be waiting or being sent.
+/// - Returns: Configured and ready to use publish requests queue.
++ (instancetype)queueWithMaximumInFlightRequests:(NSUInteger)count maximumLength:(NSUInteger)length;
+
+/// Create and configure publish requests queue.
+///
+/// - Parameters:
+///   - count: Maximum number of simultaneously sent publish requests.
+///   - channelCount: Maximum number of simultaneously sent publish requests to the same channel.
+///   - length: Maximum number of publish requests which can be waiting or being sent.
+/// - Returns: Configured and ready to use publish requests queue.
++ (instancetype)queueWithMaximumInFlightRequests:(NSUInteger)count
+                                      perChannel:(NSUInteger)channelCount
+                                   maximumLength:(NSUInteger)length;
+
+
+#pragma mark - Publish
+
+/// Add publish request to the queue.
+///
+/// `block` will be called as soon as there is free slot for publish request and fewer than
+/// ``maximumInFlightRequestsPerChannel`` previously enqueued publish requests to the same `channel` are being sent.
+///
+/// - Parameters:
+///   - channel: Name of channel to which message will be published.
+///   - block: Publish request send block.
+/// - Returns: `NO` in case if queue is full and publish request has been rejected.
+- (BOOL)enqueueForChannel:(NSString *)channel withBlock:(PNPublishQueueSendBlock)block;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
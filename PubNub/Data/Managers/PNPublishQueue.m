@@ -0,0 +1,262 @@
+#import "PNPublishQueue.h"
+#import "PNLock.h"
+
+
+#pragma mark Constants
+
+/// Weight of the recent publish request latency in average latency.
+static double const kPNPublishQueueLatencyWeight = 0.1f;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interfaces declaration
+
+/// Enqueued publish request.
+@interface PNPublishQueueEntry : NSObject
+
+
+#pragma mark - Properties
+
+/// Publish request send block.
+@property(copy, nonatomic) PNPublishQueueSendBlock block;
+
+/// Name of channel to which message will be published.
+@property(copy, nonatomic) NSString *channel;
+
+/// Time when publish request has been added to the queue.
+@property(assign, nonatomic) CFAbsoluteTime enqueueTime;
+
+#pragma mark -
+
+
+@end
+
+
+/// Client-side publish requests queue private extension.
+@interface PNPublishQueue ()
+
+
+#pragma mark - Properties
+
+/// Map of channel names to the list of publish requests which are waiting to be sent.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSMutableArray<PNPublishQueueEntry *> *> *pending;
+
+/// Channels with waiting publish requests and free per-channel slots.
+///
+/// Channels stored in order in which they became ready, so requests to different channels are sent fairly.
+@property(strong, nonatomic) NSMutableOrderedSet<NSString *> *readyChannels;
+
+/// Channels for which publish requests are being sent (with number of requests in flight).
+@property(strong, nonatomic) NSCountedSet<NSString *> *activeChannels;
+
+/// Resources access lock.
+@property(strong, nonatomic) PNLock *lock;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize publish requests queue.
+///
+/// - Parameters:
+///   - count: Maximum number of simultaneously sent publish requests.
+///   - channelCount: Maximum number of simultaneously sent publish requests to the same channel.
+///   - length: Maximum number of publish requests which can be waiting or being sent.
+/// - Returns: Initialized publish requests queue.
+- (instancetype)initWithMaximumInFlightRequests:(NSUInteger)count
+                                     perChannel:(NSUInteger)channelCount
+                                  maximumLength:(NSUInteger)length;
+
+
+#pragma mark - Publish
+
+/// Send publish requests while there are free slots and channels with free per-channel slots.
+- (void)sendReadyRequests;
+
+/// Check whether publish request to the `channel` can be sent.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Parameter channel: Name of channel to which message will be published.
+/// - Returns: `YES` if `channel` has waiting publish requests and free per-channel slot.
+- (BOOL)isReadyChannel:(NSString *)channel;
+
+/// Take next publish request which can be sent.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Returns: Publish request which should be sent or `nil` if there is no free slots or ready channels.
+- (nullable PNPublishQueueEntry *)dequeueReadyRequest;
+
+
+#pragma mark - Handlers
+
+/// Handle publish request processing completion.
+///
+/// - Parameter entry: Enqueued publish request which has been completed.
+- (void)handleRequestCompletion:(PNPublishQueueEntry *)entry;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNPublishQueueEntry
+
+@end
+
+
+@implementation PNPublishQueue
+
+@synthesize averageLatency = _averageLatency;
+@synthesize inFlightCount = _inFlightCount;
+@synthesize depth = _depth;
+
+
+#pragma mark - Properties
+
+- (NSUInteger)depth {
+    __block NSUInteger depth = 0;
+    [self.lock syncReadAccessWithBlock:^{ depth = self->_depth; }];
+
+    return depth;
+}
+
+- (NSUInteger)inFlightCount {
+    __block NSUInteger inFlightCount = 0;
+    [self.lock syncReadAccessWithBlock:^{ inFlightCount = self->_inFlightCount; }];
+
+    return inFlightCount;
+}
+
+- (NSTimeInterval)averageLatency {
+    __block NSTimeInterval averageLatency = 0.f;
+    [self.lock syncReadAccessWithBlock:^{ averageLatency = self->_averageLatency; }];
+
+    return averageLatency;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)queueWithMaximumInFlightRequests:(NSUInteger)count maximumLength:(NSUInteger)length {
+    return [self queueWithMaximumInFlightRequests:count perChannel:1 maximumLength:length];
+}
+
++ (instancetype)queueWithMaximumInFlightRequests:(NSUInteger)count
+                                      perChannel:(NSUInteger)channelCount
+                                   maximumLength:(NSUInteger)length {
+    return [[self alloc] initWithMaximumInFlightRequests:count perChannel:channelCount maximumLength:length];
+}
+
+- (instancetype)initWithMaximumInFlightRequests:(NSUInteger)count
+                                     perChannel:(NSUInteger)channelCount
+                                  maximumLength:(NSUInteger)length {
+    if ((self = [super init])) {
+        _lock = [PNLock lockWithIsolationQueueName:@"publish-queue"
+                          subsystemQueueIdentifier:@"com.pubnub.core"
+                                           backend:PNLockUnfairBackend];
+        _maximumInFlightRequests = MAX(count, 1);
+        _maximumInFlightRequestsPerChannel = MIN(MAX(channelCount, 1), _maximumInFlightRequests);
+        _maximumLength = MAX(length, _maximumInFlightRequests);
+        _readyChannels = [NSMutableOrderedSet new];
+        _activeChannels = [NSCountedSet new];
+        _pending = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+
+#pragma mark - Publish
+
+- (BOOL)enqueueForChannel:(NSString *)channel withBlock:(PNPublishQueueSendBlock)block {
+    PNPublishQueueEntry *entry = [PNPublishQueueEntry new];
+    entry.enqueueTime = CFAbsoluteTimeGetCurrent();
+    entry.channel = channel;
+    entry.block = block;
+    __block BOOL enqueued = NO;
+
+    [self.lock syncWriteAccessWithBlock:^{
+        if (self->_depth + self->_inFlightCount >= self->_maximumLength) return;
+
+        NSMutableArray<PNPublishQueueEntry *> *entries = self->_pending[channel];
+        if (!entries) self->_pending[channel] = entries = [NSMutableArray new];
+        [entries addObject:entry];
+
+        if ([self isReadyChannel:channel]) [self->_readyChannels addObject:channel];
+        self->_depth++;
+        enqueued = YES;
+    }];
+
+    if (enqueued) [self sendReadyRequests];
+
+    return enqueued;
+}
+
+- (void)sendReadyRequests {
+    PNPublishQueueEntry *entry;
+
+    do {
+        __block PNPublishQueueEntry *readyEntry;
+        [self.lock syncWriteAccessWithBlock:^{ readyEntry = [self dequeueReadyRequest]; }];
+
+        // Send block called outside of lock because completion can be called synchronously.
+        if ((entry = readyEntry)) entry.block(^{ [self handleRequestCompletion:readyEntry]; });
+    } while (entry);
+}
+
+- (PNPublishQueueEntry *)dequeueReadyRequest {
+    if (_inFlightCount >= _maximumInFlightRequests || _readyChannels.count == 0) return nil;
+
+    NSString *channel = _readyChannels.firstObject;
+    NSMutableArray<PNPublishQueueEntry *> *entries = _pending[channel];
+    PNPublishQueueEntry *entry = entries.firstObject;
+
+    [_readyChannels removeObjectAtIndex:0];
+    [entries removeObjectAtIndex:0];
+    if (entries.count == 0) [_pending removeObjectForKey:channel];
+
+    [_activeChannels addObject:channel];
+    _inFlightCount++;
+    _depth--;
+
+    // Channel moved to the end, so other ready channels get their turn first.
+    if ([self isReadyChannel:channel]) [_readyChannels addObject:channel];
+
+    return entry;
+}
+
+- (BOOL)isReadyChannel:(NSString *)channel {
+    return _pending[channel] && [_activeChannels countForObject:channel] < _maximumInFlightRequestsPerChannel;
+}
+
+
+#pragma mark - Handlers
+
+- (void)handleRequestCompletion:(PNPublishQueueEntry *)entry {
+    NSTimeInterval latency = CFAbsoluteTimeGetCurrent() - entry.enqueueTime;
+
+    [self.lock syncWriteAccessWithBlock:^{
+        if (self->_averageLatency == 0.f) self->_averageLatency = latency;
+        else {
+            self->_averageLatency += (latency - self->_averageLatency) * kPNPublishQueueLatencyWeight;
+        }
+
+        [self->_activeChannels removeObject:entry.channel];
+        if ([self isReadyChannel:entry.channel]) [self->_readyChannels addObject:entry.channel];
+        self->_inFlightCount--;
+    }];
+
+    [self sendReadyRequests];
+}
+
+#pragma mark -
+
+
+@end
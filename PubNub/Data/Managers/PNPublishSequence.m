@@ -3,25 +3,19 @@
 #import "PNConfiguration.h"
 #import "PubNub+Core.h"
 #import "PNHelpers.h"
+#import <stdatomic.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Private interface declaration
 
-@interface PNPublishSequence ()
-
-
-#pragma mark - Information
-
-/// Queue which is used to serialize access to shared client state information.
-@property (nonatomic, strong) dispatch_queue_t resourceAccessQueue;
-
-/// Whether stored sequence number for `publishKey` has been changed or not.
-@property (nonatomic, assign) BOOL sequenceNumberChanged;
-
-/// Sequence number which has been used for recent message publish API usage.
-@property (nonatomic, assign) NSUInteger sequenceNumber;
+@interface PNPublishSequence () {
+    /// Sequence number which has been used for recent message publish API usage.
+    ///
+    /// Value updated with compare-and-swap, so concurrent publish calls never wait for each other.
+    _Atomic(NSUInteger) _sequenceNumber;
+}
 
 
 #pragma mark - Initialization and Configuration
@@ -54,48 +48,46 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Information
 
 - (NSUInteger)sequenceNumber {
-    __block NSUInteger sequenceNumber = 0;
-
-    dispatch_sync(self.resourceAccessQueue, ^{
-        sequenceNumber = self->_sequenceNumber;
-    });
-    
-    return sequenceNumber;
+    return atomic_load_explicit(&_sequenceNumber, memory_order_relaxed);
 }
 
 - (NSUInteger)nextSequenceNumber:(BOOL)shouldUpdateCurrent {
-    __block NSUInteger sequenceNumber = 0;
+    NSUInteger sequenceNumber = atomic_load_explicit(&_sequenceNumber, memory_order_relaxed);
+    NSUInteger nextSequenceNumber = sequenceNumber == NSUIntegerMax ? 1 : sequenceNumber + 1;
 
-    dispatch_block_t block = ^{
-        sequenceNumber = self->_sequenceNumber == NSUIntegerMax ? 1 : self->_sequenceNumber + 1;
+    if (!shouldUpdateCurrent) return nextSequenceNumber;
 
-        if (shouldUpdateCurrent) {
-            self->_sequenceNumber = sequenceNumber;
-            self->_sequenceNumberChanged = YES;
-        }
-    };
-
-    if (shouldUpdateCurrent) dispatch_barrier_sync(self.resourceAccessQueue, block);
-    else dispatch_sync(self.resourceAccessQueue, block);
+    // On failure `sequenceNumber` updated with value stored by concurrent publish call.
+    while (!atomic_compare_exchange_weak_explicit(&_sequenceNumber, &sequenceNumber, nextSequenceNumber,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+        nextSequenceNumber = sequenceNumber == NSUIntegerMax ? 1 : sequenceNumber + 1;
+    }
     
-    return sequenceNumber;
+    return nextSequenceNumber;
 }
 
 
 #pragma mark - Initialization and Configuration
 
 + (instancetype)sequenceForClient:(PubNub *)client {
-    PNPublishSequence *manager = nil;
     NSMutableDictionary<NSString *, PNPublishSequence *> *sequenceManagers = [self sequenceManagers];
+    NSString *publishKey = client.currentConfiguration.publishKey;
+    static pthread_mutex_t _sequenceManagersLock;
+    static dispatch_once_t onceToken;
+    __block PNPublishSequence *manager = nil;
+
+    dispatch_once(&onceToken, ^{
+        pthread_mutex_init(&_sequenceManagersLock, nil);
+    });
     
-    @synchronized (sequenceManagers) {
-        manager = sequenceManagers[client.currentConfiguration.publishKey];
+    pn_lock(&_sequenceManagersLock, ^{
+        manager = sequenceManagers[publishKey];
         
         if (!manager) {
             manager = [[self alloc] initForClient:client];
-            sequenceManagers[client.currentConfiguration.publishKey] = manager;
+            sequenceManagers[publishKey] = manager;
         }
-    }
+    });
     
     return manager;
 }
@@ -112,20 +104,13 @@ NS_ASSUME_NONNULL_END
 }
 
 - (instancetype)initForClient:(PubNub *)client {
-    if ((self = [super init])) {
-        const char *queueIdentifier = "com.pubnub.publish-sequence";
-        _resourceAccessQueue = dispatch_queue_create(queueIdentifier, DISPATCH_QUEUE_CONCURRENT);
-        dispatch_set_target_queue(_resourceAccessQueue, NULL);
-    }
+    if ((self = [super init])) atomic_init(&_sequenceNumber, 0);
     
     return self;
 }
 
 - (void)reset {
-    dispatch_barrier_async(self.resourceAccessQueue, ^{
-        self->_sequenceNumberChanged = YES;
-        self->_sequenceNumber = 0;
-    });
+    atomic_store_explicit(&_sequenceNumber, 0, memory_order_relaxed);
 }
 
 #pragma mark -
@@ -60,6 +60,24 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)addListener:(id <PNEventsListener>)listener;
 
+/**
+ * @brief Add observer which conform to \b PNEventsListener protocol and would like to receive
+ * updates only from specific channels and channel groups.
+ *
+ * @discussion Events routed to the listener using routing table, so listener won't be called for
+ * events from other channels. Channel name which ends with \c .* treated as wildcard pattern and
+ * match any channel with same prefix. Subscription status change events delivered to the listener
+ * as usual.
+ *
+ * @param listener Listener which would like to receive updates.
+ * @param channels List of channel names or wildcard patterns for which listener would like to
+ * receive updates.
+ * @param channelGroups List of channel group names for which listener would like to receive updates.
+ */
+- (void)addListener:(id <PNEventsListener>)listener
+        forChannels:(nullable NSArray<NSString *> *)channels
+      channelGroups:(nullable NSArray<NSString *> *)channelGroups;
+
 /**
  * @brief Remove listener from list for callback calls.
  *
@@ -86,6 +104,25 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyWithBlock:(dispatch_block_t)block;
 
+/**
+ * @brief Start collecting real-time events for listeners which implement batched callbacks.
+ *
+ * @discussion Events passed to \c -notify* methods after this call will be delivered to batched
+ * callbacks with single dispatch on \c callbackQueue when \c -flushEventsBatch will be called.
+ *
+ * @warning Method should be called within \b -notifyWithBlock: block to shift execution to private
+ * protected queue.
+ */
+- (void)beginEventsBatch;
+
+/**
+ * @brief Deliver collected real-time events to listeners which implement batched callbacks.
+ *
+ * @warning Method should be called within \b -notifyWithBlock: block to shift execution to private
+ * protected queue.
+ */
+- (void)flushEventsBatch;
+
 /**
  * @brief Notify all message listeners about new message.
  *
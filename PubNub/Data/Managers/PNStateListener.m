@@ -14,6 +14,24 @@
 #import "PNHelpers.h"
 
 
+#pragma mark Types and structures
+
+/**
+ * @brief Types of real-time events which can be delivered with batched callbacks.
+ *
+ * @discussion Batched callbacks called in order of types declaration.
+ */
+typedef NS_ENUM(NSUInteger, PNStateListenerEventType) {
+    PNStateListenerMessageEvent,
+    PNStateListenerSignalEvent,
+    PNStateListenerMessageActionEvent,
+    PNStateListenerPresenceEvent,
+    PNStateListenerObjectEvent,
+    PNStateListenerFileEvent,
+    PNStateListenerEventTypesCount
+};
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
@@ -90,6 +108,44 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) NSHashTable<id <PNEventsListener>> *stateListeners;
 
+/**
+ * @brief List of listeners which would like to receive real-time events with batched callbacks.
+ *
+ * @return Hash table with list of listeners which implement at least one batched callback.
+ */
+@property (nonatomic, strong) NSHashTable<id <PNEventsListener>> *batchListeners;
+
+/**
+ * @brief Real-time events which has been collected since \c -beginEventsBatch call.
+ *
+ * @return Map of listeners to the lists of events grouped by \c PNStateListenerEventType.
+ */
+@property (nonatomic, nullable, strong) NSMapTable<id <PNEventsListener>, NSMutableDictionary *> *eventsBatch;
+
+/**
+ * @brief Routing table for listeners which would like to receive updates only from specific
+ * channels.
+ *
+ * @return Map of channel names to the list of listeners.
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSHashTable<id <PNEventsListener>> *> *channelRoutes;
+
+/**
+ * @brief Routing table for listeners which would like to receive updates only from specific
+ * channel groups.
+ *
+ * @return Map of channel group names to the list of listeners.
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSHashTable<id <PNEventsListener>> *> *channelGroupRoutes;
+
+/**
+ * @brief Routing table for listeners which would like to receive updates only from channels
+ * which match wildcard pattern.
+ *
+ * @return Map of wildcard pattern prefixes (without \c * ) to the list of listeners.
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSHashTable<id <PNEventsListener>> *> *wildcardRoutes;
+
 /**
  * @brief Queue which is used to serialize access to shared listener information.
  */
@@ -118,6 +174,88 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)notifyStatusObservers:(PNStatus *)status;
 
 
+#pragma mark - Batching
+
+/**
+ * @brief Batched callback selector for events type.
+ *
+ * @param type One of \c PNStateListenerEventType fields.
+ *
+ * @return Selector which should be implemented by listener to receive batched events of \c type.
+ */
+- (SEL)batchSelectorForEventType:(PNStateListenerEventType)type;
+
+/**
+ * @brief Notify batched callback listeners about new event.
+ *
+ * @discussion Event will be added to the current batch (if \c -beginEventsBatch has been called)
+ * or delivered right away as single-element batch.
+ *
+ * @param event Event object which should be delivered to the listeners.
+ * @param type One of \c PNStateListenerEventType fields.
+ * @param data Real-time update which is used to route event to the listeners.
+ */
+- (void)notifyBatchListenersAboutEvent:(id)event
+                                ofType:(PNStateListenerEventType)type
+                              withData:(PNSubscribeEventData *)data;
+
+/**
+ * @brief Call listener's batched callbacks.
+ *
+ * @param events Lists of events grouped by \c PNStateListenerEventType.
+ * @param listener Listener which should receive batched events.
+ */
+- (void)deliverEvents:(NSDictionary<NSNumber *, NSArray *> *)events toListener:(id <PNEventsListener>)listener;
+
+
+#pragma mark - Routing
+
+/**
+ * @brief Add listener to the routing table.
+ *
+ * @param listener Listener which should be added to the routing table.
+ * @param names List of names under which listener should be stored.
+ * @param routes Routing table which should be modified.
+ */
+- (void)addListener:(id <PNEventsListener>)listener
+           forNames:(NSArray<NSString *> *)names
+           toRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes;
+
+/**
+ * @brief Remove listener from the routing table.
+ *
+ * @param listener Listener which should be removed from the routing table.
+ * @param routes Routing table which should be modified.
+ */
+- (void)removeListener:(id <PNEventsListener>)listener
+            fromRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes;
+
+/**
+ * @brief Merge routing tables.
+ *
+ * @param source Routing table from which listeners should be copied.
+ * @param routes Routing table which should be modified.
+ */
+- (void)mergeRoutes:(NSDictionary<NSString *, NSHashTable *> *)source
+         intoRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes;
+
+/**
+ * @brief Identify listeners which should be notified about real-time update.
+ *
+ * @param listeners List of listeners which would like to receive all updates of specific type.
+ * @param event Real-time update for which listeners should be identified.
+ * @param selector Callback selector which routed listener should implement to receive update.
+ * @param batchSelector Batched callback selector which routed listener shouldn't implement to
+ * receive update with \c selector.
+ *
+ * @return List of listeners which should be notified about \c event.
+ */
+- (NSArray<id <PNEventsListener>> *)listenersFrom:(NSHashTable<id <PNEventsListener>> *)listeners
+                                         forEvent:(PNSubscribeEventData *)event
+                                     withSelector:(SEL)selector
+                                    batchSelector:(nullable SEL)batchSelector;
+
+
 #pragma mark - Misc
 
 /**
@@ -158,6 +296,10 @@ NS_ASSUME_NONNULL_END
         _objectEventListeners = [NSHashTable weakObjectsHashTable];
         _fileEventListeners = [NSHashTable weakObjectsHashTable];
         _stateListeners = [NSHashTable weakObjectsHashTable];
+        _batchListeners = [NSHashTable weakObjectsHashTable];
+        _channelRoutes = [NSMutableDictionary new];
+        _channelGroupRoutes = [NSMutableDictionary new];
+        _wildcardRoutes = [NSMutableDictionary new];
         _resourceAccessQueue = dispatch_queue_create("com.pubnub.listener", DISPATCH_QUEUE_SERIAL);
     }
     
@@ -176,6 +318,16 @@ NS_ASSUME_NONNULL_END
     NSHashTable *objectEventListeners = [listener listenersCopyFrom:listener.objectEventListeners];
     NSHashTable *fileEventListeners = [listener listenersCopyFrom:listener.fileEventListeners];
     NSHashTable *stateListeners = [listener listenersCopyFrom:listener.stateListeners];
+    NSHashTable *batchListeners = [listener listenersCopyFrom:listener.batchListeners];
+    __block NSDictionary<NSString *, NSHashTable *> *channelRoutes = nil;
+    __block NSDictionary<NSString *, NSHashTable *> *channelGroupRoutes = nil;
+    __block NSDictionary<NSString *, NSHashTable *> *wildcardRoutes = nil;
+
+    dispatch_sync(listener.resourceAccessQueue, ^{
+        channelRoutes = [[NSDictionary alloc] initWithDictionary:listener.channelRoutes copyItems:YES];
+        channelGroupRoutes = [[NSDictionary alloc] initWithDictionary:listener.channelGroupRoutes copyItems:YES];
+        wildcardRoutes = [[NSDictionary alloc] initWithDictionary:listener.wildcardRoutes copyItems:YES];
+    });
     
     dispatch_async(self.resourceAccessQueue, ^{
         [self.messageListeners unionHashTable:messageListeners];
@@ -185,6 +337,10 @@ NS_ASSUME_NONNULL_END
         [self.objectEventListeners unionHashTable:objectEventListeners];
         [self.fileEventListeners unionHashTable:fileEventListeners];
         [self.stateListeners unionHashTable:stateListeners];
+        [self.batchListeners unionHashTable:batchListeners];
+        [self mergeRoutes:channelRoutes intoRoutes:self.channelRoutes];
+        [self mergeRoutes:channelGroupRoutes intoRoutes:self.channelGroupRoutes];
+        [self mergeRoutes:wildcardRoutes intoRoutes:self.wildcardRoutes];
     });
 }
 
@@ -193,27 +349,39 @@ NS_ASSUME_NONNULL_END
 
 - (void)addListener:(id <PNEventsListener>)listener {
     dispatch_async(self.resourceAccessQueue, ^{
-        if ([listener respondsToSelector:@selector(client:didReceiveMessage:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveMessages:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceiveMessage:)]) {
             [self.messageListeners addObject:listener];
         }
         
-        if ([listener respondsToSelector:@selector(client:didReceiveSignal:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveSignals:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceiveSignal:)]) {
             [self.signalListeners addObject:listener];
         }
         
-        if ([listener respondsToSelector:@selector(client:didReceiveMessageAction:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveMessageActions:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceiveMessageAction:)]) {
             [self.messageActionListeners addObject:listener];
         }
         
-        if ([listener respondsToSelector:@selector(client:didReceivePresenceEvent:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceivePresenceEvents:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceivePresenceEvent:)]) {
             [self.presenceEventListeners addObject:listener];
         }
         
-        if ([listener respondsToSelector:@selector(client:didReceiveObjectEvent:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveObjectEvents:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceiveObjectEvent:)]) {
             [self.objectEventListeners addObject:listener];
         }
         
-        if ([listener respondsToSelector:@selector(client:didReceiveFileEvent:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveFileEvents:)]) {
+            [self.batchListeners addObject:listener];
+        } else if ([listener respondsToSelector:@selector(client:didReceiveFileEvent:)]) {
             [self.fileEventListeners addObject:listener];
         }
         
@@ -223,8 +391,32 @@ NS_ASSUME_NONNULL_END
     });
 }
 
+- (void)addListener:(id <PNEventsListener>)listener
+        forChannels:(NSArray<NSString *> *)channels
+      channelGroups:(NSArray<NSString *> *)channelGroups {
+    NSMutableArray<NSString *> *patterns = [NSMutableArray new];
+    NSMutableArray<NSString *> *names = [NSMutableArray new];
+
+    for (NSString *channel in channels) {
+        if ([channel hasSuffix:@".*"]) [patterns addObject:[channel substringToIndex:channel.length - 1]];
+        else [names addObject:channel];
+    }
+
+    dispatch_async(self.resourceAccessQueue, ^{
+        // Routed listener still should receive subscription status change events.
+        if ([listener respondsToSelector:@selector(client:didReceiveStatus:)]) [self.stateListeners addObject:listener];
+
+        [self addListener:listener forNames:names toRoutes:self.channelRoutes];
+        [self addListener:listener forNames:channelGroups ?: @[] toRoutes:self.channelGroupRoutes];
+        [self addListener:listener forNames:patterns toRoutes:self.wildcardRoutes];
+    });
+}
+
 - (void)removeListener:(id <PNEventsListener>)listener {
     dispatch_async(self.resourceAccessQueue, ^{
+        [self removeListener:listener fromRoutes:self.channelRoutes];
+        [self removeListener:listener fromRoutes:self.channelGroupRoutes];
+        [self removeListener:listener fromRoutes:self.wildcardRoutes];
         [self.messageListeners removeObject:listener];
         [self.signalListeners removeObject:listener];
         [self.messageActionListeners removeObject:listener];
@@ -232,6 +424,7 @@ NS_ASSUME_NONNULL_END
         [self.objectEventListeners removeObject:listener];
         [self.fileEventListeners removeObject:listener];
         [self.stateListeners removeObject:listener];
+        [self.batchListeners removeObject:listener];
     });
 }
 
@@ -244,6 +437,10 @@ NS_ASSUME_NONNULL_END
         [self.objectEventListeners removeAllObjects];
         [self.fileEventListeners removeAllObjects];
         [self.stateListeners removeAllObjects];
+        [self.batchListeners removeAllObjects];
+        [self.channelRoutes removeAllObjects];
+        [self.channelGroupRoutes removeAllObjects];
+        [self.wildcardRoutes removeAllObjects];
     });
 }
 
@@ -254,14 +451,38 @@ NS_ASSUME_NONNULL_END
     dispatch_async(self.resourceAccessQueue, block);
 }
 
+- (void)beginEventsBatch {
+    NSPointerFunctionsOptions keyOptions = NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality;
+    self.eventsBatch = [NSMapTable mapTableWithKeyOptions:keyOptions valueOptions:NSPointerFunctionsStrongMemory];
+}
+
+- (void)flushEventsBatch {
+    NSMapTable<id <PNEventsListener>, NSMutableDictionary *> *batch = self.eventsBatch;
+    self.eventsBatch = nil;
+
+    if (batch.count == 0) return;
+
+    pn_dispatch_async(self.client.callbackQueue, ^{
+        for (id <PNEventsListener> listener in batch) {
+            [self deliverEvents:[batch objectForKey:listener] toListener:listener];
+        }
+    });
+}
+
 - (void)notifyMessage:(PNMessageResult *)message {
-    NSArray<id <PNEventsListener>> *listeners = self.messageListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.messageListeners
+                                                           forEvent:message.data
+                                                       withSelector:@selector(client:didReceiveMessage:)
+                                                      batchSelector:@selector(client:didReceiveMessages:)];
+    [self notifyBatchListenersAboutEvent:message ofType:PNStateListenerMessageEvent withData:message.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[message.data dictionaryRepresentation]
-                                              details:@"Received message:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [message.data dictionaryRepresentation];
+        } details:@"Received message:" operation:PNSubscribeLogMessageOperation];
     }];
+
+    if (listeners.count == 0) return;
     
     /**
      * Silence static analyzer warnings.
@@ -280,14 +501,20 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)notifySignal:(PNSignalResult *)signal {
-    NSArray<id <PNEventsListener>> *listeners = self.signalListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.signalListeners
+                                                           forEvent:signal.data
+                                                       withSelector:@selector(client:didReceiveSignal:)
+                                                      batchSelector:@selector(client:didReceiveSignals:)];
+    [self notifyBatchListenersAboutEvent:signal ofType:PNStateListenerSignalEvent withData:signal.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[signal.data dictionaryRepresentation]
-                                              details:@"Received signal:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [signal.data dictionaryRepresentation];
+        } details:@"Received signal:" operation:PNSubscribeLogMessageOperation];
     }];
 
+    if (listeners.count == 0) return;
+
     pn_dispatch_async(self.client.callbackQueue, ^{
         for (id <PNEventsListener> listener in listeners) {
             [listener client:self.client didReceiveSignal:signal];
@@ -296,14 +523,20 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)notifyMessageAction:(PNMessageActionResult *)action {
-    NSArray<id <PNEventsListener>> *listeners = self.messageActionListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.messageActionListeners
+                                                           forEvent:action.data
+                                                       withSelector:@selector(client:didReceiveMessageAction:)
+                                                      batchSelector:@selector(client:didReceiveMessageActions:)];
+    [self notifyBatchListenersAboutEvent:action ofType:PNStateListenerMessageActionEvent withData:action.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[action.data dictionaryRepresentation]
-                                              details:@"Received message action event:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [action.data dictionaryRepresentation];
+        } details:@"Received message action event:" operation:PNSubscribeLogMessageOperation];
     }];
 
+    if (listeners.count == 0) return;
+
     pn_dispatch_async(self.client.callbackQueue, ^{
         for (id <PNEventsListener> listener in listeners) {
             [listener client:self.client didReceiveMessageAction:action];
@@ -312,14 +545,20 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)notifyPresenceEvent:(PNPresenceEventResult *)event {
-    NSArray<id <PNEventsListener>> *listeners = self.presenceEventListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.presenceEventListeners
+                                                           forEvent:event.data
+                                                       withSelector:@selector(client:didReceivePresenceEvent:)
+                                                      batchSelector:@selector(client:didReceivePresenceEvents:)];
+    [self notifyBatchListenersAboutEvent:event ofType:PNStateListenerPresenceEvent withData:event.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[event.data dictionaryRepresentation]
-                                              details:@"Received presence event:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [event.data dictionaryRepresentation];
+        } details:@"Received presence event:" operation:PNSubscribeLogMessageOperation];
     }];
 
+    if (listeners.count == 0) return;
+
     pn_dispatch_async(self.client.callbackQueue, ^{
         for (id <PNEventsListener> listener in listeners) {
             [listener client:self.client didReceivePresenceEvent:event];
@@ -328,14 +567,20 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)notifyObjectEvent:(PNObjectEventResult *)event {
-    NSArray<id <PNEventsListener>> *listeners = self.objectEventListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.objectEventListeners
+                                                           forEvent:event.data
+                                                       withSelector:@selector(client:didReceiveObjectEvent:)
+                                                      batchSelector:@selector(client:didReceiveObjectEvents:)];
+    [self notifyBatchListenersAboutEvent:event ofType:PNStateListenerObjectEvent withData:event.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[event.data dictionaryRepresentation]
-                                              details:@"Received app context event:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [event.data dictionaryRepresentation];
+        } details:@"Received app context event:" operation:PNSubscribeLogMessageOperation];
     }];
 
+    if (listeners.count == 0) return;
+
     pn_dispatch_async(self.client.callbackQueue, ^{
         for (id <PNEventsListener> listener in listeners) {
             [listener client:self.client didReceiveObjectEvent:event];
@@ -344,14 +589,20 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)notifyFileEvent:(PNFileEventResult *)event {
-    NSArray<id <PNEventsListener>> *listeners = self.fileEventListeners.allObjects;
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.fileEventListeners
+                                                           forEvent:event.data
+                                                       withSelector:@selector(client:didReceiveFileEvent:)
+                                                      batchSelector:@selector(client:didReceiveFileEvents:)];
+    [self notifyBatchListenersAboutEvent:event ofType:PNStateListenerFileEvent withData:event.data];
     
     [self.client.logger debugWithLocation:@"PNStateListener" andMessageFactory:^PNLogEntry *{
-        return [PNDictionaryLogEntry entryWithMessage:[event.data dictionaryRepresentation]
-                                              details:@"Received file share event:"
-                                            operation:PNSubscribeLogMessageOperation];
+        return [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+            return [event.data dictionaryRepresentation];
+        } details:@"Received file share event:" operation:PNSubscribeLogMessageOperation];
     }];
 
+    if (listeners.count == 0) return;
+
     pn_dispatch_async(self.client.callbackQueue, ^{
         for (id <PNEventsListener> listener in listeners) {
             [listener client:self.client didReceiveFileEvent:event];
@@ -381,6 +632,135 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Batching
+
+- (SEL)batchSelectorForEventType:(PNStateListenerEventType)type {
+    switch (type) {
+        case PNStateListenerMessageEvent: return @selector(client:didReceiveMessages:);
+        case PNStateListenerSignalEvent: return @selector(client:didReceiveSignals:);
+        case PNStateListenerMessageActionEvent: return @selector(client:didReceiveMessageActions:);
+        case PNStateListenerPresenceEvent: return @selector(client:didReceivePresenceEvents:);
+        case PNStateListenerObjectEvent: return @selector(client:didReceiveObjectEvents:);
+        default: return @selector(client:didReceiveFileEvents:);
+    }
+}
+
+- (void)notifyBatchListenersAboutEvent:(id)event
+                                ofType:(PNStateListenerEventType)type
+                              withData:(PNSubscribeEventData *)data {
+    SEL selector = [self batchSelectorForEventType:type];
+    NSArray<id <PNEventsListener>> *listeners = [self listenersFrom:self.batchListeners
+                                                           forEvent:data
+                                                       withSelector:selector
+                                                      batchSelector:NULL];
+    NSMutableArray<id <PNEventsListener>> *receivers = self.eventsBatch ? nil : [NSMutableArray new];
+
+    for (id <PNEventsListener> listener in listeners) {
+        if (![listener respondsToSelector:selector]) continue;
+        if (receivers) {
+            [receivers addObject:listener];
+            continue;
+        }
+
+        NSMutableDictionary<NSNumber *, NSMutableArray *> *events = [self.eventsBatch objectForKey:listener];
+        if (!events) [self.eventsBatch setObject:(events = [NSMutableDictionary new]) forKey:listener];
+        if (!events[@(type)]) events[@(type)] = [NSMutableArray new];
+        [events[@(type)] addObject:event];
+    }
+
+    if (receivers.count == 0) return;
+
+    // Event received outside of batch and should be delivered right away.
+    pn_dispatch_async(self.client.callbackQueue, ^{
+        for (id <PNEventsListener> listener in receivers) {
+            [self deliverEvents:@{ @(type): @[event] } toListener:listener];
+        }
+    });
+}
+
+- (void)deliverEvents:(NSDictionary<NSNumber *, NSArray *> *)events toListener:(id <PNEventsListener>)listener {
+    PubNub *client = self.client;
+
+    for (PNStateListenerEventType type = 0; type < PNStateListenerEventTypesCount; type++) {
+        NSArray *typeEvents = events[@(type)];
+        if (!typeEvents) continue;
+
+        switch (type) {
+            case PNStateListenerMessageEvent: [listener client:client didReceiveMessages:typeEvents]; break;
+            case PNStateListenerSignalEvent: [listener client:client didReceiveSignals:typeEvents]; break;
+            case PNStateListenerMessageActionEvent: [listener client:client didReceiveMessageActions:typeEvents]; break;
+            case PNStateListenerPresenceEvent: [listener client:client didReceivePresenceEvents:typeEvents]; break;
+            case PNStateListenerObjectEvent: [listener client:client didReceiveObjectEvents:typeEvents]; break;
+            default: [listener client:client didReceiveFileEvents:typeEvents]; break;
+        }
+    }
+}
+
+
+#pragma mark - Routing
+
+- (void)addListener:(id <PNEventsListener>)listener
+           forNames:(NSArray<NSString *> *)names
+           toRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes {
+    for (NSString *name in names) {
+        NSHashTable *listeners = routes[name];
+        if (!listeners) routes[name] = listeners = [NSHashTable weakObjectsHashTable];
+        [listeners addObject:listener];
+    }
+}
+
+- (void)removeListener:(id <PNEventsListener>)listener
+            fromRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes {
+    NSMutableArray<NSString *> *emptyRoutes = [NSMutableArray new];
+
+    [routes enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSHashTable *listeners, BOOL *stop) {
+        [listeners removeObject:listener];
+        if (listeners.allObjects.count == 0) [emptyRoutes addObject:name];
+    }];
+
+    [routes removeObjectsForKeys:emptyRoutes];
+}
+
+- (void)mergeRoutes:(NSDictionary<NSString *, NSHashTable *> *)source
+         intoRoutes:(NSMutableDictionary<NSString *, NSHashTable *> *)routes {
+    [source enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSHashTable *listeners, BOOL *stop) {
+        if (routes[name]) [routes[name] unionHashTable:listeners];
+        else routes[name] = listeners;
+    }];
+}
+
+- (NSArray<id <PNEventsListener>> *)listenersFrom:(NSHashTable<id <PNEventsListener>> *)listeners
+                                         forEvent:(PNSubscribeEventData *)event
+                                     withSelector:(SEL)selector
+                                    batchSelector:(SEL)batchSelector {
+    if (self.channelRoutes.count == 0 && self.channelGroupRoutes.count == 0 && self.wildcardRoutes.count == 0) {
+        return listeners.allObjects;
+    }
+
+    NSMutableArray<id <PNEventsListener>> *receivers = [listeners.allObjects mutableCopy];
+    NSHashTable<id <PNEventsListener>> *routed = [NSHashTable weakObjectsHashTable];
+    NSString *subscription = event.subscription;
+    NSString *channel = event.channel;
+
+    if (channel && self.channelRoutes[channel]) [routed unionHashTable:self.channelRoutes[channel]];
+    if (subscription && self.channelGroupRoutes[subscription]) {
+        [routed unionHashTable:self.channelGroupRoutes[subscription]];
+    }
+
+    [self.wildcardRoutes enumerateKeysAndObjectsUsingBlock:^(NSString *prefix, NSHashTable *matched, BOOL *stop) {
+        if ([channel hasPrefix:prefix]) [routed unionHashTable:matched];
+    }];
+
+    for (id <PNEventsListener> listener in routed) {
+        if (![listener respondsToSelector:selector] || [listeners containsObject:listener]) continue;
+        if (batchSelector && [listener respondsToSelector:batchSelector]) continue;
+        [receivers addObject:listener];
+    }
+
+    return receivers;
+}
+
+
 #pragma mark - Misc
 
 - (NSHashTable *)listenersCopyFrom:(NSHashTable *)listeners {
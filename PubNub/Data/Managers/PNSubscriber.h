@@ -38,6 +38,12 @@ typedef void(^PNSubscriberCompletionBlock)(PNSubscribeStatus * _Nullable status)
 /// List of presence channels for which client observing for presence events.
 - (NSArray<NSString *> *)presenceChannels;
 
+/// Version of the subscription objects list.
+///
+/// Value changes each time when channels or channel groups are added or removed, so dependent information (like list
+/// of objects for heartbeat) can be rebuilt only when required.
+@property(assign, readonly) NSUInteger objectsVersion;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -1,5 +1,6 @@
 #import "PNSubscriber.h"
 #import <PubNub/PNLock.h>
+#import "PNMessageDeduplicationCache.h"
 #import "PNSubscribeMessageEventData+Private.h"
 #import "PNSubscribeFileEventData+Private.h"
 #import "PNPresenceLeaveRequest+Private.h"
@@ -20,6 +21,7 @@
 #import "PubNub+Files.h"
 #import <objc/runtime.h>
 #import "PNHelpers.h"
+#import <stdatomic.h>
 
 
 #pragma mark Structures
@@ -55,19 +57,30 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Protected interface declaration
 
-@interface PNSubscriber ()
+@interface PNSubscriber () {
+    /// Storage for time token which is used for current subscribe loop iteration.
+    ///
+    /// Stored as scalar, so it can be read without waiting for pending subscriber `lock` writers.
+    _Atomic(unsigned long long) _currentTimeToken;
 
+    /// Storage for time token which has been used for previous subscribe loop iteration.
+    _Atomic(unsigned long long) _lastTimeToken;
 
-#pragma mark - Information
+    /// Storage for current subscriber state.
+    _Atomic(PNSubscriberState) _currentState;
 
-/// Dictionary which is used in messages 'de-dupe' logic to prevent same messages or presence events delivering to
-/// objects event listeners.
-@property(strong, nonatomic) NSMutableDictionary<NSString *, NSMutableArray<NSDictionary *> *> *cachedObjects;
+    /// Storage for subscribe cycle generation counter.
+    _Atomic(NSUInteger) _subscribeCycleGeneration;
+
+    /// Storage for version of the subscription objects list.
+    _Atomic(NSUInteger) _objectsVersion;
+}
 
-/// List of cached object identifiers.
-///
-/// Array used every time when maximum cached objects count has been reached to clean up cache from older entries.
-@property(strong, nonatomic) NSMutableArray<NSString *> *cachedObjectIdentifiers;
+
+#pragma mark - Information
+
+/// Cache which is used in messages 'de-dupe' logic to prevent same messages delivering to objects event listeners.
+@property(strong, nonatomic) PNMessageDeduplicationCache *messagesCache;
 
 /// Actual storage for list of presence channels on which client subscribed at this moment and listen for presence
 /// updates.
@@ -97,13 +110,7 @@ NS_ASSUME_NONNULL_BEGIN
 @property(copy, nonatomic, readonly) NSNumber *lastTimeTokenRegion;
 
 /// Current subscriber state.
-@property(assign, nonatomic) PNSubscriberState currentState;
-
-/// Generation counter incremented on each new initial subscribe cycle.
-///
-/// Used to detect and discard stale continuation calls that were dispatched asynchronously before a new subscribe
-/// cycle started, preventing duplicate subscribe loops.
-@property(assign, nonatomic) NSUInteger subscribeCycleGeneration;
+@property(assign) PNSubscriberState currentState;
 
 /// Time token which is used for current subscribe loop iteration.
 ///
@@ -310,6 +317,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /// Store to cache passed `object`.
 ///
+/// Oldest cached object will be evicted if cache reached its maximum size.
+///
 /// This method used by `de-dupe` logic to identify unique objects about which object listeners should be notified.
 ///
 /// > Warning: Method should be called within resource access queue to prevent race of conditions.
@@ -320,11 +329,6 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Returns: `YES` in case if object successfully stored in cache and object listeners should be notified about it.
 - (BOOL)cacheObjectIfPossible:(PNSubscribeMessageEventData *)object withMaximumCacheSize:(NSUInteger)size;
 
-/// Shrink messages cache size to specified size if required.
-///
-/// - Parameter maximumCacheSize: Messages cache maximum size.
-- (void)cleanUpCachedObjectsIfRequired:(NSUInteger)maximumCacheSize;
-
 /// Append subscriber information to status object.
 ///
 /// - Parameter status: Reference on status object which should be updated with subscriber information.
@@ -345,8 +349,6 @@ NS_ASSUME_NONNULL_END
 @synthesize currentTimeTokenRegion = _currentTimeTokenRegion;
 @synthesize lastTimeTokenRegion = _lastTimeTokenRegion;
 @synthesize overrideTimeToken = _overrideTimeToken;
-@synthesize currentTimeToken = _currentTimeToken;
-@synthesize lastTimeToken = _lastTimeToken;
 
 
 #pragma mark - State Information and Manipulation
@@ -378,6 +380,7 @@ NS_ASSUME_NONNULL_END
         }
         
         [self.channelsSet addObjectsFromArray:channelsOnly];
+        atomic_fetch_add_explicit(&self->_objectsVersion, 1, memory_order_release);
     }];
 }
 
@@ -386,6 +389,7 @@ NS_ASSUME_NONNULL_END
         NSSet *channelsSet = [NSSet setWithArray:channels];
         [self.presenceChannelsSet minusSet:channelsSet];
         [self.channelsSet minusSet:channelsSet];
+        atomic_fetch_add_explicit(&self->_objectsVersion, 1, memory_order_release);
     }];
 }
 
@@ -402,12 +406,14 @@ NS_ASSUME_NONNULL_END
 - (void)addChannelGroups:(NSArray<NSString *> *)groups {
     [self.lock writeAccessWithBlock:^{
         [self.channelGroupsSet addObjectsFromArray:groups];
+        atomic_fetch_add_explicit(&self->_objectsVersion, 1, memory_order_release);
     }];
 }
 
 - (void)removeChannelGroups:(NSArray<NSString *> *)groups {
     [self.lock writeAccessWithBlock:^{
         [self.channelGroupsSet minusSet:[NSSet setWithArray:groups]];
+        atomic_fetch_add_explicit(&self->_objectsVersion, 1, memory_order_release);
     }];
 }
 
@@ -433,36 +439,32 @@ NS_ASSUME_NONNULL_END
     }];
 }
 
-- (NSNumber *)currentTimeToken {
-    __block NSNumber *currentTimeToken = nil;
-    
-    [self.lock readAccessWithBlock:^{
-        currentTimeToken = self->_currentTimeToken;
-    }];
+- (NSUInteger)objectsVersion {
+    return atomic_load_explicit(&_objectsVersion, memory_order_acquire);
+}
 
-    return currentTimeToken;
+- (PNSubscriberState)currentState {
+    return atomic_load_explicit(&_currentState, memory_order_acquire);
 }
 
-- (void)setCurrentTimeToken:(NSNumber *)currentTimeToken {
-    [self.lock writeAccessWithBlock:^{
-        self->_currentTimeToken = currentTimeToken;
-    }];
+- (void)setCurrentState:(PNSubscriberState)currentState {
+    atomic_store_explicit(&_currentState, currentState, memory_order_release);
 }
 
-- (NSNumber *)lastTimeToken {
-    __block NSNumber *lastTimeToken = nil;
+- (NSNumber *)currentTimeToken {
+    return @(atomic_load_explicit(&_currentTimeToken, memory_order_relaxed));
+}
 
-    [self.lock readAccessWithBlock:^{
-        lastTimeToken = self->_lastTimeToken;
-    }];
+- (void)setCurrentTimeToken:(NSNumber *)currentTimeToken {
+    atomic_store_explicit(&_currentTimeToken, currentTimeToken.unsignedLongLongValue, memory_order_relaxed);
+}
 
-    return lastTimeToken;
+- (NSNumber *)lastTimeToken {
+    return @(atomic_load_explicit(&_lastTimeToken, memory_order_relaxed));
 }
 
 - (void)setLastTimeToken:(NSNumber *)lastTimeToken {
-    [self.lock writeAccessWithBlock:^{
-        self->_lastTimeToken = lastTimeToken;
-    }];
+    atomic_store_explicit(&_lastTimeToken, lastTimeToken.unsignedLongLongValue, memory_order_relaxed);
 }
 
 - (NSNumber *)overrideTimeToken {
@@ -520,7 +522,7 @@ NS_ASSUME_NONNULL_END
         // Compose status object to report state change to listeners.
         PNStatusCategory category = PNUnknownCategory;
         PNSubscriberState targetState = state;
-        PNSubscriberState currentState = self->_currentState;
+        PNSubscriberState currentState = atomic_load_explicit(&self->_currentState, memory_order_acquire);
         BOOL shouldHandleTransition = NO;
         
         if (targetState == PNConnectedSubscriberState) {
@@ -580,7 +582,7 @@ NS_ASSUME_NONNULL_END
         
         // Check whether allowed state transition has been issued or not.
         if (shouldHandleTransition) {
-            self->_currentState = targetState;
+            atomic_store_explicit(&self->_currentState, targetState, memory_order_release);
 
             /**
              * Build status object in case if update has been called as transition between two different states.
@@ -619,11 +621,11 @@ NS_ASSUME_NONNULL_END
         _channelsSet = [NSMutableSet new];
         _channelGroupsSet = [NSMutableSet new];
         _presenceChannelsSet = [NSMutableSet new];
-        _cachedObjectIdentifiers = [NSMutableArray new];
-        _cachedObjects = [NSMutableDictionary new];
-        _currentTimeToken = @0;
-        _lastTimeToken = @0;
-        _lock = [PNLock lockWithIsolationQueueName:@"subscriber" subsystemQueueIdentifier:@"com.pubnub.subscriber"];
+        _messagesCache = [PNMessageDeduplicationCache cacheWithCapacity:client.configuration.maximumMessagesCacheSize];
+        // Subscriber lock guards short, read-heavy critical sections which never call back into subscriber.
+        _lock = [PNLock lockWithIsolationQueueName:@"subscriber"
+                          subsystemQueueIdentifier:@"com.pubnub.subscriber"
+                                           backend:PNLockReadWriteBackend];
     }
     
     return self;
@@ -633,18 +635,18 @@ NS_ASSUME_NONNULL_END
     _presenceChannelsSet = [subscriber.presenceChannelsSet mutableCopy];
     _channelGroupsSet = [subscriber.channelGroupsSet mutableCopy];
     _channelsSet = [subscriber.channelsSet mutableCopy];
+    atomic_fetch_add_explicit(&_objectsVersion, 1, memory_order_release);
     
     if (_channelsSet.count || _channelGroupsSet.count || _presenceChannelsSet.count) {
-        if (subscriber.currentState != PNInitializedSubscriberState) _currentState = PNDisconnectedSubscriberState;
-        else _currentState = PNInitializedSubscriberState;
+        if (subscriber.currentState != PNInitializedSubscriberState) self.currentState = PNDisconnectedSubscriberState;
+        else self.currentState = PNInitializedSubscriberState;
     }
     
-    _cachedObjects = [subscriber.cachedObjects mutableCopy];
-    _cachedObjectIdentifiers = [subscriber.cachedObjectIdentifiers mutableCopy];
+    _messagesCache = [subscriber.messagesCache copy];
     _currentTimeTokenRegion = subscriber.currentTimeTokenRegion;
     _lastTimeTokenRegion = subscriber.lastTimeTokenRegion;
-    _currentTimeToken = subscriber.currentTimeToken;
-    _lastTimeToken = subscriber.lastTimeToken;
+    self.currentTimeToken = subscriber.currentTimeToken;
+    self.lastTimeToken = subscriber.lastTimeToken;
 }
 
 
@@ -698,11 +700,14 @@ NS_ASSUME_NONNULL_END
         self.overrideTimeToken = timeToken;
 
         if (initialSubscribe) {
-            [self.lock writeAccessWithBlock:^{
-                self->_subscribeCycleGeneration++;
-
-                if (self->_currentTimeToken && [self->_currentTimeToken compare:@0] != NSOrderedSame) {
-                    self->_lastTimeToken = self->_currentTimeToken;
+            // Bumped before lock, so continuations from previous cycle are discarded as soon as possible.
+            atomic_fetch_add_explicit(&self->_subscribeCycleGeneration, 1, memory_order_acq_rel);
+
+            [self.lock syncWriteAccessWithBlock:^{
+                unsigned long long currentTimeToken = atomic_load_explicit(&self->_currentTimeToken,
+                                                                           memory_order_relaxed);
+                if (currentTimeToken != 0) {
+                    atomic_store_explicit(&self->_lastTimeToken, currentTimeToken, memory_order_relaxed);
                 }
                 
                 if (self->_currentTimeTokenRegion &&
@@ -712,7 +717,7 @@ NS_ASSUME_NONNULL_END
                     self->_lastTimeTokenRegion = self->_currentTimeTokenRegion;
                 }
                 
-                self->_currentTimeToken = @0;
+                atomic_store_explicit(&self->_currentTimeToken, 0, memory_order_relaxed);
                 self->_currentTimeTokenRegion = @(-1);
             }];
         }
@@ -745,9 +750,9 @@ NS_ASSUME_NONNULL_END
                                                 category:PNDisconnectedCategory
                                                 response:nil];
         
-        [self.lock writeAccessWithBlock:^{
-            self->_lastTimeToken = @0;
-            self->_currentTimeToken = @0;
+        [self.lock syncWriteAccessWithBlock:^{
+            atomic_store_explicit(&self->_lastTimeToken, 0, memory_order_relaxed);
+            atomic_store_explicit(&self->_currentTimeToken, 0, memory_order_relaxed);
             self->_lastTimeTokenRegion = @(-1);
             self->_currentTimeTokenRegion = @(-1);
             self->_overrideTimeToken = nil;
@@ -776,10 +781,7 @@ NS_ASSUME_NONNULL_END
 
 - (void)continueSubscriptionCycleIfRequiredRestoringSubscription:(BOOL)restoring
                                                       completion:(PNSubscriberCompletionBlock)block {
-    __block BOOL isInitialSubscribe;
-    [self.lock readAccessWithBlock:^{
-        isInitialSubscribe = restoring && self.currentState == PNInitializedSubscriberState;
-    }];
+    BOOL isInitialSubscribe = restoring && self.currentState == PNInitializedSubscriberState;
 
     [self subscribe:isInitialSubscribe usingTimeToken:nil withState:nil queryParameters:nil completion:block];
 }
@@ -867,9 +869,9 @@ NS_ASSUME_NONNULL_END
 
     NSSet *subscriptionObjects = [NSSet setWithArray:[self allObjects]];
     if (subscriptionObjects.count == 0) {
-        [self.lock writeAccessWithBlock:^{
-            self->_lastTimeToken = @0;
-            self->_currentTimeToken = @0;
+        [self.lock syncWriteAccessWithBlock:^{
+            atomic_store_explicit(&self->_lastTimeToken, 0, memory_order_relaxed);
+            atomic_store_explicit(&self->_currentTimeToken, 0, memory_order_relaxed);
             self->_lastTimeTokenRegion = @(-1);
             self->_currentTimeTokenRegion = @(-1);
             self->_overrideTimeToken = nil;
@@ -1002,13 +1004,13 @@ NS_ASSUME_NONNULL_END
             
             [self updateStateTo:subscriberState withStatus:status completion:nil];
         } else {
-            [self.lock writeAccessWithBlock:^{
+            [self.lock syncWriteAccessWithBlock:^{
                 if (self.client.configuration.shouldTryCatchUpOnSubscriptionRestore) {
-                    if (self->_currentTimeToken &&
-                        [self->_currentTimeToken compare:@0] != NSOrderedSame) {
-                        
-                        self->_lastTimeToken = self->_currentTimeToken;
-                        self->_currentTimeToken = @0;
+                    unsigned long long currentTimeToken = atomic_load_explicit(&self->_currentTimeToken,
+                                                                               memory_order_relaxed);
+                    if (currentTimeToken != 0) {
+                        atomic_store_explicit(&self->_lastTimeToken, currentTimeToken, memory_order_relaxed);
+                        atomic_store_explicit(&self->_currentTimeToken, 0, memory_order_relaxed);
                     }
                     
                     if (self->_currentTimeTokenRegion &&
@@ -1019,8 +1021,8 @@ NS_ASSUME_NONNULL_END
                         self->_currentTimeTokenRegion = @(-1);
                     }
                 } else {
-                    self->_currentTimeToken = @0;
-                    self->_lastTimeToken = @0;
+                    atomic_store_explicit(&self->_currentTimeToken, 0, memory_order_relaxed);
+                    atomic_store_explicit(&self->_lastTimeToken, 0, memory_order_relaxed);
                     self->_currentTimeTokenRegion = @(-1);
                     self->_lastTimeTokenRegion = @(-1);
                 }
@@ -1041,7 +1043,9 @@ NS_ASSUME_NONNULL_END
 }
 
 - (void)handleSubscription:(BOOL)initialSubscription timeToken:(NSNumber *)timeToken region:(NSNumber *)region {
-    [self.lock writeAccessWithBlock:^{
+    [self.lock syncWriteAccessWithBlock:^{
+        unsigned long long lastTimeToken = atomic_load_explicit(&self->_lastTimeToken, memory_order_relaxed);
+        unsigned long long currentTimeToken = atomic_load_explicit(&self->_currentTimeToken, memory_order_relaxed);
         BOOL shouldAcceptNewTimeToken = YES;
 
         // Whether time token should be overridden despite subscription behavior configuration.
@@ -1058,14 +1062,14 @@ NS_ASSUME_NONNULL_END
             
             // Ensure what we already don't use value from previous time token assigned during
             // previous sessions.
-            if (shouldUseLastTimeToken && self->_lastTimeToken &&
-                [self->_lastTimeToken compare:@0] != NSOrderedSame) {
+            if (shouldUseLastTimeToken && lastTimeToken != 0) {
                 shouldAcceptNewTimeToken = NO;
                 
                 // Swap time tokens to catch up on events which happened while client changed
                 // channels and groups list configuration.
-                self->_currentTimeToken = self->_lastTimeToken;
-                self->_lastTimeToken = @0;
+                currentTimeToken = lastTimeToken;
+                atomic_store_explicit(&self->_currentTimeToken, currentTimeToken, memory_order_relaxed);
+                atomic_store_explicit(&self->_lastTimeToken, 0, memory_order_relaxed);
                 self->_currentTimeTokenRegion = self->_lastTimeTokenRegion;
                 self->_lastTimeTokenRegion = @(-1);
             }
@@ -1073,12 +1077,11 @@ NS_ASSUME_NONNULL_END
         #pragma clang diagnostic pop
         // Ensure what client won't handle delayed requests. It is impossible to have non-initial
         // subscription while current time token report 0.
-        if (!initialSubscription && self->_currentTimeToken && [self->_currentTimeToken compare:@0] == NSOrderedSame)
-            shouldAcceptNewTimeToken = NO;
+        if (!initialSubscription && currentTimeToken == 0) shouldAcceptNewTimeToken = NO;
         
         if (shouldAcceptNewTimeToken) {
-            if (self->_currentTimeToken && [self->_currentTimeToken compare:@0] != NSOrderedSame) {
-                self->_lastTimeToken = self->_currentTimeToken;
+            if (currentTimeToken != 0) {
+                atomic_store_explicit(&self->_lastTimeToken, currentTimeToken, memory_order_relaxed);
             }
 
             if (self->_currentTimeTokenRegion && [self->_currentTimeTokenRegion compare:@0] != NSOrderedSame &&
@@ -1086,7 +1089,8 @@ NS_ASSUME_NONNULL_END
                 
                 self->_lastTimeTokenRegion = self->_currentTimeTokenRegion;
             }
-            self->_currentTimeToken = (shouldOverrideTimeToken ? self->_overrideTimeToken : timeToken);
+            NSNumber *newTimeToken = shouldOverrideTimeToken ? self->_overrideTimeToken : timeToken;
+            atomic_store_explicit(&self->_currentTimeToken, newTimeToken.unsignedLongLongValue, memory_order_relaxed);
             self->_currentTimeTokenRegion = region;
         }
         
@@ -1099,10 +1103,7 @@ NS_ASSUME_NONNULL_END
     NSMutableArray<PNSubscribeEventData *> *events = [status.data.updates mutableCopy];
     NSUInteger eventsCount = events.count;
 
-    __block NSUInteger generation;
-    [self.lock readAccessWithBlock:^{
-        generation = self->_subscribeCycleGeneration;
-    }];
+    NSUInteger generation = atomic_load_explicit(&_subscribeCycleGeneration, memory_order_acquire);
 
     if (!events.count) {
         [self continueSubscriptionCycleIfRequiredRestoringSubscription:NO completion:nil];
@@ -1119,10 +1120,8 @@ NS_ASSUME_NONNULL_END
         // Remove message duplicates from received events list.
         [self deDuplicateMessages:events];
 
-        __block BOOL shouldContinue;
-        [self.lock readAccessWithBlock:^{
-            shouldContinue = (generation == self->_subscribeCycleGeneration);
-        }];
+        BOOL shouldContinue = generation == atomic_load_explicit(&self->_subscribeCycleGeneration,
+                                                                 memory_order_acquire);
 
         if (shouldContinue) [self continueSubscriptionCycleIfRequiredRestoringSubscription:NO completion:nil];
 
@@ -1135,6 +1134,9 @@ NS_ASSUME_NONNULL_END
             [self.client.listenersManager notifyStatusChange:exceedStatus];
         }
 
+        // Events for batched callbacks will be delivered with single dispatch when all events processed.
+        [self.client.listenersManager beginEventsBatch];
+
         // Iterate through array with notifications and report back using callback blocks to the
         // user.
         for (PNSubscribeEventData *event in events) {
@@ -1161,6 +1163,8 @@ NS_ASSUME_NONNULL_END
                 [self handleNewFileEvent:((PNFileEventResult *)resultObject)];
             }
         }
+
+        [self.client.listenersManager flushEventsBatch];
     }];
 
 }
@@ -1303,75 +1307,27 @@ NS_ASSUME_NONNULL_END
         }];
         
         if (duplicateMessagesIndices.count) [events removeObjectsAtIndexes:duplicateMessagesIndices];
-        [self cleanUpCachedObjectsIfRequired:cacheSize];
     }
 }
 
 - (void)clearCacheFromMessagesNewerThan:(NSNumber *)timetoken {
-    NSUInteger maximumMessagesCacheSize = self.client.configuration.maximumMessagesCacheSize;
-    
-    if (maximumMessagesCacheSize > 0) {
-        SEL sortSelector = @selector(localizedCaseInsensitiveCompare:);
-        NSArray<NSString *> *identifiers = [[_cachedObjects allKeys] sortedArrayUsingSelector:sortSelector];
-        NSString *timetokenString = timetoken.stringValue;
-        __block NSUInteger indexOfMessage = NSNotFound;
-        [identifiers enumerateObjectsUsingBlock:^(NSString *identifier, NSUInteger identifierIdx, 
-                                                  BOOL *identifiersEnumeratorStop) {
-            
-            NSString *cachedTimetoken = [identifier componentsSeparatedByString:@"_"][0];
-            NSComparisonResult result = [timetokenString compare:cachedTimetoken options:NSNumericSearch];
-            
-            if (result == NSOrderedSame || result == NSOrderedAscending) {
-                indexOfMessage = identifierIdx;
-            }
-            
-            *identifiersEnumeratorStop = (indexOfMessage != NSNotFound);
-        }];
-        
-        if (indexOfMessage != NSNotFound) {
-            NSRange messagesRange = NSMakeRange(indexOfMessage, identifiers.count - indexOfMessage);
-            identifiers = [identifiers subarrayWithRange:messagesRange];
-            [_cachedObjects removeObjectsForKeys:identifiers];
-            [_cachedObjectIdentifiers removeObjectsInArray:identifiers];
-        }
+    if (self.client.configuration.maximumMessagesCacheSize > 0) {
+        [_messagesCache removeMessagesNewerThan:timetoken.unsignedLongLongValue];
     }
 }
 
 - (BOOL)cacheObjectIfPossible:(PNSubscribeMessageEventData *)object withMaximumCacheSize:(NSUInteger)size {
-    BOOL cached = NO;
-    NSString *identifier = [@[object.timetoken.stringValue, object.channel] componentsJoinedByString:@"_"];
-    NSMutableArray *objects = _cachedObjects[identifier]?: [NSMutableArray new];
-    NSUInteger cachedMessagesCount = objects.count;
-    
-    // Cache objects if required.
-    id data = object.message;
-
-    if (data && (objects.count == 0 || [objects indexOfObject:data] == NSNotFound)) {
-        cached = YES; 
-        [objects addObject:data];
-        [_cachedObjectIdentifiers addObject:identifier];
-    }
-    
-    if (cachedMessagesCount == 0) _cachedObjects[identifier] = objects;
-    
-    return cached;
-}
+    if (!object.message) return NO;
+    if (_messagesCache.capacity != size) [_messagesCache resizeToCapacity:size];
 
-- (void)cleanUpCachedObjectsIfRequired:(NSUInteger)maximumCacheSize {
-    while (_cachedObjectIdentifiers.count > maximumCacheSize) {
-        NSString *identifier = [_cachedObjectIdentifiers objectAtIndex:0];
-        NSMutableArray *objects = _cachedObjects[identifier];
-        
-        if (objects.count == 1) [_cachedObjects removeObjectForKey:identifier];
-        else [objects removeObjectAtIndex:0];
-        
-        [_cachedObjectIdentifiers removeObjectAtIndex:0];
-    }
+    return [_messagesCache storeMessageWithTimetoken:object.timetoken.unsignedLongLongValue
+                                             channel:object.channel
+                                         fingerprint:object.pnFingerprintValue];
 }
 
 - (void)appendSubscriberInformation:(PNStatus *)status {
-    status.currentTimetoken = _currentTimeToken;
-    status.lastTimeToken = _lastTimeToken;
+    status.currentTimetoken = self.currentTimeToken;
+    status.lastTimeToken = self.lastTimeToken;
     status.currentTimeTokenRegion = _currentTimeTokenRegion;
     status.lastTimeTokenRegion = _lastTimeTokenRegion;
     status.subscribedChannels = [_channelsSet setByAddingObjectsFromSet:_presenceChannelsSet].allObjects;
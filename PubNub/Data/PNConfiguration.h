@@ -230,6 +230,71 @@ DEPRECATED_MSG_ATTRIBUTE("This property deprecated and will be removed with next
 /// - Since: 5.3.0
 @property(strong, nullable, nonatomic) PNRequestRetryConfiguration *requestRetry;
 
+/// Maximum number of simultaneously processed non-subscribe requests.
+///
+/// Heavy workloads (like App Context synchronization or history backfill) can raise this budget to keep more requests
+/// in flight. Requests above the budget wait in the queue until one of the active requests completes.
+///
+/// > Note: Budget is shared by all non-subscribe operations (there is no separate budget per operation type).
+/// Subscribe requests always use a separate single connection.
+///
+/// This property is set to **3** by default.
+@property(assign, nonatomic) NSUInteger maximumServiceConnections;
+
+/// Whether non-subscribe requests should be multiplexed over a single connection or not.
+///
+/// When enabled, all in-flight non-subscribe requests (up to ``maximumServiceConnections``) are sent as HTTP/2 streams
+/// over a single connection to the origin instead of opening a separate connection for each request.
+///
+/// > Important: Requests will be processed one by one if the origin doesn't support HTTP/2.
+///
+/// This property is set to **NO** by default.
+@property(assign, nonatomic, getter = shouldMultiplexRequests) BOOL multiplexRequests;
+
+/// Whether non-subscribe requests connection pool should be shared with other clients or not.
+///
+/// When enabled, **PubNub** client instances with the same origin and connection settings share a single connection
+/// pool (and ``maximumServiceConnections`` budget) instead of opening their own connections.
+///
+/// > Important: Shared pool is configured by the client which created it: request retry configuration and logger of
+/// this client are used for requests of all clients which share the pool, until the last of them is deallocated.
+///
+/// This property is set to **NO** by default.
+@property(assign, nonatomic, getter = shouldShareConnectionPool) BOOL shareConnectionPool;
+
+/// Maximum number of simultaneously sent publish requests.
+///
+/// When set to a non-zero value, publish requests go through the client-side publish queue. Queue sends publish
+/// requests to different channels concurrently up to this limit, but no more than
+/// ``maximumInFlightPublishRequestsPerChannel`` to the same channel.
+///
+/// > Note: Queue is used only by `-publishWithRequest:completion:` and methods which build on it.
+///
+/// This property is set to **0** (publish queue disabled) by default.
+@property(assign, nonatomic) NSUInteger maximumInFlightPublishRequests;
+
+/// Maximum number of simultaneously sent publish requests to the same channel.
+///
+/// With default value queue keeps per-channel publish order (next publish to the channel is sent only after the
+/// previous one completes). Increase it when most of the messages are published to a single channel (e.g. telemetry)
+/// and publish order isn't important.
+///
+/// > Note: Used only when ``maximumInFlightPublishRequests`` is set. Value can't be larger than
+/// ``maximumInFlightPublishRequests``.
+///
+/// This property is set to **1** by default.
+@property(assign, nonatomic) NSUInteger maximumInFlightPublishRequestsPerChannel;
+
+/// Maximum number of publish requests which can be waiting in the publish queue or being sent.
+///
+/// Publish calls above this limit complete immediately with `PNPublishQueueFullCategory` error status, so callers can
+/// slow down until queued publish requests complete.
+///
+/// > Note: Used only when ``maximumInFlightPublishRequests`` is set.
+///
+/// This property is set to **1000** by default.
+@property(assign, nonatomic) NSUInteger maximumPublishQueueLength;
+
 /// List of additional loggers that will handle log entries.
 ///
 /// > Note: In addition to the default console logger, which will print all messages to the Xcode console.
@@ -251,6 +316,22 @@ DEPRECATED_MSG_ATTRIBUTE("This property deprecated and will be removed with next
 /// - Since: 6.0.0
 @property(assign, nonatomic) PNLogLevel logLevel;
 
+/// Maximum number of log entries which can wait to be passed to the loggers.
+///
+/// `trace`, `debug` and `info` log entries are buffered and passed to the loggers (``loggers`` and bundled console
+/// logger) on a separate queue, so log entry formatting and output don't slow down the **PubNub** client. When the
+/// buffer is almost full, `trace` and `debug` entries are sampled, and when it is full, new entries are dropped. Number
+/// of dropped entries is reported with a `warn` log entry.
+///
+/// `warn` and `error` log entries are never dropped: they are passed to the loggers right after buffered entries and
+/// before the logging call returns. Buffered entries are also passed to the loggers when the **PubNub** client is
+/// deallocated.
+///
+/// > Important: Set to **0** to pass log entries to the loggers synchronously on the caller's thread.
+///
+/// This property is set to **1024** by default.
+@property(assign, nonatomic) NSUInteger logEntriesBufferSize;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -106,6 +106,7 @@ NS_ASSUME_NONNULL_END
         _subscribeKey = [subscribeKey copy];
         _enableDefaultConsoleLogger = YES;
         _logLevel = PNNoneLogLevel;
+        _logEntriesBufferSize = kPNDefaultLogEntriesBufferSize;
         
         self.userID = userID;
         _subscribeMaximumIdleTime = kPNDefaultSubscribeMaximumIdleTime;
@@ -120,6 +121,12 @@ NS_ASSUME_NONNULL_END
         _requestMessageCountThreshold = kPNDefaultRequestMessageCountThreshold;
         _fileMessagePublishRetryLimit = kPNDefaultFileMessagePublishRetryLimit;
         _maximumMessagesCacheSize = kPNDefaultMaximumMessagesCacheSize;
+        _maximumServiceConnections = kPNDefaultMaximumServiceConnections;
+        _multiplexRequests = kPNDefaultShouldMultiplexRequests;
+        _shareConnectionPool = kPNDefaultShouldShareConnectionPool;
+        _maximumInFlightPublishRequests = kPNDefaultMaximumInFlightPublishRequests;
+        _maximumInFlightPublishRequestsPerChannel = kPNDefaultMaximumInFlightPublishRequestsPerChannel;
+        _maximumPublishQueueLength = kPNDefaultMaximumPublishQueueLength;
         
         PNRequestRetryConfiguration *retryConfiguration;
         retryConfiguration = [PNRequestRetryConfiguration configurationWithExponentialDelayExcludingEndpoints:
@@ -148,6 +155,7 @@ NS_ASSUME_NONNULL_END
     configuration.cryptoModule = self.cryptoModule;
     configuration.enableDefaultConsoleLogger = self.shouldEnableDefaultConsoleLogger;
     configuration.logLevel = self.logLevel;
+    configuration.logEntriesBufferSize = self.logEntriesBufferSize;
     configuration.loggers = self.loggers;
     configuration.filterExpression = [self.filterExpression copy];
     configuration.subscribeMaximumIdleTime = self.subscribeMaximumIdleTime;
@@ -162,6 +170,12 @@ NS_ASSUME_NONNULL_END
     configuration.catchUpOnSubscriptionRestore = self.shouldTryCatchUpOnSubscriptionRestore;
     configuration.fileMessagePublishRetryLimit = self.fileMessagePublishRetryLimit;
     configuration.requestRetry = [self.requestRetry copy];
+    configuration.maximumServiceConnections = self.maximumServiceConnections;
+    configuration.multiplexRequests = self.shouldMultiplexRequests;
+    configuration.shareConnectionPool = self.shouldShareConnectionPool;
+    configuration.maximumInFlightPublishRequests = self.maximumInFlightPublishRequests;
+    configuration.maximumInFlightPublishRequestsPerChannel = self.maximumInFlightPublishRequestsPerChannel;
+    configuration.maximumPublishQueueLength = self.maximumPublishQueueLength;
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
@@ -204,7 +218,13 @@ NS_ASSUME_NONNULL_END
         @"catchUpOnSubscriptionRestore": self.shouldTryCatchUpOnSubscriptionRestore ? @"YES" : @"NO",
         @"fileMessagePublishRetryLimit": @(self.fileMessagePublishRetryLimit),
         @"requestMessageCountThreshold": @(self.requestMessageCountThreshold),
-        @"maximumMessagesCacheSize": @(self.maximumMessagesCacheSize)
+        @"maximumMessagesCacheSize": @(self.maximumMessagesCacheSize),
+        @"maximumServiceConnections": @(self.maximumServiceConnections),
+        @"multiplexRequests": self.shouldMultiplexRequests ? @"YES" : @"NO",
+        @"shareConnectionPool": self.shouldShareConnectionPool ? @"YES" : @"NO",
+        @"maximumInFlightPublishRequests": @(self.maximumInFlightPublishRequests),
+        @"maximumInFlightPublishRequestsPerChannel": @(self.maximumInFlightPublishRequestsPerChannel),
+        @"maximumPublishQueueLength": @(self.maximumPublishQueueLength)
     }];
     
     if (hbNotificationOptions.count) dictionary[@"heartbeatNotificationOptions"] = hbNotificationOptions;
@@ -168,6 +168,11 @@ static NSInteger const PNAPIErrorMalformedServiceResponse = 1105;
 /// Malformed subscribe filter expression.
 static NSInteger const PNAPIErrorMalformedFilterExpression = 1106;
 
+/// Client-side publish queue is full.
+///
+/// Publish request has been rejected because too many publish requests are waiting or being sent.
+static NSInteger const PNAPIErrorPublishQueueFull = 1107;
+
 
 #pragma mark - Storage error codes
 
@@ -0,0 +1,41 @@
+#import "PNSendFileStatus.h"
+
+
+#pragma mark Class forward
+
+@class PNFileUploadRequest;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// `Send file` request processing status private extension.
+@interface PNSendFileStatus ()
+
+
+#pragma mark - Properties
+
+/// Number of file bytes which has been passed to the transport.
+@property(assign, nonatomic) NSUInteger uploadedBytes;
+
+/// Time which has been spent to pass file data to the transport.
+@property(assign, nonatomic) NSTimeInterval uploadDuration;
+
+/// Time which transport spent waiting for the next portion of read (and encrypted) file data.
+@property(assign, nonatomic) NSTimeInterval uploadStallTime;
+
+
+#pragma mark - Helpers
+
+/// Copy file upload metrics from the request which has been used to upload file data.
+///
+/// - Parameter request: Request which has been used to upload file data.
+- (void)updateUploadMetricsFromRequest:(PNFileUploadRequest *)request;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
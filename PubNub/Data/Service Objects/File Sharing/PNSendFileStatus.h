@@ -15,6 +15,21 @@ NS_ASSUME_NONNULL_BEGIN
 /// `Send file` request processed information.
 @property(strong, nonatomic, readonly) PNFileSendData *data;
 
+/// Number of file bytes which has been uploaded.
+@property(assign, nonatomic, readonly) NSUInteger uploadedBytes;
+
+/// Time which has been spent to upload file data.
+@property(assign, nonatomic, readonly) NSTimeInterval uploadDuration;
+
+/// Average file data upload throughput (bytes per second).
+@property(assign, nonatomic, readonly) double uploadThroughput;
+
+/// Time which transport spent waiting for the next portion of read (and encrypted) file data.
+///
+/// Value close to ``uploadDuration`` means that file upload has been limited by file reading and encryption rather
+/// than by network.
+@property(assign, nonatomic, readonly) NSTimeInterval uploadStallTime;
+
 #pragma mark -
 
 
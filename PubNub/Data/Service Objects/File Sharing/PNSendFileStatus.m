@@ -1,4 +1,5 @@
-#import "PNSendFileStatus.h"
+#import "PNSendFileStatus+Private.h"
+#import "PNFileUploadRequest.h"
 #import "PNOperationResult+Private.h"
 #import "PNStatus+Private.h"
 
@@ -18,6 +19,19 @@
     return !self.isError ? self.responseData : nil;
 }
 
+- (double)uploadThroughput {
+    return self.uploadDuration > 0.f ? self.uploadedBytes / self.uploadDuration : 0.f;
+}
+
+
+#pragma mark - Helpers
+
+- (void)updateUploadMetricsFromRequest:(PNFileUploadRequest *)request {
+    self.uploadStallTime = request.uploadStallTime;
+    self.uploadDuration = request.uploadDuration;
+    self.uploadedBytes = request.uploadedBytes;
+}
+
 #pragma mark -
 
 
@@ -0,0 +1,37 @@
+#import "PNHistoryBackfillProgress.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// `History backfill` progress private extension.
+@interface PNHistoryBackfillProgress ()
+
+
+#pragma mark - Properties
+
+/// Token which can be used to continue backfill from the window which follows the last processed one.
+@property(copy, nonatomic) NSString *token;
+
+/// Time passed since backfill start.
+@property(assign, nonatomic) NSTimeInterval duration;
+
+/// Number of timetoken windows which has been passed to the batch block.
+@property(assign, nonatomic) NSUInteger completedWindows;
+
+/// Total number of timetoken windows in backfill range.
+@property(assign, nonatomic) NSUInteger totalWindows;
+
+/// Number of messages which has been passed to the batch block.
+@property(assign, nonatomic) NSUInteger messagesCount;
+
+/// Number of completed `fetch history` requests.
+@property(assign, nonatomic) NSUInteger requestsCount;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,46 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// `History backfill` progress.
+///
+/// Snapshot of the backfill state at the moment when batch (or completion) block has been called.
+@interface PNHistoryBackfillProgress : NSObject
+
+
+#pragma mark - Properties
+
+/// Token which can be used to continue backfill from the window which follows the last processed one.
+///
+/// > Note: Token should be set to ``PNHistoryBackfillRequest/progressToken`` of request for the same range.
+@property(copy, nonatomic, readonly) NSString *token;
+
+/// Number of messages processed per second since backfill start.
+@property(assign, nonatomic, readonly) double messagesPerSecond;
+
+/// Time passed since backfill start.
+@property(assign, nonatomic, readonly) NSTimeInterval duration;
+
+/// Number of timetoken windows which has been passed to the batch block.
+///
+/// > Note: Includes windows which has been processed before backfill has been resumed with progress token.
+@property(assign, nonatomic, readonly) NSUInteger completedWindows;
+
+/// Total number of timetoken windows in backfill range.
+@property(assign, nonatomic, readonly) NSUInteger totalWindows;
+
+/// Number of messages which has been passed to the batch block.
+@property(assign, nonatomic, readonly) NSUInteger messagesCount;
+
+/// Number of completed `fetch history` requests.
+@property(assign, nonatomic, readonly) NSUInteger requestsCount;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,27 @@
+#import "PNHistoryBackfillProgress+Private.h"
+
+
+#pragma mark Interface implementation
+
+@implementation PNHistoryBackfillProgress
+
+
+#pragma mark - Properties
+
+- (double)messagesPerSecond {
+    return self.duration > 0.f ? self.messagesCount / self.duration : 0.f;
+}
+
+
+#pragma mark - Misc
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> windows: %@/%@, messages: %@, requests: %@, %.1f msg/s",
+            NSStringFromClass([self class]), self, @(self.completedWindows), @(self.totalWindows),
+            @(self.messagesCount), @(self.requestsCount), self.messagesPerSecond];
+}
+
+#pragma mark -
+
+
+@end
@@ -17,6 +17,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Maximum simultaneously connections which can be opened.
 @property(assign, nonatomic) NSUInteger maximumConnections;
 
+/// Whether concurrent requests should be multiplexed over a single HTTP/2 connection or not.
+@property(assign, nonatomic, getter = shouldMultiplexRequests) BOOL multiplexRequests;
+
 /// `PubNub` client instance logger.
 ///
 /// Logger can be used to add additional logs.
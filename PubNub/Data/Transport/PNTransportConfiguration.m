@@ -13,6 +13,7 @@
     PNTransportConfiguration *configuration = [[PNTransportConfiguration allocWithZone:zone] init];
     configuration.retryConfiguration = [self.retryConfiguration copy];
     configuration.maximumConnections = self.maximumConnections;
+    configuration.multiplexRequests = self.shouldMultiplexRequests;
     configuration.logger = self.logger;
     
     return configuration;
@@ -23,7 +24,8 @@
 
 - (NSDictionary *)dictionaryRepresentation {
     NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithDictionary:@{
-        @"maximumConnections": @(self.maximumConnections)
+        @"maximumConnections": @(self.maximumConnections),
+        @"multiplexRequests": self.shouldMultiplexRequests ? @"YES" : @"NO"
     }];
     if (self.retryConfiguration) dictionary[@"retryConfiguration"] = [self.retryConfiguration dictionaryRepresentation];
     
@@ -78,6 +78,22 @@ NS_ASSUME_NONNULL_END
     [self.configuration.transport requestsWithBlock:block];
 }
 
+- (void)cancelRequestsWithTag:(NSString *)tag {
+    id<PNTransport> transport = self.configuration.transport;
+
+    if ([transport respondsToSelector:@selector(cancelRequestsWithTag:)]) {
+        [transport cancelRequestsWithTag:tag];
+        return;
+    }
+
+    [transport requestsWithBlock:^(NSArray<PNTransportRequest *> *requests) {
+        for(PNTransportRequest *request in requests) {
+            dispatch_block_t cancelBlock = request.cancel;
+            if ([request.tag isEqualToString:tag] && cancelBlock) cancelBlock();
+        }
+    }];
+}
+
 
 #pragma mark - Request processing
 
@@ -65,6 +65,7 @@ NS_ASSUME_NONNULL_END
     PNTransportConfiguration *configuration = [PNTransportConfiguration new];
     configuration.retryConfiguration = self.configuration.requestRetry;
     configuration.maximumConnections = self.maximumConnections;
+    configuration.multiplexRequests = self.configuration.shouldMultiplexRequests;
     configuration.logger = self.logger;
     
     return configuration;
@@ -28,6 +28,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Unique request identifier.
 @property(copy, nullable, nonatomic) NSString *identifier;
 
+/// Tag of the group of related requests.
+@property(copy, nullable, nonatomic) NSString *tag;
+
 /// Query parameters to be sent with the request.
 @property(copy, nullable, nonatomic) NSDictionary *query;
 
@@ -53,6 +56,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// > Note: By default set to `NO`.
 @property(assign, nonatomic) BOOL responseAsFile;
 
+/// Transport-specific information which allows continuing interrupted file download.
+@property(strong, nullable, nonatomic) NSData *resumeData;
+
 /// Whether request can be cancelled or not.
 ///
 /// > Note: By default set to `NO`.
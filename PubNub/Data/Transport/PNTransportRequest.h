@@ -63,6 +63,11 @@ NS_ASSUME_NONNULL_BEGIN
 /// Unique request identifier.
 @property(copy, nullable, nonatomic, readonly) NSString *identifier;
 
+/// Tag of the group of related requests.
+///
+/// Transport layer can use it to cancel all requests from the group with single call.
+@property(copy, nullable, nonatomic, readonly) NSString *tag;
+
 /// Query parameters to be sent with the request.
 @property(copy, nullable, nonatomic, readonly) NSDictionary *query;
 
@@ -93,6 +98,12 @@ NS_ASSUME_NONNULL_BEGIN
 /// > Note: By default set to `NO`.
 @property(assign, nonatomic, readonly) BOOL responseAsFile;
 
+/// Transport-specific information which allows continuing interrupted file download.
+///
+/// > Note: Value is set by the transport layer when a file download request fails after part of the response has been
+/// received, and used to continue download from the received offset (with `Range` request) when it is set.
+@property(strong, nullable, nonatomic, readonly) NSData *resumeData;
+
 /// Whether request can be cancelled or not.
 ///
 /// > Note: By default set to `NO`.
@@ -17,6 +17,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  * @brief Cached list of formatters where keys are \c dateFormat strings used for configuration.
+ *
+ * @discussion \c NSDateFormatter isn't safe for concurrent use, so each thread has own list of formatters.
  */
 + (NSMutableDictionary<NSString *, NSDateFormatter *> *)formattersByString;
 
@@ -34,14 +36,16 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Information
 
 + (NSMutableDictionary<NSString *, NSDateFormatter *> *)formattersByString {
-    static NSMutableDictionary *_formattersByString;
-    static dispatch_once_t onceToken;
+    static NSString * const kPNFormattersByStringKey = @"com.pubnub.date-formatters";
+    NSMutableDictionary *threadDictionary = NSThread.currentThread.threadDictionary;
+    NSMutableDictionary *formattersByString = threadDictionary[kPNFormattersByStringKey];
     
-    dispatch_once(&onceToken, ^{
-        _formattersByString = [NSMutableDictionary new];
-    });
+    if (!formattersByString) {
+        formattersByString = [NSMutableDictionary new];
+        threadDictionary[kPNFormattersByStringKey] = formattersByString;
+    }
     
-    return _formattersByString;
+    return formattersByString;
 }
 
 
@@ -10,33 +10,47 @@
 
 - (void)pn_writeToFileAtURL:(NSURL *)url withBufferSize:(NSUInteger)size error:(NSError **)error {
     NSOutputStream *outputStream = [NSOutputStream outputStreamWithURL:url append:NO];
-    NSMutableData *buffer = [NSMutableData dataWithLength:size];
+    // Single buffer reused for all chunks, so memory usage doesn't depend on the stream length.
+    NSMutableData *buffer = [NSMutableData dataWithLength:MAX(size, 1)];
+    uint8_t *bytes = buffer.mutableBytes;
+    size = buffer.length;
+
     if (self.streamStatus == NSStreamStatusNotOpen) [self open];
     [outputStream open];
 
     NSError *processingError = self.streamError ?: outputStream.streamError;
+    BOOL failed = processingError != nil;
+    BOOL completed = NO;
+
+    while (!completed && !failed) {
+        // Stream implementations (like cryptor stream) may autorelease temporary objects on each read.
+        @autoreleasepool {
+            NSInteger bytesRead = [self read:bytes maxLength:size];
+            NSInteger bytesWritten = 0;
 
-    while (self.streamStatus == NSStreamStatusOpen &&
-           outputStream.streamStatus == NSStreamStatusOpen &&
-           !processingError) {
-        NSInteger bytesRead = [self read:buffer.mutableBytes maxLength:size];
-        NSInteger bytesToWrite = bytesRead;
+            if (bytesRead == 0) completed = YES;
+            else if (bytesRead < 0) failed = YES;
 
-        if (bytesRead > 0) {
-            while (outputStream.streamStatus == NSStreamStatusOpen && bytesToWrite > 0) {
-                NSInteger bytesWritten = [outputStream write:buffer.mutableBytes + (bytesRead - bytesToWrite)
-                                                   maxLength:bytesToWrite];
+            while (bytesRead > 0 && bytesWritten < bytesRead && !failed) {
+                NSInteger written = [outputStream write:bytes + bytesWritten maxLength:bytesRead - bytesWritten];
 
-                if (bytesWritten > 0) bytesToWrite -= bytesWritten;
-                else if (bytesWritten < 0) processingError = outputStream.streamError;
+                if (written > 0) bytesWritten += written;
+                else failed = YES;
             }
-            buffer = [NSMutableData dataWithLength:size];
-        } else if (bytesRead == 0) {
-            [outputStream close];
-            [self close];
-        } else processingError = self.streamError;
+        }
     }
 
+    if (failed) processingError = self.streamError ?: outputStream.streamError;
+    // Streams may not report error for a short write or read.
+    if (failed && !processingError) {
+        processingError = [NSError errorWithDomain:NSCocoaErrorDomain
+                                              code:NSFileWriteUnknownError
+                                          userInfo:@{ NSURLErrorKey: url }];
+    }
+
+    [outputStream close];
+    [self close];
+
     if (processingError && error != NULL) *error = processingError;
 }
 
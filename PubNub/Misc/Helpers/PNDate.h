@@ -27,6 +27,75 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (NSString *)RFC3339StringFromDate:(NSDate *)date;
 
+
+#pragma mark - ISO8601
+
+/**
+ * @brief Parse \c ISO8601 date string.
+ *
+ * @discussion Parser handles \c yyyy-MM-dd'T'HH:mm:ss and \c yyyy-MM-dd'T'HH:mm:ss.SSS formats with \c Z or numeric
+ * (\c +HH:mm or \c +HHmm) time zone designator. Parser doesn't use  NSDateFormatter and can be used from any
+ * thread.
+ *
+ * @param string \c ISO8601 date string which should be parsed.
+ *
+ * @return Parsed date or \c nil in case if \c string has unexpected format.
+ */
++ (nullable NSDate *)dateFromISO8601String:(NSString *)string;
+
+/**
+ * @brief Parse \c ISO8601 date string into interval since 1970.
+ *
+ * @param interval Pointer into which parsed time interval (in seconds) since 1970 will be stored.
+ * @param string \c ISO8601 date string which should be parsed.
+ *
+ * @return \c YES in case if \c string has been parsed.
+ */
++ (BOOL)getTimeInterval:(NSTimeInterval *)interval fromISO8601String:(NSString *)string;
+
+/**
+ * @brief Convert  NSDate instance to \c ISO8601 string in UTC time zone.
+ *
+ * @param date  NSDate instance which should be converted to  NSString.
+ * @param withMilliseconds Whether milliseconds should be added to the string or not.
+ *
+ * @return \c yyyy-MM-dd'T'HH:mm:ss.SSS'Z' (or \c yyyy-MM-dd'T'HH:mm:ss'Z' without milliseconds) formatted date
+ * string.
+ */
++ (NSString *)ISO8601StringFromDate:(NSDate *)date withMilliseconds:(BOOL)withMilliseconds;
+
+
+#pragma mark - Timetoken
+
+/**
+ * @brief Convert  PubNub high-precision timetoken to  NSDate.
+ *
+ * @param timetoken 17-digit timetoken (number of 100 nanoseconds intervals since 1970).
+ *
+ * @return Date which corresponds to the \c timetoken.
+ */
++ (NSDate *)dateFromTimetoken:(unsigned long long)timetoken;
+
+/**
+ * @brief Parse  PubNub high-precision timetoken string.
+ *
+ * @param string String with 17-digit timetoken.
+ *
+ * @return Date which corresponds to the timetoken or \c nil in case if \c string is not 17-digit timetoken.
+ */
++ (nullable NSDate *)dateFromTimetokenString:(NSString *)string;
+
+/**
+ * @brief Convert  NSDate to  PubNub high-precision timetoken.
+ *
+ * @note Precision is limited by  NSDate internal (double) representation.
+ *
+ * @param date  NSDate instance which should be converted to timetoken.
+ *
+ * @return 17-digit timetoken (number of 100 nanoseconds intervals since 1970).
+ */
++ (unsigned long long)timetokenFromDate:(NSDate *)date;
+
 #pragma mark -
 
 
@@ -7,55 +7,302 @@
 #import "PNDate.h"
 
 
-NS_ASSUME_NONNULL_BEGIN
+#pragma mark Constants
 
-#pragma mark Protected interface declaration
+/**
+ * @brief Maximum length of supported \c ISO8601 date string.
+ *
+ * @discussion Enough for date with nanoseconds and numeric time zone designator.
+ */
+static NSUInteger const kPNDateISO8601MaximumLength = 40;
+
+/**
+ * @brief Number of digits in \b PubNub high-precision timetoken.
+ */
+static NSUInteger const kPNDateTimetokenLength = 17;
+
+/**
+ * @brief Number of timetoken units (100 nanoseconds) in one second.
+ */
+static double const kPNDateTimetokenUnitsPerSecond = 10000000.f;
 
-@interface PNDate ()
+/**
+ * @brief Number of seconds in one day.
+ */
+static int64_t const kPNDateSecondsPerDay = 86400;
 
 
-#pragma mark - Information
+#pragma mark - Calendar helpers
 
 /**
- * @brief Shared date formatter configured according to RFC3339 requirements.
+ * @brief Number of days since 1970-01-01 for proleptic Gregorian calendar date.
+ *
+ * @discussion Howard Hinnant's \c days_from_civil algorithm.
  */
-@property (class, nonatomic, readonly, strong) NSDateFormatter *rfc3339Formatter;
+static int64_t PNDateDaysFromCivil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = (unsigned)(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
 
+    return era * 146097 + (int64_t)dayOfEra - 719468;
+}
 
-#pragma mark -
+/**
+ * @brief Proleptic Gregorian calendar date for number of days since 1970-01-01.
+ *
+ * @discussion Howard Hinnant's \c civil_from_days algorithm.
+ */
+static void PNDateCivilFromDays(int64_t days, int64_t *year, unsigned *month, unsigned *day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned dayOfEra = (unsigned)(days - era * 146097);
+    unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    unsigned monthPosition = (5 * dayOfYear + 2) / 153;
 
+    *day = dayOfYear - (153 * monthPosition + 2) / 5 + 1;
+    *month = monthPosition < 10 ? monthPosition + 3 : monthPosition - 9;
+    *year = (int64_t)yearOfEra + era * 400 + (*month <= 2);
+}
 
-@end
+/**
+ * @brief Number of days in month.
+ */
+static unsigned PNDateDaysInMonth(int64_t year, unsigned month) {
+    static const unsigned days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    BOOL isLeapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
 
-NS_ASSUME_NONNULL_END
+    return month == 2 && isLeapYear ? 29 : days[month - 1];
+}
 
 
-#pragma mark - Interface implementation
+#pragma mark - Parsing helpers
 
-@implementation PNDate
+/**
+ * @brief Read fixed number of decimal digits.
+ *
+ * @return \c YES in case if all \c count characters are decimal digits.
+ */
+static BOOL PNDateReadDigits(const char *string, NSUInteger count, unsigned *value) {
+    unsigned result = 0;
 
+    for (NSUInteger idx = 0; idx < count; idx++) {
+        char character = string[idx];
+        if (character < '0' || character > '9') return NO;
+        result = result * 10 + (unsigned)(character - '0');
+    }
 
-#pragma mark - Information
-
-+ (NSDateFormatter *)rfc3339Formatter {
-    static NSDateFormatter *_sharedRFC3339Formatter;
-    static dispatch_once_t onceToken;
-    
-    dispatch_once(&onceToken, ^{
-        _sharedRFC3339Formatter = [NSDateFormatter new];
-        _sharedRFC3339Formatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
-        _sharedRFC3339Formatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
-        _sharedRFC3339Formatter.dateFormat = @"yyyy'-'MM'-'dd'T'HH':'mm':'ss'Z'";
-    });
-    
-    return _sharedRFC3339Formatter;
+    *value = result;
+
+    return YES;
+}
+
+/**
+ * @brief Parse \c ISO8601 date from null-terminated ASCII string.
+ *
+ * @return \c YES in case if \c string has been parsed.
+ */
+static BOOL PNDateParseISO8601(const char *string, NSUInteger length, NSTimeInterval *interval) {
+    unsigned year, month, day, hour, minute, second;
+
+    // Shortest supported format: yyyy-MM-ddTHH:mm:ssZ
+    if (length < 20 || string[4] != '-' || string[7] != '-' || string[10] != 'T' || string[13] != ':' ||
+        string[16] != ':') {
+        return NO;
+    }
+
+    if (!PNDateReadDigits(string, 4, &year) || !PNDateReadDigits(string + 5, 2, &month) ||
+        !PNDateReadDigits(string + 8, 2, &day) || !PNDateReadDigits(string + 11, 2, &hour) ||
+        !PNDateReadDigits(string + 14, 2, &minute) || !PNDateReadDigits(string + 17, 2, &second)) {
+        return NO;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > PNDateDaysInMonth(year, month) || hour > 23 || minute > 59 ||
+        second > 59) {
+        return NO;
+    }
+
+    NSUInteger position = 19;
+    double fraction = 0.f;
+
+    if (string[position] == '.') {
+        NSUInteger start = ++position;
+        uint64_t nanoseconds = 0;
+        uint64_t scale = 1000000000;
+
+        // Digits after nanoseconds ignored, because they can't be represented by NSDate anyway.
+        for (; position < length && string[position] >= '0' && string[position] <= '9'; position++) {
+            if (scale == 1) continue;
+            scale /= 10;
+            nanoseconds += (uint64_t)(string[position] - '0') * scale;
+        }
+
+        if (position == start) return NO;
+        fraction = nanoseconds / 1000000000.0;
+    }
+
+    int64_t offset = 0;
+
+    if (string[position] == 'Z') position++;
+    else if (string[position] == '+' || string[position] == '-') {
+        int64_t sign = string[position] == '-' ? -1 : 1;
+        unsigned offsetHours, offsetMinutes;
+        position++;
+
+        if (!PNDateReadDigits(string + position, 2, &offsetHours)) return NO;
+        position += string[position + 2] == ':' ? 3 : 2;
+        if (!PNDateReadDigits(string + position, 2, &offsetMinutes)) return NO;
+        position += 2;
+
+        if (offsetHours > 23 || offsetMinutes > 59) return NO;
+        offset = sign * (offsetHours * 3600 + offsetMinutes * 60);
+    } else return NO;
+
+    if (position != length) return NO;
+
+    int64_t seconds = PNDateDaysFromCivil(year, month, day) * kPNDateSecondsPerDay;
+    seconds += hour * 3600 + minute * 60 + second;
+    *interval = (NSTimeInterval)(seconds - offset) + fraction;
+
+    return YES;
 }
 
 
+#pragma mark - Formatting helpers
+
+/**
+ * @brief Write fixed number of decimal digits.
+ */
+static void PNDateWriteDigits(char *buffer, NSUInteger count, int64_t value) {
+    for (NSUInteger idx = count; idx > 0; idx--) {
+        buffer[idx - 1] = (char)('0' + value % 10);
+        value /= 10;
+    }
+}
+
+/**
+ * @brief Format date as \c ISO8601 string in UTC time zone.
+ *
+ * @return Number of characters written into \c buffer or \c 0 if year can't be represented with 4 digits.
+ */
+static NSUInteger PNDateFormatISO8601(NSTimeInterval interval, BOOL withMilliseconds, char *buffer) {
+    // Fractional seconds truncated in same way as NSDateFormatter does.
+    int64_t milliseconds = (int64_t)floor(interval * 1000.f);
+    int64_t seconds = milliseconds >= 0 ? milliseconds / 1000 : (milliseconds - 999) / 1000;
+    int64_t days = (seconds >= 0 ? seconds : seconds - kPNDateSecondsPerDay + 1) / kPNDateSecondsPerDay;
+    int64_t secondOfDay = seconds - days * kPNDateSecondsPerDay;
+    unsigned month, day;
+    int64_t year;
+
+    PNDateCivilFromDays(days, &year, &month, &day);
+    if (year < 0 || year > 9999) return 0;
+
+    PNDateWriteDigits(buffer, 4, year);
+    buffer[4] = '-';
+    PNDateWriteDigits(buffer + 5, 2, month);
+    buffer[7] = '-';
+    PNDateWriteDigits(buffer + 8, 2, day);
+    buffer[10] = 'T';
+    PNDateWriteDigits(buffer + 11, 2, secondOfDay / 3600);
+    buffer[13] = ':';
+    PNDateWriteDigits(buffer + 14, 2, secondOfDay % 3600 / 60);
+    buffer[16] = ':';
+    PNDateWriteDigits(buffer + 17, 2, secondOfDay % 60);
+    NSUInteger length = 19;
+
+    if (withMilliseconds) {
+        buffer[length++] = '.';
+        PNDateWriteDigits(buffer + length, 3, milliseconds - seconds * 1000);
+        length += 3;
+    }
+
+    buffer[length++] = 'Z';
+
+    return length;
+}
+
+
+#pragma mark - Interface implementation
+
+@implementation PNDate
+
+
 #pragma mark - Conversion
 
 + (NSString *)RFC3339StringFromDate:(NSDate *)date {
-    return [[self rfc3339Formatter] stringFromDate:date];
+    return [self ISO8601StringFromDate:date withMilliseconds:NO];
+}
+
+
+#pragma mark - ISO8601
+
++ (NSDate *)dateFromISO8601String:(NSString *)string {
+    NSTimeInterval interval = 0.f;
+    if (![self getTimeInterval:&interval fromISO8601String:string]) return nil;
+
+    return [NSDate dateWithTimeIntervalSince1970:interval];
+}
+
++ (BOOL)getTimeInterval:(NSTimeInterval *)interval fromISO8601String:(NSString *)string {
+    if (![string isKindOfClass:[NSString class]]) return NO;
+
+    char buffer[kPNDateISO8601MaximumLength + 1];
+    const char *characters = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingASCII);
+    NSUInteger length = string.length;
+
+    if (length > kPNDateISO8601MaximumLength) return NO;
+    if (!characters) {
+        if (![string getCString:buffer maxLength:sizeof(buffer) encoding:NSASCIIStringEncoding]) return NO;
+        characters = buffer;
+    }
+
+    return PNDateParseISO8601(characters, length, interval);
+}
+
++ (NSString *)ISO8601StringFromDate:(NSDate *)date withMilliseconds:(BOOL)withMilliseconds {
+    char buffer[kPNDateISO8601MaximumLength];
+    NSUInteger length = PNDateFormatISO8601(date.timeIntervalSince1970, withMilliseconds, buffer);
+
+    if (length == 0) {
+        NSISO8601DateFormatOptions options = NSISO8601DateFormatWithInternetDateTime;
+        if (withMilliseconds) options |= NSISO8601DateFormatWithFractionalSeconds;
+
+        return [NSISO8601DateFormatter stringFromDate:date
+                                             timeZone:[NSTimeZone timeZoneForSecondsFromGMT:0]
+                                        formatOptions:options];
+    }
+
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
+
+#pragma mark - Timetoken
+
++ (NSDate *)dateFromTimetoken:(unsigned long long)timetoken {
+    return [NSDate dateWithTimeIntervalSince1970:(NSTimeInterval)timetoken / kPNDateTimetokenUnitsPerSecond];
+}
+
++ (NSDate *)dateFromTimetokenString:(NSString *)string {
+    if (![string isKindOfClass:[NSString class]] || string.length != kPNDateTimetokenLength) return nil;
+
+    char buffer[kPNDateTimetokenLength + 1];
+    unsigned long long timetoken = 0;
+
+    if (![string getCString:buffer maxLength:sizeof(buffer) encoding:NSASCIIStringEncoding]) return nil;
+
+    for (NSUInteger idx = 0; idx < kPNDateTimetokenLength; idx++) {
+        if (buffer[idx] < '0' || buffer[idx] > '9') return nil;
+        timetoken = timetoken * 10 + (unsigned long long)(buffer[idx] - '0');
+    }
+
+    return [self dateFromTimetoken:timetoken];
+}
+
++ (unsigned long long)timetokenFromDate:(NSDate *)date {
+    NSTimeInterval interval = date.timeIntervalSince1970;
+    return interval > 0.f ? (unsigned long long)llround(interval * kPNDateTimetokenUnitsPerSecond) : 0;
 }
 
 #pragma mark -
@@ -31,6 +31,24 @@ extern BOOL PNNSObjectIsSubclassOfAnyClass(id object, NSArray<Class> *classes);
 /// - Returns: Payload's fingerprints.
 extern NSString *PNMessageFingerprint(id payload);
 
+/// Compute numeric fingerprint from received real-time update payload.
+///
+/// > Important: Payload will be serialized to the compact JSON with sorted keys to compute fingerprint. Keys order,
+/// escaping and numbers format may differ from payload bytes in subscribe response, so result can't be compared with
+/// ``PNMessageFingerprintFromBytes`` fingerprint. Use it only when raw payload bytes not available.
+///
+/// - Parameter payload: JSON-compatible object for which fingerprints should be computed.
+/// - Returns: Payload's fingerprints.
+extern uint32_t PNMessageFingerprintValue(id payload);
+
+/// Compute fingerprint from raw real-time update payload bytes.
+///
+/// - Parameters:
+///   - bytes: Pointer to the UTF-8 encoded payload.
+///   - length: Length of payload in bytes.
+/// - Returns: Payload's fingerprints.
+extern uint32_t PNMessageFingerprintFromBytes(const void * _Nullable bytes, NSUInteger length);
+
 
 #pragma mark - String
 
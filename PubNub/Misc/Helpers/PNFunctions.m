@@ -22,22 +22,68 @@ BOOL PNNSObjectIsSubclassOfAnyClass(id object, NSArray<Class> *classes) {
 }
 
 NSString *PNMessageFingerprint(id payload) {
-    NSString *string = payload;
-    if (![payload isKindOfClass:[NSString class]]) {
-        if (PNNSObjectIsKindOfAnyClass(payload, @[NSDictionary.class, NSArray.class])) {
-            NSData *jsonData = [NSJSONSerialization dataWithJSONObject:payload options:0 error:nil];
-            string = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
-        } else string = ((NSObject *)payload).description;
+    return [NSString stringWithFormat:@"%08x", PNMessageFingerprintValue(payload)];
+}
+
+uint32_t PNMessageFingerprintValue(id payload) {
+    // Keys sorted, so fingerprint of the same parsed payload doesn't depend on dictionary keys order.
+    NSJSONWritingOptions options = NSJSONWritingFragmentsAllowed | NSJSONWritingSortedKeys;
+    NSData *data;
+    if (payload && [NSJSONSerialization isValidJSONObject:@[payload]]) {
+        data = [NSJSONSerialization dataWithJSONObject:payload options:options error:nil];
     }
-    
-    uint32_t hash = 0;
-    
-    for (NSUInteger i = 0; i < string.length; i++) {
-        unichar charCode = [string characterAtIndex:i];
-        hash = (hash << 5) - hash + charCode;
+
+    if (!data) data = [((NSObject *)payload).description dataUsingEncoding:NSUTF8StringEncoding];
+
+    return PNMessageFingerprintFromBytes(data.bytes, data.length);
+}
+
+uint32_t PNMessageFingerprintFromBytes(const void *bytes, NSUInteger length) {
+    // xxHash32 with four independent accumulators processed as single SIMD vector.
+    typedef uint32_t PNUInt32x4 __attribute__((ext_vector_type(4)));
+    static const uint32_t prime1 = 2654435761U, prime2 = 2246822519U, prime3 = 3266489917U;
+    static const uint32_t prime4 = 668265263U, prime5 = 374761393U;
+    const uint8_t *position = bytes;
+    const uint8_t *end = position + length;
+    uint32_t hash = prime5;
+
+    if (length >= 16) {
+        PNUInt32x4 accumulator = { prime1 + prime2, prime2, 0, -prime1 };
+        const uint8_t *limit = end - 16;
+
+        do {
+            PNUInt32x4 lane;
+            memcpy(&lane, position, sizeof(lane));
+            accumulator += lane * prime2;
+            accumulator = ((accumulator << 13) | (accumulator >> 19)) * prime1;
+            position += 16;
+        } while (position <= limit);
+
+        hash = ((accumulator.x << 1) | (accumulator.x >> 31)) + ((accumulator.y << 7) | (accumulator.y >> 25)) +
+               ((accumulator.z << 12) | (accumulator.z >> 20)) + ((accumulator.w << 18) | (accumulator.w >> 14));
     }
-    
-    return [NSString stringWithFormat:@"%08x", hash];
+
+    hash += (uint32_t)length;
+
+    for (; position + 4 <= end; position += 4) {
+        uint32_t word;
+        memcpy(&word, position, sizeof(word));
+        hash += word * prime3;
+        hash = ((hash << 17) | (hash >> 15)) * prime4;
+    }
+
+    for (; position < end; position++) {
+        hash += (*position) * prime5;
+        hash = ((hash << 11) | (hash >> 21)) * prime1;
+    }
+
+    hash ^= hash >> 15;
+    hash *= prime2;
+    hash ^= hash >> 13;
+    hash *= prime3;
+    hash ^= hash >> 16;
+
+    return hash;
 }
 
 
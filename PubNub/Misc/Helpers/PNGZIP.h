@@ -3,7 +3,31 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Interface implementation
+#pragma mark Types and structures
+
+/// Compression strategy which should be used by deflate algorithm.
+typedef NS_ENUM(NSInteger, PNGZIPStrategy) {
+    /// Default strategy suitable for most of the data.
+    PNGZIPDefaultStrategy,
+
+    /// Strategy for data produced by filter (or predictor) with small values and random distribution.
+    PNGZIPFilteredStrategy,
+
+    /// Strategy which force Huffman encoding only (no string match).
+    PNGZIPHuffmanOnlyStrategy,
+
+    /// Strategy which limit match distances to one (run-length encoding).
+    PNGZIPRLEStrategy,
+
+    /// Strategy which prevent use of dynamic Huffman codes.
+    PNGZIPFixedStrategy
+};
+
+/// Default compression level (balance between speed and compression ratio).
+extern NSInteger const PNGZIPDefaultCompressionLevel;
+
+
+#pragma mark - Interface implementation
 
 /// Useful methods collection to work with data compression/uncompression.
 @interface PNGZIP : NSObject
@@ -17,6 +41,53 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Returns: Compressed `NSData` instance or `nil` in case if compression error occurred.
 + (nullable NSData *)GZIPDeflatedData:(NSData *)data;
 
+/// Allow to compress passed `data` with specific compression configuration.
+///
+/// Output buffer allocated once with size of compressed data upper bound, so data will be compressed without
+/// intermediate re-allocations.
+///
+/// - Parameters:
+///   - data: Data which should be compressed with GZIP deflate algorithm.
+///   - level: Compression level in `0` (no compression) to `9` (best compression) range or
+///   ``PNGZIPDefaultCompressionLevel``.
+///   - strategy: Compression strategy which should be used by deflate algorithm.
+/// - Returns: Compressed `NSData` instance or `nil` in case if compression error occurred.
++ (nullable NSData *)GZIPDeflatedData:(NSData *)data level:(NSInteger)level strategy:(PNGZIPStrategy)strategy;
+
+/// Create input stream which will compress data read from `stream`.
+///
+/// Data from `stream` read and compressed by chunks, so whole body won't be loaded into memory.
+///
+/// > Note: Length of compressed data is unknown ahead of time and request body should be sent with chunked transfer
+/// encoding.
+///
+/// - Parameters:
+///   - stream: Input stream with data which should be compressed with GZIP deflate algorithm.
+///   - level: Compression level in `0` (no compression) to `9` (best compression) range or
+///   ``PNGZIPDefaultCompressionLevel``.
+///   - strategy: Compression strategy which should be used by deflate algorithm.
+/// - Returns: Input stream with compressed data.
++ (NSInputStream *)GZIPDeflatedInputStream:(NSInputStream *)stream
+                                     level:(NSInteger)level
+                                  strategy:(PNGZIPStrategy)strategy;
+
+
+#pragma mark - Decompression
+
+/// Check whether passed `data` looks like GZIP or zlib compressed data.
+///
+/// - Parameter data: Data which should be checked.
+/// - Returns: `YES` in case if `data` starts with GZIP or zlib header.
++ (BOOL)isCompressedData:(NSData *)data;
+
+/// Allow to decompress passed `data`.
+///
+/// Data format (GZIP or zlib) will be identified automatically from the data header.
+///
+/// - Parameter data: Data which has been compressed with GZIP or zlib deflate algorithm.
+/// - Returns: Decompressed `NSData` instance or `nil` in case if decompression error occurred.
++ (nullable NSData *)GZIPInflatedData:(NSData *)data;
+
 #pragma mark -
 
 
@@ -1,8 +1,125 @@
 #import "PNGZIP.h"
+#import "PNError.h"
 #import <zlib.h>
 
 
-#pragma mark Interface implementation
+#pragma mark Constants
+
+/// Deflate window size with GZIP header and trailer.
+static int const kPNGZIPDeflateWindow = 31;
+
+/// Inflate window size with automatic GZIP / zlib header detection.
+static int const kPNGZIPInflateWindow = 47;
+
+/// Deflate internal compression state memory level.
+static int const kPNGZIPMemoryLevel = 8;
+
+/// Length of chunks in which source stream data is read for compression.
+static NSUInteger const kPNGZIPStreamChunkLength = 64 * 1024;
+
+/// Minimum length of buffer for decompressed data.
+static NSUInteger const kPNGZIPInflateMinimumLength = 4 * 1024;
+
+NSInteger const PNGZIPDefaultCompressionLevel = Z_DEFAULT_COMPRESSION;
+
+
+#pragma mark - Helpers
+
+/// Initialize deflate stream with GZIP wrapper.
+///
+/// - Parameters:
+///   - stream: Stream which should be initialized.
+///   - level: Compression level or ``PNGZIPDefaultCompressionLevel``.
+///   - strategy: Compression strategy which should be used by deflate algorithm.
+/// - Returns: zlib status code.
+static int PNGZIPDeflateInit(z_stream *stream, NSInteger level, PNGZIPStrategy strategy) {
+    int zStrategy = Z_DEFAULT_STRATEGY;
+    switch (strategy) {
+        case PNGZIPFilteredStrategy: zStrategy = Z_FILTERED; break;
+        case PNGZIPHuffmanOnlyStrategy: zStrategy = Z_HUFFMAN_ONLY; break;
+        case PNGZIPRLEStrategy: zStrategy = Z_RLE; break;
+        case PNGZIPFixedStrategy: zStrategy = Z_FIXED; break;
+        default: break;
+    }
+
+    if (level != Z_DEFAULT_COMPRESSION) level = MAX(Z_NO_COMPRESSION, MIN(level, Z_BEST_COMPRESSION));
+    bzero(stream, sizeof(z_stream));
+
+    return deflateInit2(stream, (int)level, Z_DEFLATED, kPNGZIPDeflateWindow, kPNGZIPMemoryLevel, zStrategy);
+}
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/// Input stream which compress data from another input stream with GZIP deflate algorithm.
+@interface PNGZIPInputStream : NSInputStream
+
+
+#pragma mark - Properties
+
+/// Input stream with data for compression.
+@property(strong, nonatomic, readonly) NSInputStream *inputStream;
+
+/// Reusable source data chunk buffer.
+@property(strong, nonatomic, nullable) NSMutableData *inputBuffer;
+
+/// Compression input stream processing error.
+@property(copy, atomic, nullable) NSError *streamError;
+
+/// Compression input stream status.
+@property(assign, atomic) NSStreamStatus streamStatus;
+
+/// Compression strategy which should be used by deflate algorithm.
+@property(assign, nonatomic, readonly) PNGZIPStrategy strategy;
+
+/// Compression level.
+@property(assign, nonatomic, readonly) NSInteger level;
+
+/// Whether deflate stream has been initialized or not.
+@property(assign, nonatomic) BOOL deflateInitialized;
+
+/// Whether all data has been read from ``inputStream`` or not.
+@property(assign, nonatomic) BOOL inputEnded;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize compression input stream.
+///
+/// - Parameters:
+///   - stream: Input stream with data for compression.
+///   - level: Compression level or ``PNGZIPDefaultCompressionLevel``.
+///   - strategy: Compression strategy which should be used by deflate algorithm.
+/// - Returns: Initialized compression input stream.
+- (instancetype)initWithInputStream:(NSInputStream *)stream level:(NSInteger)level strategy:(PNGZIPStrategy)strategy;
+
+
+#pragma mark - Helpers
+
+/// Read next chunk of data from ``inputStream`` into ``inputBuffer``.
+///
+/// - Returns: `NO` in case if source stream read error occurred.
+- (BOOL)readInputStreamChunk;
+
+/// Release deflate stream resources.
+- (void)endDeflate;
+
+/// Update stream status and error.
+///
+/// - Parameter error: `NSError` instance with information about what exactly went wrong during stream processing.
+- (void)setStreamProcessingError:(nullable NSError *)error;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
 
 @implementation PNGZIP
 
@@ -10,51 +127,246 @@
 #pragma mark - Compression
 
 + (NSData *)GZIPDeflatedData:(NSData *)data {
-    NSMutableData *processedDataStorage = nil;
-    NSUInteger window = 31;
-    
-    if (data.length > 0) {
-        BOOL done = NO;
-        int status;
-        z_stream stream;
-        bzero(&stream, sizeof(stream));
-        stream.zalloc = Z_NULL;
-        stream.zfree = Z_NULL;
-        stream.opaque = Z_NULL;
-        stream.next_in = (Bytef *)data.bytes;
-        stream.avail_in = (uint)data.length;
-        stream.total_out = 0;
-        status = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window, 8, Z_DEFAULT_STRATEGY);
-
-        if (status == Z_OK) {
-            BOOL isOperationCompleted = NO;
-            processedDataStorage = [[NSMutableData alloc] initWithLength:1024];
-
-            while (!isOperationCompleted) {
-                // Make sure we have enough room and reset the lengths.
-                if ((status == Z_BUF_ERROR) || stream.total_out >= processedDataStorage.length) {
-                    [processedDataStorage increaseLengthBy:1024];
-                }
-                
-                stream.next_out = (Bytef*)processedDataStorage.mutableBytes + stream.total_out;
-                stream.avail_out = (uInt)(processedDataStorage.length - stream.total_out);
-
-                // Deflate another chunk
-                status = deflate(&stream, Z_FINISH);
-                isOperationCompleted = ((status != Z_OK) && (status != Z_BUF_ERROR));
-            }
-
-            status = deflateEnd(&stream);
-            done = (status == Z_OK || status == Z_STREAM_END);
-
-            if (status == Z_OK) {
-                // Set real length.
-                if (done) [processedDataStorage setLength:stream.total_out];
-            }
+    return [self GZIPDeflatedData:data level:PNGZIPDefaultCompressionLevel strategy:PNGZIPDefaultStrategy];
+}
+
++ (NSData *)GZIPDeflatedData:(NSData *)data level:(NSInteger)level strategy:(PNGZIPStrategy)strategy {
+    if (data.length == 0 || data.length > UINT_MAX) return nil;
+
+    z_stream stream;
+    if (PNGZIPDeflateInit(&stream, level, strategy) != Z_OK) return nil;
+
+    // Bound takes into account GZIP wrapper, so whole data will be compressed with single call.
+    NSMutableData *processedDataStorage = [NSMutableData dataWithLength:deflateBound(&stream, (uLong)data.length)];
+    stream.next_in = (Bytef *)data.bytes;
+    stream.avail_in = (uInt)data.length;
+    stream.next_out = (Bytef *)processedDataStorage.mutableBytes;
+    stream.avail_out = (uInt)processedDataStorage.length;
+
+    int status = deflate(&stream, Z_FINISH);
+    processedDataStorage.length = stream.total_out;
+    deflateEnd(&stream);
+
+    return status == Z_STREAM_END && processedDataStorage.length ? processedDataStorage : nil;
+}
+
++ (NSInputStream *)GZIPDeflatedInputStream:(NSInputStream *)stream
+                                     level:(NSInteger)level
+                                  strategy:(PNGZIPStrategy)strategy {
+    return [[PNGZIPInputStream alloc] initWithInputStream:stream level:level strategy:strategy];
+}
+
+
+#pragma mark - Decompression
+
++ (BOOL)isCompressedData:(NSData *)data {
+    if (data.length < 2) return NO;
+
+    const uint8_t *bytes = data.bytes;
+    if (bytes[0] == 0x1f && bytes[1] == 0x8b) return YES;
+
+    // zlib header: 'deflate' compression method, window up to 32K and header checksum.
+    return (bytes[0] & 0x0f) == Z_DEFLATED && (bytes[0] >> 4) <= 7 && ((bytes[0] << 8) | bytes[1]) % 31 == 0;
+}
+
++ (NSData *)GZIPInflatedData:(NSData *)data {
+    if (data.length == 0 || data.length > UINT_MAX) return nil;
+
+    z_stream stream;
+    bzero(&stream, sizeof(stream));
+    if (inflateInit2(&stream, kPNGZIPInflateWindow) != Z_OK) return nil;
+
+    NSUInteger length = MAX(data.length * 4, kPNGZIPInflateMinimumLength);
+    NSMutableData *processedDataStorage = [NSMutableData dataWithLength:length];
+    stream.next_in = (Bytef *)data.bytes;
+    stream.avail_in = (uInt)data.length;
+    int status = Z_OK;
+
+    while (status == Z_OK) {
+        // Grow geometrically to keep amount of copied data linear to decompressed data length.
+        if (stream.total_out >= processedDataStorage.length) processedDataStorage.length *= 2;
+        if (processedDataStorage.length - stream.total_out > UINT_MAX) break;
+
+        stream.next_out = (Bytef *)processedDataStorage.mutableBytes + stream.total_out;
+        stream.avail_out = (uInt)(processedDataStorage.length - stream.total_out);
+        status = inflate(&stream, Z_NO_FLUSH);
+
+        // Not enough input data to complete decompression.
+        if (status == Z_BUF_ERROR && stream.avail_in == 0) break;
+        if (status == Z_BUF_ERROR) status = Z_OK;
+    }
+
+    processedDataStorage.length = stream.total_out;
+    inflateEnd(&stream);
+
+    return status == Z_STREAM_END ? processedDataStorage : nil;
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation PNGZIPInputStream {
+    /// Deflate stream state.
+    z_stream _deflateStream;
+}
+
+
+#pragma mark - Information
+
+@synthesize streamStatus, streamError, delegate;
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream level:(NSInteger)level strategy:(PNGZIPStrategy)strategy {
+    if ((self = [super init])) {
+        _strategy = strategy;
+        _inputStream = stream;
+        _level = level;
+    }
+
+    return self;
+}
+
+
+#pragma mark - NSStream
+
+- (id)propertyForKey:(NSStreamPropertyKey)key {
+    return [self.inputStream propertyForKey:key];
+}
+
+- (BOOL)setProperty:(id)property forKey:(NSStreamPropertyKey)key {
+    return [self.inputStream setProperty:property forKey:key];
+}
+
+- (void)open {
+    if (self.streamStatus != NSStreamStatusNotOpen) return;
+
+    if (PNGZIPDeflateInit(&_deflateStream, self.level, self.strategy) != Z_OK) {
+        [self setStreamProcessingError:[NSError errorWithDomain:PNTransportErrorDomain
+                                                           code:PNErrorUnknown
+                                                       userInfo:@{
+            NSLocalizedDescriptionKey: @"Unable to initialize GZIP compression stream."
+        }]];
+        return;
+    }
+
+    self.inputBuffer = [NSMutableData dataWithLength:kPNGZIPStreamChunkLength];
+    self.deflateInitialized = YES;
+    self.streamStatus = NSStreamStatusOpen;
+
+    if (self.inputStream.streamStatus == NSStreamStatusNotOpen) [self.inputStream open];
+}
+
+- (void)close {
+    if (self.streamStatus != NSStreamStatusError && self.streamStatus != NSStreamStatusClosed) {
+        self.streamStatus = NSStreamStatusClosed;
+    }
+
+    if (self.inputStream.streamStatus != NSStreamStatusError && self.inputStream.streamStatus != NSStreamStatusClosed) {
+        [self.inputStream close];
+    }
+
+    [self endDeflate];
+}
+
+- (void)scheduleInRunLoop:(NSRunLoop *)__unused aRunLoop forMode:(NSRunLoopMode)__unused mode {
+}
+
+- (void)removeFromRunLoop:(NSRunLoop *)__unused aRunLoop forMode:(NSRunLoopMode)__unused mode {
+}
+
+
+#pragma mark - NSInputStream
+
+- (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)length {
+    if (self.streamStatus == NSStreamStatusError) return -1;
+    if (length == 0 || self.streamStatus != NSStreamStatusOpen) return 0;
+
+    _deflateStream.next_out = buffer;
+    _deflateStream.avail_out = (uInt)MIN(length, UINT_MAX);
+    NSUInteger bytesToRead = _deflateStream.avail_out;
+
+    while (_deflateStream.avail_out > 0) {
+        if (_deflateStream.avail_in == 0 && !self.inputEnded) {
+            // Return already compressed data instead of blocking on source stream read.
+            if (_deflateStream.avail_out != bytesToRead) break;
+            if (![self readInputStreamChunk]) return -1;
         }
+
+        int status = deflate(&_deflateStream, self.inputEnded ? Z_FINISH : Z_NO_FLUSH);
+
+        if (status == Z_STREAM_END) {
+            self.streamStatus = NSStreamStatusAtEnd;
+            break;
+        } else if (status != Z_OK && status != Z_BUF_ERROR) {
+            [self setStreamProcessingError:[NSError errorWithDomain:PNTransportErrorDomain
+                                                               code:PNErrorUnknown
+                                                           userInfo:@{
+                NSLocalizedDescriptionKey: @"Unable to compress input stream data chunk."
+            }]];
+            return -1;
+        }
+    }
+
+    NSUInteger bytesRead = bytesToRead - _deflateStream.avail_out;
+    _deflateStream.next_out = NULL;
+    _deflateStream.avail_out = 0;
+
+    if (self.streamStatus == NSStreamStatusAtEnd) [self endDeflate];
+
+    return (NSInteger)bytesRead;
+}
+
+- (BOOL)getBuffer:(uint8_t * _Nullable *)__unused buffer length:(NSUInteger *)__unused len {
+    return NO;
+}
+
+- (BOOL)hasBytesAvailable {
+    return self.streamStatus == NSStreamStatusOpen;
+}
+
+
+#pragma mark - Helpers
+
+- (BOOL)readInputStreamChunk {
+    NSInteger bytesRead = [self.inputStream read:self.inputBuffer.mutableBytes maxLength:self.inputBuffer.length];
+
+    if (bytesRead < 0) {
+        [self setStreamProcessingError:self.inputStream.streamError ?: [NSError errorWithDomain:PNTransportErrorDomain
+                                                                                           code:PNErrorUnknown
+                                                                                       userInfo:nil]];
+        return NO;
     }
 
-    return processedDataStorage.length ? processedDataStorage : nil;
+    _deflateStream.next_in = self.inputBuffer.mutableBytes;
+    _deflateStream.avail_in = (uInt)bytesRead;
+    self.inputEnded = bytesRead == 0;
+
+    return YES;
+}
+
+- (void)endDeflate {
+    if (!self.deflateInitialized) return;
+
+    self.deflateInitialized = NO;
+    deflateEnd(&_deflateStream);
+    self.inputBuffer = nil;
+}
+
+- (void)setStreamProcessingError:(NSError *)error {
+    if (!error) return;
+
+    self.streamError = error;
+    self.streamStatus = NSStreamStatusError;
+    [self endDeflate];
+}
+
+- (void)dealloc {
+    [self endDeflate];
 }
 
 #pragma mark -
@@ -1,16 +1,46 @@
 #import <Foundation/Foundation.h>
 
 
+#pragma mark Types
+
+/// Primitive which is used by lock to organise access to shared resources.
+typedef NS_ENUM(NSUInteger, PNLockBackend) {
+    /// Concurrent GCD queue (targeting subsystem queue) with barrier blocks for `write` access.
+    PNLockGCDBackend,
+
+    /// `os_unfair_lock` which allows single reader or writer at a time.
+    ///
+    /// Best suited for short critical sections with rare contention.
+    PNLockUnfairBackend,
+
+    /// `pthread_rwlock_t` which allows multiple readers and single writer.
+    ///
+    /// Best suited for read-heavy resources with short critical sections.
+    PNLockReadWriteBackend
+};
+
+
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Interface declaration
+#pragma mark - Interface declaration
 
 /// Shared resources lock.
 ///
-/// GCD based lock to organise thread-safe access to shared resources.
+/// Lock to organise thread-safe access to shared resources with GCD queue or lock primitive as backend.
+///
+/// > Important: With ``PNLockUnfairBackend`` and ``PNLockReadWriteBackend`` backends _asynchronous_ `write` blocks are
+/// queued on private serial queue and _synchronous_ access waits for queued blocks, so order in which `write` and
+/// following `read` blocks called is the same as with GCD backend. Blocks can schedule _asynchronous_ `write` access
+/// to the same lock, but shouldn't use _synchronous_ access, because none of backends is re-entrant.
 @interface PNLock : NSObject
 
 
+#pragma mark - Properties
+
+/// Primitive which is used by lock to organise access to shared resources.
+@property(assign, nonatomic, readonly) PNLockBackend backend;
+
+
 #pragma mark - Initialization and configuration
 
 /// Initialize lock with name.
@@ -28,6 +58,22 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)lockWithIsolationQueueName:(NSString *)queueName
                   subsystemQueueIdentifier:(NSString *)queueIdentifier;
 
+/// Initialize lock with name and backend.
+///
+/// Backend selected by subsystem depending on how shared resources accessed: GCD for long or re-entrant
+/// asynchronous `write` blocks and lock primitives for short critical sections on hot paths.
+///
+/// > Note: Subsystem queue used only by ``PNLockGCDBackend`` backend.
+///
+/// - Parameters:
+///   - queueName: Name of shared resources isolation queue.
+///   - queueIdentifier: Identifier of queue which used by subsystem.
+///   - backend: Primitive which should be used to organise access to shared resources.
+/// - Returns: Shared resources lock.
++ (instancetype)lockWithIsolationQueueName:(NSString *)queueName
+                  subsystemQueueIdentifier:(NSString *)queueIdentifier
+                                   backend:(PNLockBackend)backend;
+
 
 #pragma mark - Read / write locks
 
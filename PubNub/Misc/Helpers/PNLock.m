@@ -1,16 +1,31 @@
 #import "PNLock.h"
 #import "PNFunctions.h"
+#import <stdatomic.h>
+#import <os/lock.h>
+#import <pthread.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
 
-@interface PNLock ()
+@interface PNLock () {
+    /// Lock which is used by ``PNLockUnfairBackend`` backend.
+    os_unfair_lock _unfairLock;
+
+    /// Lock which is used by ``PNLockReadWriteBackend`` backend.
+    pthread_rwlock_t _readWriteLock;
+
+    /// Number of _asynchronous_ `write` blocks which wait in ``writeQueue``.
+    _Atomic(NSUInteger) _pendingWritesCount;
+}
 
 
 #pragma mark - Properties
 
+/// Primitive which is used by lock to organise access to shared resources.
+@property(assign, nonatomic) PNLockBackend backend;
+
 /// Isolation queue to protect ``PNLock`` shared resources.
 ///
 /// ``PNLock`` track list of created subsystem queues, which is accessed from multiple thread when new lock
@@ -20,7 +35,16 @@ NS_ASSUME_NONNULL_BEGIN
 /// Resources isolation queue.
 ///
 /// Queue which is used to isolate resources accessed within GCD blocks provided by lock.
-@property(strong, nonatomic) dispatch_queue_t queue;
+///
+/// > Note: Queue created only for ``PNLockGCDBackend`` backend.
+@property(strong, nullable, nonatomic) dispatch_queue_t queue;
+
+/// _Asynchronous_ `write` blocks queue.
+///
+/// Serial queue on which _asynchronous_ `write` blocks wait for lock primitive, so they never block calling thread.
+///
+/// > Note: Queue created only for ``PNLockUnfairBackend`` and ``PNLockReadWriteBackend`` backends.
+@property(strong, nullable, nonatomic) dispatch_queue_t writeQueue;
 
 /// Synchronous write lock status.
 ///
@@ -41,13 +65,30 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Parameters:
 ///   - queueName: Name of shared resources isolation queue.
 ///   - queueIdentifier: Identifier of queue which used by subsystem.
+///   - backend: Primitive which should be used to organise access to shared resources.
 /// - Returns: Shared resources lock.
 - (instancetype)initWithIsolationQueueName:(NSString *)queueName
-                  subsystemQueueIdentifier:(NSString *)queueIdentifier;
+                  subsystemQueueIdentifier:(NSString *)queueIdentifier
+                                   backend:(PNLockBackend)backend;
+
+
+#pragma mark - Synchronous read / write locks
+
+/// Call `write` block while lock primitive acquired.
+///
+/// > Note: Method doesn't wait for queued _asynchronous_ `write` blocks.
+///
+/// - Parameter block: GCD block within which it is safe to modify resources from other threads.
+- (void)primitiveWriteAccessWithBlock:(dispatch_block_t)block;
 
 
 #pragma mark - Helpers
 
+/// Wait for completion of _asynchronous_ `write` blocks which has been queued before.
+///
+/// Used by lock primitive backends to preserve order in which `write` and following access blocks called.
+- (void)waitForPendingWrites;
+
 /// Retrieve concurrent queue for subsystem resources isolation.
 ///
 /// - Parameter identifier: Identifier which is unique for an instance or set of instances in the subsystem.
@@ -85,21 +126,50 @@ NS_ASSUME_NONNULL_END
 
 + (instancetype)lockWithIsolationQueueName:(NSString *)queueName
                   subsystemQueueIdentifier:(NSString *)queueIdentifier {
-    return [[self alloc] initWithIsolationQueueName:queueName subsystemQueueIdentifier:queueIdentifier];
+    return [self lockWithIsolationQueueName:queueName
+                   subsystemQueueIdentifier:queueIdentifier
+                                    backend:PNLockGCDBackend];
+}
+
++ (instancetype)lockWithIsolationQueueName:(NSString *)queueName
+                  subsystemQueueIdentifier:(NSString *)queueIdentifier
+                                   backend:(PNLockBackend)backend {
+    return [[self alloc] initWithIsolationQueueName:queueName
+                           subsystemQueueIdentifier:queueIdentifier
+                                            backend:backend];
 }
 
 - (instancetype)initWithIsolationQueueName:(NSString *)queueName
-                  subsystemQueueIdentifier:(NSString *)queueIdentifier {
+                  subsystemQueueIdentifier:(NSString *)queueIdentifier
+                                   backend:(PNLockBackend)backend {
     if ((self = [super init])) {
+        _backend = backend;
+
         NSString *label = [NSString stringWithFormat:@"%@.%@", queueIdentifier, queueName];
-        const char *queueLabel = [label cStringUsingEncoding:NSUTF8StringEncoding];
-        dispatch_queue_t targetQueue = [[self class] subsystemQueueWithIdentifier:queueIdentifier];
-        self.queue = dispatch_queue_create_with_target(queueLabel, DISPATCH_QUEUE_CONCURRENT, targetQueue);
+
+        if (backend == PNLockUnfairBackend) _unfairLock = OS_UNFAIR_LOCK_INIT;
+        else if (backend == PNLockReadWriteBackend) pthread_rwlock_init(&_readWriteLock, nil);
+        else {
+            const char *queueLabel = [label cStringUsingEncoding:NSUTF8StringEncoding];
+            dispatch_queue_t targetQueue = [[self class] subsystemQueueWithIdentifier:queueIdentifier];
+            self.queue = dispatch_queue_create_with_target(queueLabel, DISPATCH_QUEUE_CONCURRENT, targetQueue);
+        }
+
+        if (backend != PNLockGCDBackend) {
+            NSString *writeLabel = [label stringByAppendingString:@".write"];
+            const char *queueLabel = [writeLabel cStringUsingEncoding:NSUTF8StringEncoding];
+            self.writeQueue = dispatch_queue_create(queueLabel, DISPATCH_QUEUE_SERIAL);
+            atomic_init(&_pendingWritesCount, 0);
+        }
     }
 
     return self;
 }
 
+- (void)dealloc {
+    if (_backend == PNLockReadWriteBackend) pthread_rwlock_destroy(&_readWriteLock);
+}
+
 
 #pragma mark - Read / write locks
 
@@ -115,35 +185,84 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Synchronous read / write locks
 
 - (void)syncReadAccessWithBlock:(dispatch_block_t)block {
-    dispatch_sync(self.queue, block);
+    if (_backend != PNLockGCDBackend) [self waitForPendingWrites];
+
+    if (_backend == PNLockUnfairBackend) {
+        os_unfair_lock_lock(&_unfairLock);
+        block();
+        os_unfair_lock_unlock(&_unfairLock);
+    } else if (_backend == PNLockReadWriteBackend) {
+        pthread_rwlock_rdlock(&_readWriteLock);
+        block();
+        pthread_rwlock_unlock(&_readWriteLock);
+    } else dispatch_sync(self.queue, block);
 }
 
 - (void)syncWriteAccessWithBlock:(dispatch_block_t)block {
-    dispatch_barrier_sync(self.queue, ^{
+    if (_backend == PNLockGCDBackend) {
+        dispatch_barrier_sync(self.queue, ^{
+            self.writeLockAcquired = YES;
+            block();
+            self.writeLockAcquired = NO;
+        });
+    } else {
+        [self waitForPendingWrites];
+        [self primitiveWriteAccessWithBlock:block];
+    }
+}
+
+- (void)primitiveWriteAccessWithBlock:(dispatch_block_t)block {
+    if (_backend == PNLockUnfairBackend) {
+        os_unfair_lock_lock(&_unfairLock);
         self.writeLockAcquired = YES;
         block();
         self.writeLockAcquired = NO;
-    });
+        os_unfair_lock_unlock(&_unfairLock);
+    } else if (_backend == PNLockReadWriteBackend) {
+        pthread_rwlock_wrlock(&_readWriteLock);
+        self.writeLockAcquired = YES;
+        block();
+        self.writeLockAcquired = NO;
+        pthread_rwlock_unlock(&_readWriteLock);
+    }
 }
 
 
 #pragma mark - Asynchronous read / write locks
 
 - (void)asyncReadAccessWithBlock:(dispatch_block_t)block {
-    dispatch_async(self.queue, block);
+    if (_backend == PNLockGCDBackend) dispatch_async(self.queue, block);
+    else {
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+            [self syncReadAccessWithBlock:block];
+        });
+    }
 }
 
 - (void)asyncWriteAccessWithBlock:(dispatch_block_t)block {
-    dispatch_barrier_async(self.queue, ^{
-        self.writeLockAcquired = YES;
-        block();
-        self.writeLockAcquired = NO;
-    });
+    if (_backend == PNLockGCDBackend) {
+        dispatch_barrier_async(self.queue, ^{
+            self.writeLockAcquired = YES;
+            block();
+            self.writeLockAcquired = NO;
+        });
+    } else {
+        // Block is queued (as with GCD barrier), so it can be scheduled from other `write` block.
+        atomic_fetch_add_explicit(&_pendingWritesCount, 1, memory_order_relaxed);
+        dispatch_async(self.writeQueue, ^{
+            [self primitiveWriteAccessWithBlock:block];
+            atomic_fetch_sub_explicit(&self->_pendingWritesCount, 1, memory_order_release);
+        });
+    }
 }
 
 
 #pragma mark - Helpers
 
+- (void)waitForPendingWrites {
+    if (atomic_load_explicit(&_pendingWritesCount, memory_order_acquire) > 0) dispatch_sync(self.writeQueue, ^{});
+}
+
 + (dispatch_queue_t)subsystemQueueWithIdentifier:(NSString *)identifier {
     static NSMapTable<NSString *,dispatch_queue_t> * _subsystemQueues;
     static dispatch_once_t onceToken;
@@ -25,6 +25,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (NSString *)percentEscapedString:(NSString *)string;
 
+/**
+ * @brief Convert provided UTF-8 encoded string data into percent-escaped string.
+ *
+ * @discussion Produce same result as \c +percentEscapedString: without intermediate  NSString creation.
+ *
+ * @param data UTF-8 encoded string data which should be converted.
+ *
+ * @return Percent-escaped string.
+ */
++ (NSString *)percentEscapedStringFromUTF8Data:(NSData *)data;
+
 
 #pragma mark - Conversion
 
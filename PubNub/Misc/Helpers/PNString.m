@@ -9,14 +9,38 @@
 #import <CommonCrypto/CommonHMAC.h>
 
 
-#pragma mark Interface implementation
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+@interface PNString ()
+
+
+#pragma mark - Encoding
+
+/**
+ * @brief Characters which shouldn't be percent-escaped.
+ *
+ * @return Set of characters allowed in escaped string.
+ */
++ (NSCharacterSet *)percentEscapeAllowedCharacters;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
 
 @implementation PNString
 
 
 #pragma mark - Encoding
 
-+ (NSString *)percentEscapedString:(NSString *)string {
++ (NSCharacterSet *)percentEscapeAllowedCharacters {
     static NSCharacterSet *allowedCharacters;
     static dispatch_once_t onceToken;
     
@@ -28,6 +52,12 @@
         
         allowedCharacters = [chars copy];
     });
+
+    return allowedCharacters;
+}
+
++ (NSString *)percentEscapedString:(NSString *)string {
+    NSCharacterSet *allowedCharacters = [self percentEscapeAllowedCharacters];
     
     /**
      * Wrapping non-string object (it can be passed from dictionary and compiler at run-time won't notify
@@ -47,6 +77,50 @@
     return [newlineEscapedString copy];
 }
 
++ (NSString *)percentEscapedStringFromUTF8Data:(NSData *)data {
+    static const char hexCharacters[] = "0123456789ABCDEF";
+    static BOOL allowedBytes[128];
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        // Allowed characters set contains only ASCII characters, so rest of bytes always escaped.
+        NSCharacterSet *allowedCharacters = [self percentEscapeAllowedCharacters];
+        for (unichar character = 0; character < 128; character++) {
+            allowedBytes[character] = [allowedCharacters characterIsMember:character];
+        }
+    });
+
+    const uint8_t *bytes = data.bytes;
+    NSUInteger length = data.length;
+    // Most bytes replaced with at most 3 characters (new line escape sequence is longer).
+    NSMutableData *escapedData = [NSMutableData dataWithLength:length * 3 + 1];
+    char *escaped = escapedData.mutableBytes;
+    NSUInteger escapedLength = 0;
+
+    for (NSUInteger idx = 0; idx < length; idx++) {
+        uint8_t byte = bytes[idx];
+
+        if (byte < 128 && allowedBytes[byte]) escaped[escapedLength++] = (char)byte;
+        else if (byte == '\n' || byte == '\r') {
+            // Escape new line characters in same way as +percentEscapedString: does.
+            memcpy(escaped + escapedLength, byte == '\n' ? "%5Cn" : "%5Cr", 4);
+            escapedLength += 4;
+        } else {
+            escaped[escapedLength++] = '%';
+            escaped[escapedLength++] = hexCharacters[byte >> 4];
+            escaped[escapedLength++] = hexCharacters[byte & 0x0F];
+        }
+
+        // Newline escape sequence one character longer than regular escape sequence.
+        if (escapedLength + 4 > escapedData.length && idx + 1 < length) {
+            escapedData.length += (length - idx) * 3 + 4;
+            escaped = escapedData.mutableBytes;
+        }
+    }
+
+    return [[NSString alloc] initWithBytes:escaped length:escapedLength encoding:NSASCIIStringEncoding];
+}
+
 
 #pragma mark - Conversion
 
@@ -20,9 +20,6 @@ NS_ASSUME_NONNULL_BEGIN
 /// Map of logger objects to the log categories.
 @property(class, strong, nonatomic, readonly) NSDictionary<NSString *, os_log_t> *logObjects;
 
-/// Formatter that is used to translate log entry timestamp to ISO8601 standardized string.
-@property(class, strong, nonatomic, readonly) NSISO8601DateFormatter *dateFormatter;
-
 
 #pragma mark - Logging
 
@@ -106,18 +103,6 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Properties
 
-+ (NSISO8601DateFormatter *)dateFormatter {
-    static NSISO8601DateFormatter *_dateFormatter;
-    static dispatch_once_t onceToken;
-    
-    dispatch_once(&onceToken, ^{
-        _dateFormatter = [NSISO8601DateFormatter new];
-        _dateFormatter.formatOptions = NSISO8601DateFormatWithInternetDateTime|NSISO8601DateFormatWithFractionalSeconds;
-    });
-    
-    return _dateFormatter;
-}
-
 + (NSDictionary<NSString *,os_log_t> *)logObjects {
     static NSDictionary<NSString *, os_log_t> *_logObjects;
     static dispatch_once_t onceToken;
@@ -186,7 +171,7 @@ NS_ASSUME_NONNULL_END
 
 + (NSString *)stringifiedLogEntry:(PNLogEntry *)logEntry {
     NSMutableString *string = [NSMutableString stringWithFormat:@"%@ PubNub-%@ %@ %@ ",
-                               [self.dateFormatter stringFromDate:logEntry.timestamp],
+                               [PNDate ISO8601StringFromDate:logEntry.timestamp withMilliseconds:YES],
                                logEntry.pubNubId,
                                [self stringifiedLogLevel:logEntry.logLevel],
                                logEntry.location];
@@ -49,6 +49,17 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 - (instancetype)initWithMessageType:(PNLogMessageType)messageType message:(MessageType)message;
 
+/// Initialize log entry object with lazily composed message.
+///
+/// `factory` is called only once, on first ``message`` access. This allows moving expensive message composition out
+/// of the caller's thread when log entries are processed asynchronously.
+///
+/// - Parameters:
+///   - messageType: Type of data that is passed as ``message``.
+///   - factory: Logged message payload factory block.
+/// - Returns: Initialized log entry.
+- (instancetype)initWithMessageType:(PNLogMessageType)messageType messageFactory:(MessageType (^)(void))factory;
+
 #pragma mark -
 
 
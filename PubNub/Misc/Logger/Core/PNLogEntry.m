@@ -1,4 +1,5 @@
 #import "PNLogEntry+Private.h"
+#import <os/lock.h>
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -6,11 +7,19 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark Private interface declaration
 
 /// Base log entry private extension.
-@interface PNLogEntry<MessageType> ()
+@interface PNLogEntry<MessageType> () {
+    /// Lock which protects lazy ``message`` composition.
+    os_unfair_lock _messageLock;
+}
 
 
 #pragma mark - Properties
 
+/// Logged message payload factory block.
+///
+/// Block is released after first ``message`` access.
+@property(copy, nullable, nonatomic) MessageType (^messageFactory)(void);
+
 /// Contains string which has been prepared for built-in ``PNConsoleLogger``.
 @property(strong, nonatomic) NSString *preProcessedString;
 
@@ -59,10 +68,26 @@ NS_ASSUME_NONNULL_END
 @implementation PNLogEntry
 
 
+#pragma mark - Properties
+
+- (id)message {
+    os_unfair_lock_lock(&_messageLock);
+    if (_messageFactory) {
+        _message = _messageFactory();
+        _messageFactory = nil;
+    }
+    id message = _message;
+    os_unfair_lock_unlock(&_messageLock);
+
+    return message;
+}
+
+
 #pragma mark - Initialization and Configuration
 
 - (instancetype)initWithMessageType:(PNLogMessageType)messageType message:(id)message {
     if ((self = [super init])) {
+        _messageLock = OS_UNFAIR_LOCK_INIT;
         _timestamp = [NSDate date];
         _messageType = messageType;
         _message = message;
@@ -72,6 +97,12 @@ NS_ASSUME_NONNULL_END
     return self;
 }
 
+- (instancetype)initWithMessageType:(PNLogMessageType)messageType messageFactory:(id (^)(void))factory {
+    if ((self = [self initWithMessageType:messageType message:nil])) _messageFactory = [factory copy];
+
+    return self;
+}
+
 #pragma mark -
 
 
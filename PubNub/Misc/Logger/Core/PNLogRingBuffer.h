@@ -0,0 +1,56 @@
+#import <Foundation/Foundation.h>
+#import "PNLogEntry.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Bounded multi-producer single-consumer log entries queue.
+///
+/// Producers reserve slots with compare-and-swap and never wait for each other or for the consumer. When all slots are
+/// occupied, the entry is rejected instead of blocking the caller.
+///
+/// > Important: ``dequeueEntry`` should be called from one thread at a time.
+@interface PNLogRingBuffer : NSObject
+
+
+#pragma mark - Properties
+
+/// Maximum number of entries which can be stored in the buffer.
+///
+/// > Note: Capacity is rounded up to the nearest power of two.
+@property(assign, nonatomic, readonly) NSUInteger capacity;
+
+/// Approximate number of entries which are waiting in the buffer.
+@property(assign, nonatomic, readonly) NSUInteger count;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure log entries buffer.
+///
+/// - Parameter capacity: Maximum number of entries which can be stored in the buffer.
+/// - Returns: Configured and ready to use log entries buffer.
++ (instancetype)bufferWithCapacity:(NSUInteger)capacity;
+
+
+#pragma mark - Entries
+
+/// Add log entry to the buffer.
+///
+/// - Parameter entry: Log entry which should be passed to the consumer.
+/// - Returns: `NO` in case if buffer is full and entry has been rejected.
+- (BOOL)enqueueEntry:(PNLogEntry *)entry;
+
+/// Take oldest log entry from the buffer.
+///
+/// - Returns: Oldest log entry or `nil` if buffer is empty.
+- (nullable PNLogEntry *)dequeueEntry;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
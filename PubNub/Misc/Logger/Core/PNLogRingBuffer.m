@@ -0,0 +1,141 @@
+#import "PNLogRingBuffer.h"
+#import <stdatomic.h>
+
+
+#pragma mark Types and structures
+
+/// Log entries buffer slot.
+typedef struct PNLogRingBufferSlot {
+    /// Position for which slot is ready.
+    ///
+    /// Equal to the enqueue position when slot is free, and to the enqueue position plus one when slot stores entry.
+    _Atomic(NSUInteger) sequence;
+
+    /// Retained log entry.
+    void *entry;
+} PNLogRingBufferSlot;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+@interface PNLogRingBuffer () {
+    /// Position at which next entry will be added.
+    _Atomic(NSUInteger) _enqueuePosition;
+
+    /// Position from which next entry will be taken.
+    _Atomic(NSUInteger) _dequeuePosition;
+
+    /// Log entries storage.
+    PNLogRingBufferSlot *_slots;
+
+    /// Mask which is used to translate position to the slot index.
+    NSUInteger _mask;
+}
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize log entries buffer.
+///
+/// - Parameter capacity: Maximum number of entries which can be stored in the buffer.
+/// - Returns: Initialized log entries buffer.
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNLogRingBuffer
+
+
+#pragma mark - Properties
+
+- (NSUInteger)count {
+    NSUInteger dequeuePosition = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+    NSUInteger enqueuePosition = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+
+    return enqueuePosition > dequeuePosition ? MIN(enqueuePosition - dequeuePosition, _capacity) : 0;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)bufferWithCapacity:(NSUInteger)capacity {
+    return [[self alloc] initWithCapacity:capacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    if ((self = [super init])) {
+        _capacity = 2;
+        while (_capacity < capacity) _capacity <<= 1;
+        _mask = _capacity - 1;
+
+        _slots = calloc(_capacity, sizeof(PNLogRingBufferSlot));
+        for (NSUInteger idx = 0; idx < _capacity; idx++) atomic_init(&_slots[idx].sequence, idx);
+        atomic_init(&_enqueuePosition, 0);
+        atomic_init(&_dequeuePosition, 0);
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    while ([self dequeueEntry]) {}
+    free(_slots);
+}
+
+
+#pragma mark - Entries
+
+- (BOOL)enqueueEntry:(PNLogEntry *)entry {
+    NSUInteger position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+    PNLogRingBufferSlot *slot;
+
+    while (YES) {
+        slot = &_slots[position & _mask];
+        NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        NSInteger difference = (NSInteger)(sequence - position);
+
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&_enqueuePosition, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) return NO;
+        else position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+    }
+
+    slot->entry = (void *)CFBridgingRetain(entry);
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+
+    return YES;
+}
+
+- (PNLogEntry *)dequeueEntry {
+    NSUInteger position = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+    PNLogRingBufferSlot *slot = &_slots[position & _mask];
+    NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+    // Slot is free or producer reserved it but hasn't stored entry yet.
+    if (sequence != position + 1) return nil;
+
+    PNLogEntry *entry = CFBridgingRelease(slot->entry);
+    slot->entry = NULL;
+    atomic_store_explicit(&slot->sequence, position + _capacity, memory_order_release);
+    atomic_store_explicit(&_dequeuePosition, position + 1, memory_order_relaxed);
+
+    return entry;
+}
+
+#pragma mark -
+
+
+@end
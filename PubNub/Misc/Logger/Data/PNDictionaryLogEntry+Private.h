@@ -23,6 +23,17 @@ NS_ASSUME_NONNULL_BEGIN
                          details:(nullable NSString *)details
                        operation:(PNLogMessageOperation)operation;
 
+/// Create `dictionary` log entry with lazily composed message.
+///
+/// - Parameters:
+///   - factory: `NSDictionary` factory block which will be called on first ``message`` access.
+///   - details: Additional details which describe data in a provided object.
+///   - operation: Operation for which ``message`` has been created.
+/// - Returns: Ready-to-use log entry object.
++ (instancetype)entryWithMessageFactory:(NSDictionary * (^)(void))factory
+                                details:(nullable NSString *)details
+                              operation:(PNLogMessageOperation)operation;
+
 #pragma mark -
 
 
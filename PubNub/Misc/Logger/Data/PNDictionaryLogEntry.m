@@ -23,6 +23,16 @@
     return entry;
 }
 
++ (instancetype)entryWithMessageFactory:(NSDictionary * (^)(void))factory
+                                details:(NSString *)details
+                              operation:(PNLogMessageOperation)operation {
+    PNDictionaryLogEntry *entry = [[self alloc] initWithMessageType:PNObjectLogMessageType messageFactory:factory];
+    entry.operation = operation;
+    entry.details = details;
+    
+    return entry;
+}
+
 #pragma mark -
 
 
@@ -56,5 +56,12 @@ static BOOL const kPNDefaultShouldKeepTimeTokenOnListChange = YES;
 static BOOL const kPNDefaultShouldTryCatchUpOnSubscriptionRestore = YES;
 static BOOL const kPNDefaultRequestMessageCountThreshold = 0;
 static NSUInteger const kPNDefaultMaximumMessagesCacheSize = 100;
+static NSUInteger const kPNDefaultMaximumServiceConnections = 3;
+static BOOL const kPNDefaultShouldMultiplexRequests = NO;
+static BOOL const kPNDefaultShouldShareConnectionPool = NO;
+static NSUInteger const kPNDefaultMaximumInFlightPublishRequests = 0;
+static NSUInteger const kPNDefaultMaximumInFlightPublishRequestsPerChannel = 1;
+static NSUInteger const kPNDefaultMaximumPublishQueueLength = 1000;
+static NSUInteger const kPNDefaultLogEntriesBufferSize = 1024;
 
 #endif // PNConstants_h
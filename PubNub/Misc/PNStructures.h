@@ -19,7 +19,7 @@
 @class PNPresenceChannelHereNowResult, PNPresenceGlobalHereNowResult, PNAPNSEnabledChannelsResult;
 @class PNChannelGroupChannelsResult, PNPresenceWhereNowResult, PNChannelClientStateResult;
 @class PNClientStateGetResult, PNClientStateUpdateStatus, PNAcknowledgmentStatus;
-@class PNMessageCountResult, PNHistoryResult, PNAPICallBuilder;
+@class PNMessageCountResult, PNHistoryResult, PNHistoryBackfillProgress, PNAPICallBuilder;
 @class PNPublishStatus, PNSignalStatus, PNErrorStatus, PNStatus, PNTimeResult, PNOperationResult;
 @class PNSetUUIDMetadataStatus, PNFetchUUIDMetadataResult, PNFetchAllUUIDMetadataResult;
 @class PNSetChannelMetadataStatus, PNFetchChannelMetadataResult, PNFetchAllChannelsMetadataResult;
@@ -135,6 +135,27 @@ typedef void(^PNMessageDeleteCompletionBlock)(PNAcknowledgmentStatus *status);
 typedef void(^PNMessageCountCompletionBlock)(PNMessageCountResult * _Nullable result,
                                              PNErrorStatus * _Nullable status);
 
+/**
+ * @brief History backfill window batch handler block.
+ *
+ * @param messages List of window messages sorted by \c timetoken. Each message has \c channel key with name of
+ * channel from which it has been fetched.
+ * @param progress Object with information about backfill progress (including resume token).
+ * @param stop Pointer to the flag which can be set to \c YES to stop backfill.
+ */
+typedef void(^PNHistoryBackfillBatchBlock)(NSArray<NSDictionary *> *messages,
+                                           PNHistoryBackfillProgress *progress,
+                                           BOOL *stop);
+
+/**
+ * @brief History backfill completion handler block.
+ *
+ * @param progress Object with information about backfill progress (including resume token).
+ * @param status Object with information about \c fetch \c history request error.
+ */
+typedef void(^PNHistoryBackfillCompletionBlock)(PNHistoryBackfillProgress *progress,
+                                                PNErrorStatus * _Nullable status);
+
 
 #pragma mark - Completion blocks :: Objects
 
@@ -262,6 +283,26 @@ typedef void(^PNManageChannelMembersCompletionBlock)(PNManageChannelMembersStatu
 typedef void(^PNFetchChannelMembersCompletionBlock)(PNFetchChannelMembersResult * _Nullable result,
                                                     PNErrorStatus * _Nullable status);
 
+/**
+ * @brief \c App \c Context \c objects \c stream batch handler block.
+ *
+ * @param objects List of objects from fetched page.
+ * @param stop Pointer to the flag which can be set to \c YES to stop streaming.
+ *
+ * @since 7.1.0
+ */
+typedef void(^PNObjectsStreamBatchBlock)(NSArray *objects, BOOL *stop);
+
+/**
+ * @brief \c App \c Context \c objects \c stream completion handler block.
+ *
+ * @param count Total number of objects which has been passed to the batch handler block.
+ * @param status Object with information about page \c fetch request error.
+ *
+ * @since 7.1.0
+ */
+typedef void(^PNObjectsStreamCompletionBlock)(NSUInteger count, PNErrorStatus * _Nullable status);
+
 
 #pragma mark - Completion blocks :: Files
 
@@ -926,6 +967,14 @@ typedef NS_ENUM(NSInteger, PNStatusCategory) {
      * @brief Looks like \b PubNub client wasn't able to download requested file.
      */
     PNDownloadErrorCategory,
+
+    /**
+     * @brief Publish request has been rejected because client-side publish queue is full.
+     *
+     * @discussion In case if this status arrive, publish should be retried after some of previously queued publish
+     * requests complete.
+     */
+    PNPublishQueueFullCategory,
 };
 
 /**
@@ -65,6 +65,79 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)client:(PubNub *)client didReceiveFileEvent:(PNFileEventResult *)event;
 
 
+#pragma mark - Batched Message, Actions, Signals and Events handler callbacks
+
+/// New real-time messages callback.
+///
+/// All messages from single subscribe response delivered with one call in order in which they have been received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceiveMessage:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - messages: List of instances which store message information in `data` property.
+- (void)client:(PubNub *)client didReceiveMessages:(NSArray<PNMessageResult *> *)messages;
+
+/// New real-time signals callback.
+///
+/// All signals from single subscribe response delivered with one call in order in which they have been received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceiveSignal:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - signals: List of instances which store signal information in `data` property.
+- (void)client:(PubNub *)client didReceiveSignals:(NSArray<PNSignalResult *> *)signals;
+
+/// New message reactions callback.
+///
+/// All message reactions from single subscribe response delivered with one call in order in which they have been
+/// received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceiveMessageAction:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - actions: List of instances which store `action` information in `data` property.
+- (void)client:(PubNub *)client didReceiveMessageActions:(NSArray<PNMessageActionResult *> *)actions;
+
+/// Channels' presence changes callback.
+///
+/// All presence events from single subscribe response delivered with one call in order in which they have been
+/// received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceivePresenceEvent:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - events: List of instances which store presence event information in `data` property.
+- (void)client:(PubNub *)client didReceivePresenceEvents:(NSArray<PNPresenceEventResult *> *)events;
+
+/// App Context objects state updates callback.
+///
+/// All App Context events from single subscribe response delivered with one call in order in which they have been
+/// received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceiveObjectEvent:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - events: List of instances which store information about received events from Objects API use.
+- (void)client:(PubNub *)client didReceiveObjectEvents:(NSArray<PNObjectEventResult *> *)events;
+
+/// File sharing events callback.
+///
+/// All file sharing events from single subscribe response delivered with one call in order in which they have been
+/// received.
+///
+/// > Note: Listener which implements this method won't receive ``client:didReceiveFileEvent:`` calls.
+///
+/// - Parameters:
+///   - client: **PubNub** client which triggered this callback method call.
+///   - events: List of instances which store information about received events from File API use.
+- (void)client:(PubNub *)client didReceiveFileEvents:(NSArray<PNFileEventResult *> *)events;
+
+
 #pragma mark - Status change handler.
 
 /// Subscription state changes callback.
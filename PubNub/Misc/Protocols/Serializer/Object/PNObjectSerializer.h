@@ -57,6 +57,28 @@ NS_ASSUME_NONNULL_BEGIN
               withAdditional:(nullable NSDictionary *)additionalData
                        error:(NSError * _Nullable *)error;
 
+
+@optional
+
+/// De-serialize `data` and populate it to instance of specified class with shared JSON object.
+///
+/// Allows decoding same service response into different classes (for example, result data and error data) while
+/// response body parsed only once.
+///
+/// - Parameters:
+///   - aClass: Expected class of de-serialized object.
+///   - data: JSON data which should be de-serialized.
+///   - object: Pointer to the JSON object parsed from `data`. If it points to `nil`, `data` will be parsed and
+///   resulting object stored by pointer for next calls.
+///   - additionalData: Additional information which can be used by `aClass` custom initializer.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: De-serialized object, or `nil` in case of decoding failure.
+- (nullable id)objectOfClass:(Class)aClass
+                    fromData:(NSData *)data
+                  jsonObject:(id _Nullable * _Nonnull)object
+              withAdditional:(nullable NSDictionary *)additionalData
+                       error:(NSError * _Nullable *)error;
+
 #pragma mark -
 
 
@@ -15,6 +15,17 @@ NS_ASSUME_NONNULL_BEGIN
 @interface PNAESCBCCryptor : NSObject <PNCryptor>
 
 
+#pragma mark - Properties
+
+/// Length of source data chunks which is processed at once during stream _encryption_ and _decryption_.
+///
+/// Larger chunks reduce per-chunk processing overhead for large files, while smaller chunks keep memory usage low.
+/// Value will be clamped to the range from `64 KB` to `1 MB`.
+///
+/// **Default:** `64 KB`.
+@property(nonatomic, assign) NSUInteger streamChunkLength;
+
+
 #pragma mark - Initialization and configuration
 
 /// Create AES-256-CBC cryptor instance.
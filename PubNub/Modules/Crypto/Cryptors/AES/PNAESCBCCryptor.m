@@ -12,6 +12,17 @@
 /// C identifier for legacy cryptors.
 static NSData *kPNAESCBCCryptorIdentifier;
 
+/// Minimum length of stream data chunk which is processed at once.
+static NSUInteger const kPNAESCBCCryptorMinimumStreamChunkLength = 64 * 1024;
+
+/// Maximum length of stream data chunk which is processed at once.
+static NSUInteger const kPNAESCBCCryptorMaximumStreamChunkLength = 1024 * 1024;
+
+/// Maximum number of bytes by which processed stream chunk can be larger than source chunk.
+///
+/// Cryptor may emit block which has been buffered from previous chunk and padding block at the end of stream.
+static NSUInteger const kPNAESCBCCryptorStreamChunkOverhead = kCCBlockSizeAES128 * 2;
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -48,6 +59,15 @@ NS_ASSUME_NONNULL_BEGIN
        randomInitializationVector:(BOOL)useRandomInitializationVector;
 
 
+#pragma mark - Stream processing
+
+/// Create stream data chunks processing block.
+///
+/// - Parameter wrapper: Cryptor which should be used to process stream data chunks.
+/// - Returns: Block for in-place stream data chunks processing.
+- (PNCryptorInputStreamChunkInPlaceProcessingBlock)processingBlockForWrapper:(PNCCCryptorWrapper *)wrapper;
+
+
 #pragma mark - Helpers
 
 /// Initialization vector which should be used for data _encryption_.
@@ -73,6 +93,11 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Information
 
+- (void)setStreamChunkLength:(NSUInteger)streamChunkLength {
+    _streamChunkLength = MIN(MAX(streamChunkLength, kPNAESCBCCryptorMinimumStreamChunkLength),
+                             kPNAESCBCCryptorMaximumStreamChunkLength);
+}
+
 - (NSData *)identifier {
     return kPNAESCBCCryptorIdentifier;
 }
@@ -97,14 +122,21 @@ NS_ASSUME_NONNULL_END
 - (instancetype)initWithCipherKey:(NSString *)cipherKey randomInitializationVector:(BOOL)useRandomInitializationVector {
     if ((self = [super init])) {
         if (!useRandomInitializationVector) _initializationVector = [NSData dataWithBytes:"0123456789012345" length:16];
+        _streamChunkLength = kPNAESCBCCryptorMinimumStreamChunkLength;
         _useRandomIV = useRandomInitializationVector;
         _cipherKey = [self digestForKey:cipherKey];
         _cipherKeyString = [cipherKey copy];
+
+        [PNCCCryptorWrapper retainContextsForCipherKey:_cipherKey];
     }
     
     return self;
 }
 
+- (void)dealloc {
+    [PNCCCryptorWrapper releaseContextsForCipherKey:_cipherKey];
+}
+
 
 #pragma mark - Data processing
 
@@ -184,8 +216,9 @@ NS_ASSUME_NONNULL_END
     PNCryptorInputStream *cryptorStream = nil;
     cryptorStream = [PNCryptorInputStream inputStreamWithInputStream:stream
                                                           dataLength:length
-                                                         chunkLength:kCCBlockSizeAES128
-                                                     processingBlock:[self processingBlockForWrapper:wrapper.data]];
+                                                         chunkLength:self.streamChunkLength
+                                                      outputOverhead:kPNAESCBCCryptorStreamChunkOverhead
+                                              inPlaceProcessingBlock:[self processingBlockForWrapper:wrapper.data]];
 
     NSData *metadata = initializationVector;
     NSUInteger encryptedDataLength = [wrapper.data processedDataLength:length];
@@ -226,16 +259,29 @@ NS_ASSUME_NONNULL_END
     PNCryptorInputStream *cryptorStream = nil;
     cryptorStream = [PNCryptorInputStream inputStreamWithInputStream:stream.stream
                                                           dataLength:stream.stream.inputDataLength
-                                                         chunkLength:kCCBlockSizeAES128
-                                                     processingBlock:[self processingBlockForWrapper:wrapper.data]];
+                                                         chunkLength:self.streamChunkLength
+                                                      outputOverhead:kPNAESCBCCryptorStreamChunkOverhead
+                                              inPlaceProcessingBlock:[self processingBlockForWrapper:wrapper.data]];
 
     return [PNResult resultWithData:cryptorStream error:nil];
 }
 
 
-- (PNCryptorInputStreamChunkProcessingBlock)processingBlockForWrapper:(PNCCCryptorWrapper *)wrapper {
-    return ^PNResult<NSData *> *(uint8_t *buffer, NSUInteger bufferLength, BOOL finalyze) {
-        return [wrapper processDataFromDataChunk:buffer withLength:bufferLength andFinalised:finalyze];
+- (PNCryptorInputStreamChunkInPlaceProcessingBlock)processingBlockForWrapper:(PNCCCryptorWrapper *)wrapper {
+    return ^NSInteger(const uint8_t *buffer,
+                      NSUInteger bufferLength,
+                      uint8_t *outputBuffer,
+                      NSUInteger outputBufferLength,
+                      BOOL finalyze,
+                      NSError **error) {
+        NSInteger processedLength = [wrapper processDataFromDataChunk:buffer
+                                                           withLength:bufferLength
+                                                             toBuffer:outputBuffer
+                                                         bufferLength:outputBufferLength
+                                                         andFinalised:finalyze];
+        if (processedLength < 0) *error = wrapper.error;
+
+        return processedLength;
     };
 }
 
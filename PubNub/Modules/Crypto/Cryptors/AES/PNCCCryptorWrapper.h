@@ -39,6 +39,23 @@ NS_ASSUME_NONNULL_BEGIN
                                             initializationVector:(NSData *)initializationVector;
 
 
+#pragma mark - Contexts pool
+
+/// Allow reuse of cryptor contexts created for cipher key.
+///
+/// Idle cryptor contexts for `cipherKey` are kept in shared pool only while it is retained by at least one user.
+///
+/// - Parameter cipherKey: Key which will be used to process data.
++ (void)retainContextsForCipherKey:(NSData *)cipherKey;
+
+/// Release idle cryptor contexts created for cipher key.
+///
+/// Idle cryptor contexts for `cipherKey` will be destroyed when the last user releases it.
+///
+/// - Parameter cipherKey: Key which has been used to process data.
++ (void)releaseContextsForCipherKey:(NSData *)cipherKey;
+
+
 #pragma mark - Data processing
 
 /// Process provided data using configured cryptor.
@@ -50,10 +67,36 @@ NS_ASSUME_NONNULL_BEGIN
 - (PNResult<NSData *> *)processedDataFrom:(NSData *)sourceData;
 
 
+/// Process chunk of data using configured cryptor.
+///
+/// - Parameters:
+///   - dataChunk: Pointer to the chunk of source data.
+///   - length: Length of source data chunk.
+///   - finalised: Whether this is last chunk and cryptor should flush rest of data or not.
+/// - Returns: Cryptor data chunk processing outcome.
 - (PNResult<NSData *> *)processDataFromDataChunk:(uint8_t *)dataChunk
                                       withLength:(NSUInteger)length
                                     andFinalised:(BOOL)finalised;
 
+/// Process chunk of data using configured cryptor into provided buffer.
+///
+/// Processed data written directly into `buffer`, so same buffer can be reused for multiple chunks.
+///
+/// > Note: Required `buffer` length can be calculated with ``outputLengthForDataLength:finalised:``.
+///
+/// - Parameters:
+///   - dataChunk: Pointer to the chunk of source data.
+///   - length: Length of source data chunk.
+///   - buffer: Buffer into which processed data should be written.
+///   - bufferLength: Length of provided `buffer`.
+///   - finalised: Whether this is last chunk and cryptor should flush rest of data or not.
+/// - Returns: Number of bytes written into `buffer` or `-1` in case of processing error (details in ``error``).
+- (NSInteger)processDataFromDataChunk:(const uint8_t *)dataChunk
+                           withLength:(NSUInteger)length
+                             toBuffer:(uint8_t *)buffer
+                         bufferLength:(NSUInteger)bufferLength
+                         andFinalised:(BOOL)finalised;
+
 
 #pragma mark - Helpers
 
@@ -63,6 +106,14 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Returns: Fully processed data length.
 - (NSUInteger)processedDataLength:(NSUInteger)length;
 
+/// Calculate maximum length of data which can be produced by cryptor for data chunk.
+///
+/// - Parameters:
+///   - length: Length of source data chunk.
+///   - finalised: Whether this is last chunk or not.
+/// - Returns: Maximum processed data chunk length.
+- (NSUInteger)outputLengthForDataLength:(NSUInteger)length finalised:(BOOL)finalised;
+
 #pragma mark -
 
 
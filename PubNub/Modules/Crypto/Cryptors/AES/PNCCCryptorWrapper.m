@@ -1,9 +1,20 @@
 #import "PNCCCryptorWrapper.h"
 #import <CommonCrypto/CommonCryptor.h>
+#import <CommonCrypto/CommonDigest.h>
 #import <CommonCrypto/CommonHMAC.h>
+#import "PNLockSupport.h"
 #import "PNError.h"
 
 
+#pragma mark Static
+
+/// Maximum number of idle cryptor contexts which can be kept for single cipher key and operation.
+static NSUInteger const kPNCCCryptorWrapperMaximumIdleContexts = 4;
+
+/// Maximum number of cipher key and operation pairs for which idle cryptor contexts can be kept.
+static NSUInteger const kPNCCCryptorWrapperMaximumContextPools = 16;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Private interface declaration
@@ -23,6 +34,16 @@ NS_ASSUME_NONNULL_BEGIN
 /// `CCCryptor` which should be used for data processing.
 @property (nonatomic, assign) CCCryptorRef cryptor;
 
+/// Key of idle cryptor contexts pool to which `cryptor` should be returned when wrapper not needed anymore.
+///
+/// Key is built from cipher key digest, so raw key material never stored in shared pool.
+@property (nonatomic, nullable, strong) NSData *contextPoolKey;
+
+/// Whether all data has been processed and `cryptor` finalized or not.
+///
+/// Only finalized cryptor contexts can be reused.
+@property (nonatomic, assign, getter = isFinalised) BOOL finalised;
+
 
 #pragma mark - Initialization and configuration
 
@@ -38,6 +59,58 @@ NS_ASSUME_NONNULL_BEGIN
                                            forOperation:(CCOperation)operation;
 
 
+#pragma mark - Contexts pool
+
+/// Shared idle cryptor contexts pool.
+///
+/// Creation of `CCCryptor` require key schedule computation for cipher key. Finalized cryptor contexts stored in
+/// pool, so they can be reset with new initialization vector instead of creation of new context for same cipher key.
+///
+/// - Parameter block: Block which should be called with pool and cipher key digests usage while access lock acquired.
++ (void)accessContextsPoolWithBlock:(void(^)(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                             NSCountedSet<NSData *> *usage))block;
+
+/// Create identifier of idle cryptor contexts pool.
+///
+/// - Parameters:
+///   - cipherKey: Key which is used by cryptor to process data.
+///   - operation: Operation for which cryptor has been configured: `kCCEncrypt` or `kCCDecrypt`.
+/// - Returns: Idle cryptor contexts pool identifier.
++ (NSData *)contextPoolKeyForCipherKey:(NSData *)cipherKey operation:(CCOperation)operation;
+
+/// Create cipher key digest.
+///
+/// - Parameter cipherKey: Key which is used by cryptor to process data.
+/// - Returns: SHA-256 digest of `cipherKey`.
++ (NSData *)digestForCipherKey:(NSData *)cipherKey;
+
+/// Create cipher key digest from idle cryptor contexts pool identifier.
+///
+/// - Parameter poolKey: Idle cryptor contexts pool identifier.
+/// - Returns: SHA-256 digest of cipher key for which pool has been created.
++ (NSData *)digestForContextPoolKey:(NSData *)poolKey;
+
+/// Release idle cryptor contexts from list.
+///
+/// - Parameter contexts: List of idle cryptor contexts which should be released.
++ (void)releaseContexts:(nullable NSArray<NSValue *> *)contexts;
+
+/// Retrieve idle cryptor context from pool.
+///
+/// - Parameter poolKey: Idle cryptor contexts pool identifier.
+/// - Returns: Idle cryptor context or `NULL` if there is no contexts in pool.
++ (nullable CCCryptorRef)dequeueContextFromPoolWithKey:(NSData *)poolKey;
+
+/// Return cryptor context to the pool.
+///
+/// Cryptor context will be released if pool is full or cipher key not used anymore.
+///
+/// - Parameters:
+///   - cryptor: Finalized cryptor context which can be reused.
+///   - poolKey: Idle cryptor contexts pool identifier.
++ (void)enqueueContext:(CCCryptorRef)cryptor toPoolWithKey:(NSData *)poolKey;
+
+
 #pragma mark - Helpers
 
 /// Create `NSError` from `CCCryptor` processing status.
@@ -83,8 +156,21 @@ NS_ASSUME_NONNULL_END
     CCCryptorStatus status = kCCKeySizeError;
     PNCCCryptorWrapper *wrapper = self;
     NSError *error = nil;
-    
+    self.operation = operation;
+
     if (cipherKey.length) {
+        self.contextPoolKey = [[self class] contextPoolKeyForCipherKey:cipherKey operation:operation];
+        _cryptor = [[self class] dequeueContextFromPoolWithKey:self.contextPoolKey];
+
+        // Reuse existing key schedule with new initialization vector.
+        if (_cryptor != NULL && CCCryptorReset(_cryptor, initializationVector.bytes) != kCCSuccess) {
+            CCCryptorRelease(_cryptor);
+            _cryptor = NULL;
+        }
+    }
+
+    if (_cryptor != NULL) status = kCCSuccess;
+    else if (cipherKey.length) {
         status = CCCryptorCreate(operation,
                                  kCCAlgorithmAES128,
                                  kCCOptionPKCS7Padding,
@@ -130,6 +216,7 @@ NS_ASSUME_NONNULL_END
                                 estimatedResultLength - processedDataLength,
                                 &finalisedDataLength);
         processedData.length = processedDataLength + finalisedDataLength;
+        self.finalised = status == kCCSuccess;
     } else {
         error = [[self class] errorFromCryptorStatus:status andOperation:self.operation];
     }
@@ -141,36 +228,168 @@ NS_ASSUME_NONNULL_END
                                       withLength:(NSUInteger)length
                                     andFinalised:(BOOL)finalised {
     if (self.error) return [PNResult resultWithData:nil error:self.error];
-    NSUInteger bufferSize = CCCryptorGetOutputLength(self.cryptor, length, finalised);
+    NSUInteger bufferSize = [self outputLengthForDataLength:length finalised:finalised];
     NSMutableData *processedData = [NSMutableData dataWithLength:bufferSize];
+    NSInteger processedLength = [self processDataFromDataChunk:dataChunk
+                                                    withLength:length
+                                                      toBuffer:processedData.mutableBytes
+                                                  bufferLength:bufferSize
+                                                  andFinalised:finalised];
+    processedData.length = processedLength > 0 ? (NSUInteger)processedLength : 0;
+
+    return [PNResult resultWithData:processedData error:self.error];
+}
+
+- (NSInteger)processDataFromDataChunk:(const uint8_t *)dataChunk
+                           withLength:(NSUInteger)length
+                             toBuffer:(uint8_t *)buffer
+                         bufferLength:(NSUInteger)bufferLength
+                         andFinalised:(BOOL)finalised {
+    if (self.error) return -1;
     CCCryptorStatus status = kCCParamError;
     size_t processedLength = 0;
 
     if (length == 0) status = kCCSuccess;
-    else {
-        status = CCCryptorUpdate(self.cryptor,
-                                 dataChunk,
-                                 length,
-                                 processedData.mutableBytes,
-                                 bufferSize,
-                                 &processedLength);
-    }
+    else status = CCCryptorUpdate(self.cryptor, dataChunk, length, buffer, bufferLength, &processedLength);
 
     if (status == kCCSuccess && finalised) {
         size_t finalLength = 0;
-        status = CCCryptorFinal(self.cryptor,
-                                processedData.mutableBytes + processedLength,
-                                bufferSize - processedLength,
-                                &finalLength);
+        status = CCCryptorFinal(self.cryptor, buffer + processedLength, bufferLength - processedLength, &finalLength);
+        self.finalised = status == kCCSuccess;
         processedLength += finalLength;
     }
 
     if (status != kCCSuccess) {
         self.error = [[self class] errorFromCryptorStatus:status andOperation:self.operation];
+        return -1;
     }
-    processedData.length = processedLength;
 
-    return [PNResult resultWithData:processedData error:self.error];
+    return (NSInteger)processedLength;
+}
+
+
+#pragma mark - Contexts pool
+
++ (void)retainContextsForCipherKey:(NSData *)cipherKey {
+    if (!cipherKey.length) return;
+
+    NSData *digest = [self digestForCipherKey:cipherKey];
+    [self accessContextsPoolWithBlock:^(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                        NSCountedSet<NSData *> *usage) {
+        [usage addObject:digest];
+    }];
+}
+
++ (void)releaseContextsForCipherKey:(NSData *)cipherKey {
+    if (!cipherKey.length) return;
+
+    NSData *encryptPoolKey = [self contextPoolKeyForCipherKey:cipherKey operation:kCCEncrypt];
+    NSData *decryptPoolKey = [self contextPoolKeyForCipherKey:cipherKey operation:kCCDecrypt];
+    NSData *digest = [self digestForContextPoolKey:encryptPoolKey];
+    NSMutableArray<NSValue *> *releasedContexts = [NSMutableArray new];
+
+    [self accessContextsPoolWithBlock:^(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                        NSCountedSet<NSData *> *usage) {
+        [usage removeObject:digest];
+        if ([usage countForObject:digest] > 0) return;
+
+        for (NSData *poolKey in @[encryptPoolKey, decryptPoolKey]) {
+            if (pool[poolKey]) [releasedContexts addObjectsFromArray:pool[poolKey]];
+            [pool removeObjectForKey:poolKey];
+        }
+    }];
+
+    [self releaseContexts:releasedContexts];
+}
+
++ (void)accessContextsPoolWithBlock:(void(^)(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                             NSCountedSet<NSData *> *usage))block {
+    static NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *_contextsPool;
+    static NSCountedSet<NSData *> *_cipherKeysUsage;
+    static pthread_mutex_t _contextsPoolLock;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        pthread_mutex_init(&_contextsPoolLock, nil);
+        _contextsPool = [NSMutableDictionary new];
+        _cipherKeysUsage = [NSCountedSet new];
+    });
+
+    pn_lock(&_contextsPoolLock, ^{
+        block(_contextsPool, _cipherKeysUsage);
+    });
+}
+
++ (NSData *)contextPoolKeyForCipherKey:(NSData *)cipherKey operation:(CCOperation)operation {
+    NSMutableData *poolKey = [[self digestForCipherKey:cipherKey] mutableCopy];
+    uint8_t operationType = (uint8_t)operation;
+    [poolKey appendBytes:&operationType length:1];
+
+    return poolKey;
+}
+
++ (NSData *)digestForCipherKey:(NSData *)cipherKey {
+    NSMutableData *digest = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(cipherKey.bytes, (CC_LONG)cipherKey.length, digest.mutableBytes);
+
+    return digest;
+}
+
++ (NSData *)digestForContextPoolKey:(NSData *)poolKey {
+    return [poolKey subdataWithRange:NSMakeRange(0, CC_SHA256_DIGEST_LENGTH)];
+}
+
++ (void)releaseContexts:(NSArray<NSValue *> *)contexts {
+    for (NSValue *context in contexts) CCCryptorRelease((CCCryptorRef)context.pointerValue);
+}
+
++ (CCCryptorRef)dequeueContextFromPoolWithKey:(NSData *)poolKey {
+    __block CCCryptorRef cryptor = NULL;
+
+    [self accessContextsPoolWithBlock:^(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                        NSCountedSet<NSData *> *usage) {
+        NSMutableArray<NSValue *> *contexts = pool[poolKey];
+        if (contexts.count == 0) return;
+
+        cryptor = (CCCryptorRef)contexts.lastObject.pointerValue;
+        [contexts removeLastObject];
+    }];
+
+    return cryptor;
+}
+
++ (void)enqueueContext:(CCCryptorRef)cryptor toPoolWithKey:(NSData *)poolKey {
+    __block CCCryptorRef releasedCryptor = cryptor;
+    __block NSArray<NSValue *> *evictedContexts = nil;
+    NSData *digest = [self digestForContextPoolKey:poolKey];
+
+    [self accessContextsPoolWithBlock:^(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                        NSCountedSet<NSData *> *usage) {
+        // Contexts kept only while there is a cryptor which use cipher key.
+        if ([usage countForObject:digest] == 0) return;
+
+        NSMutableArray<NSValue *> *contexts = pool[poolKey];
+
+        if (!contexts) {
+            // Drop contexts of some other cipher key to keep number of stored key schedules bounded.
+            if (pool.count >= kPNCCCryptorWrapperMaximumContextPools) {
+                NSData *evictedPoolKey = pool.keyEnumerator.nextObject;
+                evictedContexts = pool[evictedPoolKey];
+                [pool removeObjectForKey:evictedPoolKey];
+            }
+
+            contexts = [NSMutableArray arrayWithCapacity:kPNCCCryptorWrapperMaximumIdleContexts];
+            pool[poolKey] = contexts;
+        }
+
+        if (contexts.count < kPNCCCryptorWrapperMaximumIdleContexts) {
+            [contexts addObject:[NSValue valueWithPointer:cryptor]];
+            releasedCryptor = NULL;
+        }
+    }];
+
+    [self releaseContexts:evictedContexts];
+    if (releasedCryptor != NULL) CCCryptorRelease(releasedCryptor);
 }
 
 
@@ -180,6 +399,10 @@ NS_ASSUME_NONNULL_END
     return CCCryptorGetOutputLength(self.cryptor, length, true);
 }
 
+- (NSUInteger)outputLengthForDataLength:(NSUInteger)length finalised:(BOOL)finalised {
+    return CCCryptorGetOutputLength(self.cryptor, length, finalised);
+}
+
 + (NSError *)errorFromCryptorStatus:(CCCryptorStatus)status andOperation:(CCOperation)operation {
     NSInteger errorCode = PNErrorUnknown;
     NSString *description = @"Unknown error";
@@ -219,7 +442,12 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Misc
 
 - (void)dealloc {
-    if (_cryptor) CCCryptorRelease(_cryptor);
+    if (_cryptor && _finalised && !_error && _contextPoolKey) {
+        [[self class] enqueueContext:_cryptor toPoolWithKey:_contextPoolKey];
+    } else if (_cryptor) {
+        CCCryptorRelease(_cryptor);
+    }
+
     _cryptor = NULL;
 }
 
@@ -18,6 +18,27 @@ typedef PNResult<NSData*>* _Nonnull (^PNCryptorInputStreamChunkProcessingBlock)(
                                                                                 NSUInteger bufferLength,
                                                                                 BOOL finalyze);
 
+/// The in-place processing block for the input stream data chunks.
+///
+/// Block should write processed data directly into provided output buffer, which let stream reuse buffers between
+/// chunks.
+///
+/// - Parameters:
+///   - buffer: A buffer containing a chunk of data (_raw_ or _encrypted_) for processing (_encryption_ or _decryption_).
+///   - bufferLength: The length of the buffer that has been provided with a chunk of data.
+///   - outputBuffer: A buffer into which processed data should be written.
+///   - outputBufferLength: Maximum number of bytes which can be written into `outputBuffer`.
+///   - finalyze: Whether this is a final call or not. For the final call, there can be no data in the buffer for
+///   processing, but the rest of the data in cryptor should be flushed.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: Number of bytes written into `outputBuffer` or `-1` in case of processing error.
+typedef NSInteger (^PNCryptorInputStreamChunkInPlaceProcessingBlock)(const uint8_t *buffer,
+                                                                     NSUInteger bufferLength,
+                                                                     uint8_t *outputBuffer,
+                                                                     NSUInteger outputBufferLength,
+                                                                     BOOL finalyze,
+                                                                     NSError * _Nullable * _Nonnull error);
+
 
 #pragma mark - Interface declaration
 
@@ -50,6 +71,26 @@ typedef PNResult<NSData*>* _Nonnull (^PNCryptorInputStreamChunkProcessingBlock)(
                                chunkLength:(NSUInteger)chunkLength
                            processingBlock:(PNCryptorInputStreamChunkProcessingBlock)block;
 
+/// Create buffered cryptor input stream.
+///
+/// Stream reads source data in large chunks into reusable buffer and let processing block write processed data
+/// directly into the reader's buffer (when there is enough space) or into reusable output buffer.
+///
+/// - Parameters:
+///   - stream: Input stream with data for processing (_encryption_ or _decryption_).
+///   - length: Length of data in provided stream.
+///   - chunkLength: Length of source data chunks which will be passed to the processing block (at final reads it _can_
+///   be smaller).
+///   - overhead: Maximum number of bytes by which processed chunk can be larger than source chunk (padding and data
+///   buffered by cryptor).
+///   - block: Block for input stream data chunks in-place processing.
+/// - Returns: Initialized cryptor input stream.
++ (instancetype)inputStreamWithInputStream:(NSInputStream *)stream
+                                dataLength:(NSUInteger)length
+                               chunkLength:(NSUInteger)chunkLength
+                            outputOverhead:(NSUInteger)overhead
+                    inPlaceProcessingBlock:(PNCryptorInputStreamChunkInPlaceProcessingBlock)block;
+
 #pragma mark -
 
 
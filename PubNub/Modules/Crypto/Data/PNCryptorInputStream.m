@@ -14,7 +14,10 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark - Properties
 
 /// Block for input stream data chunks processing.
-@property(nonatomic, readonly, copy) PNCryptorInputStreamChunkProcessingBlock processingBlock;
+@property(nonatomic, nullable, readonly, copy) PNCryptorInputStreamChunkProcessingBlock processingBlock;
+
+/// Block for input stream data chunks in-place processing.
+@property(nonatomic, nullable, readonly, copy) PNCryptorInputStreamChunkInPlaceProcessingBlock inPlaceProcessingBlock;
 
 /// Whether cryptor input stream in the mode for data processing with cryptor or not.
 @property(nonatomic, assign, getter=isProcessingWithCryptor) BOOL processingWithCryptor;
@@ -29,6 +32,16 @@ NS_ASSUME_NONNULL_BEGIN
 /// Used to store processed data until next `read` method call with _fresh_ buffer.
 @property(nonatomic, nullable, strong) NSData *processedDataBuffer;
 
+/// Reusable source data chunk buffer.
+///
+/// Used only with in-place processing block.
+@property(nonatomic, nullable, strong) NSMutableData *inputBuffer;
+
+/// Reusable processed data chunk buffer.
+///
+/// Used only with in-place processing block, when reader's buffer is too small to receive whole processed chunk.
+@property(nonatomic, nullable, strong) NSMutableData *outputBuffer;
+
 /// Input stream with data for processing (_encryption_ or _decryption_).
 @property(nonatomic, readonly, strong) NSInputStream *inputStream;
 
@@ -38,6 +51,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Minimum length of chunk which should be passed to processing block.
 @property(nonatomic, readonly, assign) NSUInteger chunkLength;
 
+/// Maximum number of bytes by which processed chunk can be larger than source chunk.
+@property(nonatomic, readonly, assign) NSUInteger outputOverhead;
+
 /// Range of processed data inside of temporary buffer.
 @property (nonatomic, assign) NSRange processedDataRange;
 
@@ -77,6 +93,21 @@ NS_ASSUME_NONNULL_BEGIN
                         chunkLength:(NSUInteger)chunkLength
                     processingBlock:(PNCryptorInputStreamChunkProcessingBlock)block;
 
+/// Init buffered cryptor input stream.
+///
+/// - Parameters:
+///   - stream: Input stream with data for processing (_encryption_ or _decryption_).
+///   - length: Length of data in provided stream.
+///   - chunkLength: Length of source data chunks which will be passed to the processing block.
+///   - overhead: Maximum number of bytes by which processed chunk can be larger than source chunk.
+///   - block: Block for input stream data chunks in-place processing.
+/// - Returns: Initialized cryptor input stream.
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                         dataLength:(NSUInteger)length
+                        chunkLength:(NSUInteger)chunkLength
+                     outputOverhead:(NSUInteger)overhead
+             inPlaceProcessingBlock:(PNCryptorInputStreamChunkInPlaceProcessingBlock)block;
+
 
 #pragma mark - Helpers
 
@@ -87,6 +118,14 @@ NS_ASSUME_NONNULL_BEGIN
 /// - Parameter length: Number of bytes which should be read from `inputStream`.
 - (void)readInputStreamData:(NSUInteger)length;
 
+/// Read specified number of bytes from `inputStream` into provided buffer.
+///
+/// - Parameters:
+///   - length: Number of bytes which should be read from `inputStream`.
+///   - buffer: Buffer into which data should be read.
+/// - Returns: Actual number of bytes which has been read from `inputStream`.
+- (NSUInteger)readInputStreamData:(NSUInteger)length intoBuffer:(uint8_t *)buffer;
+
 /// Check whether it is still possible to read data from `inputStream`.
 ///
 /// In the following cases it is impossible to make further reads:
@@ -99,6 +138,17 @@ NS_ASSUME_NONNULL_BEGIN
 /// Call data chunk processing block on read buffer.
 - (void)processInputStreamBuffer;
 
+/// Read next chunk of data from `inputStream` and process it with in-place processing block.
+///
+/// Processed data written directly into the reader's `buffer` if it is large enough to fit whole processed chunk or
+/// into reusable `outputBuffer` otherwise.
+///
+/// - Parameters:
+///   - buffer: Reader's buffer into which processed data can be written.
+///   - maxLength: Maximum number of bytes that can be written into the buffer.
+/// - Returns: The actual number of bytes that have been written into the reader's buffer.
+- (NSUInteger)processInputStreamChunkIntoBuffer:(uint8_t *)buffer maxLength:(NSUInteger)maxLength;
+
 /// Write previously encrypted data.
 ///
 /// Write temporarily buffered encrypted data into the provided read buffer.
@@ -151,6 +201,18 @@ NS_ASSUME_NONNULL_END
     return [[self alloc] initWithInputStream:stream dataLength:length chunkLength:chunkLength processingBlock:block];
 }
 
++ (instancetype)inputStreamWithInputStream:(NSInputStream *)stream
+                                dataLength:(NSUInteger)length
+                               chunkLength:(NSUInteger)chunkLength
+                            outputOverhead:(NSUInteger)overhead
+                    inPlaceProcessingBlock:(PNCryptorInputStreamChunkInPlaceProcessingBlock)block {
+    return [[self alloc] initWithInputStream:stream
+                                  dataLength:length
+                                 chunkLength:chunkLength
+                              outputOverhead:overhead
+                      inPlaceProcessingBlock:block];
+}
+
 
 - (instancetype)initWithInputStream:(NSInputStream *)stream dataLength:(NSUInteger)length {
     if ((self = [super init])) {
@@ -175,6 +237,22 @@ NS_ASSUME_NONNULL_END
     return self;
 }
 
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                         dataLength:(NSUInteger)length
+                        chunkLength:(NSUInteger)chunkLength
+                     outputOverhead:(NSUInteger)overhead
+             inPlaceProcessingBlock:(PNCryptorInputStreamChunkInPlaceProcessingBlock)block {
+    if ((self = [self initWithInputStream:stream dataLength:length])) {
+        _processedDataRange = NSMakeRange(NSNotFound, 0);
+        _inPlaceProcessingBlock = [block copy];
+        _chunkLength = MAX(chunkLength, 1);
+        _processingWithCryptor = YES;
+        _outputOverhead = overhead;
+    }
+
+    return self;
+}
+
 
 #pragma mark - NSStream
 
@@ -202,6 +280,8 @@ NS_ASSUME_NONNULL_END
 
     self.notProcessedDataBuffer = nil;
     self.processedDataBuffer = nil;
+    self.outputBuffer = nil;
+    self.inputBuffer = nil;
 }
 
 - (void)scheduleInRunLoop:(NSRunLoop *)__unused aRunLoop forMode:(NSRunLoopMode)__unused mode {
@@ -249,12 +329,18 @@ NS_ASSUME_NONNULL_END
     }
     
     while (bytesToRead > 0 && self.streamStatus != NSStreamStatusClosed && self.streamStatus != NSStreamStatusError) {
+        uint8_t *readBuffer = buffer + (length - bytesToRead);
+
         // Read previously encrypted data if possible.
         if ([self hasNotSentData]) {
-            bytesToRead -= [self writeEncryptedDataToBuffer:buffer maxLength:bytesToRead];
+            bytesToRead -= [self writeEncryptedDataToBuffer:readBuffer maxLength:bytesToRead];
         } else if (self.inputDataLength != self.readLength) {
-            [self readInputStreamData:MAX(length, self.chunkLength)];
-            [self processInputStreamBuffer];
+            if (self.inPlaceProcessingBlock) {
+                bytesToRead -= [self processInputStreamChunkIntoBuffer:readBuffer maxLength:bytesToRead];
+            } else {
+                [self readInputStreamData:MAX(length, self.chunkLength)];
+                [self processInputStreamBuffer];
+            }
         } else {
             return length - bytesToRead;
         }
@@ -343,26 +429,41 @@ NS_ASSUME_NONNULL_END
 
 - (void)readInputStreamData:(NSUInteger)length {
     NSMutableData *buffer = [NSMutableData dataWithLength:length];
+    NSUInteger bytesRead = [self readInputStreamData:length intoBuffer:buffer.mutableBytes];
+
+    if (bytesRead > 0) {
+        buffer.length = bytesRead;
+        self.notProcessedDataBuffer = buffer;
+    }
+}
+
+- (NSUInteger)readInputStreamData:(NSUInteger)length intoBuffer:(uint8_t *)buffer {
     NSUInteger bytesToRead = length;
-    
+
     do {
-        NSInteger bytesRead = [self.inputStream read:buffer.mutableBytes + (length - bytesToRead) maxLength:bytesToRead];
-        if (bytesRead >= 0) bytesToRead -= bytesRead;
+        NSInteger bytesRead = [self.inputStream read:buffer + (length - bytesToRead) maxLength:bytesToRead];
+        if (bytesRead <= 0) break;
+        bytesToRead -= bytesRead;
     } while ([self canReadDataFromInputStream] && self.streamStatus != NSStreamStatusClosed && bytesToRead != 0);
 
-    if (bytesToRead != length && self.inputStream.streamError == nil) {
-        NSUInteger bytesRead = length - bytesToRead;
-        buffer.length = bytesRead;
-        self.notProcessedDataBuffer = buffer;
-        self.readLength += bytesRead;
-    } else if (self.inputStream.streamError != nil) {
+    NSUInteger bytesRead = length - bytesToRead;
+
+    if (self.inputStream.streamError != nil) {
         [self setStreamProcessingError:self.inputStream.streamError];
+        return 0;
+    } else if (bytesRead == 0 && length > 0) {
+        // Source stream ended earlier than expected: finalize with data which has been read so far.
+        _inputDataLength = self.readLength;
     }
+
+    self.readLength += bytesRead;
+
+    return bytesRead;
 }
 
 - (BOOL)canReadDataFromInputStream {
     return self.inputStream.streamStatus != NSStreamStatusClosed &&
-        self.inputStream.streamError != nil &&
+        self.inputStream.streamError == nil &&
         self.inputDataLength != self.readLength;
 }
 
@@ -399,15 +500,56 @@ NS_ASSUME_NONNULL_END
     self.notProcessedDataBuffer = nil;
 }
 
+- (NSUInteger)processInputStreamChunkIntoBuffer:(uint8_t *)buffer maxLength:(NSUInteger)maxLength {
+    if (!self.inputBuffer) {
+        NSUInteger bufferLength = MIN(self.chunkLength, self.inputDataLength - self.readLength);
+        self.outputBuffer = [NSMutableData dataWithLength:bufferLength + self.outputOverhead];
+        self.inputBuffer = [NSMutableData dataWithLength:bufferLength];
+    }
+
+    NSUInteger chunkLength = MIN(self.inputBuffer.length, self.inputDataLength - self.readLength);
+    NSUInteger bytesRead = [self readInputStreamData:chunkLength intoBuffer:self.inputBuffer.mutableBytes];
+    if (self.streamStatus == NSStreamStatusError) return 0;
+
+    BOOL finalise = self.inputDataLength == self.readLength;
+    BOOL inPlace = maxLength >= bytesRead + self.outputOverhead;
+    uint8_t *outputBuffer = inPlace ? buffer : self.outputBuffer.mutableBytes;
+    NSUInteger outputBufferLength = inPlace ? maxLength : self.outputBuffer.length;
+    NSError *error = nil;
+
+    NSInteger processedLength = self.inPlaceProcessingBlock(self.inputBuffer.bytes,
+                                                            bytesRead,
+                                                            outputBuffer,
+                                                            outputBufferLength,
+                                                            finalise,
+                                                            &error);
+
+    if (processedLength < 0) {
+        [self setStreamProcessingError:error ?: [NSError errorWithDomain:PNCryptorErrorDomain
+                                                                    code:PNErrorUnknown
+                                                                userInfo:@{
+            NSLocalizedDescriptionKey: @"Unable to process input stream data chunk."
+        }]];
+        return 0;
+    }
+
+    if (inPlace) return (NSUInteger)processedLength;
+
+    self.processedDataRange = NSMakeRange(0, (NSUInteger)processedLength);
+    self.processedDataBuffer = self.outputBuffer;
+
+    return 0;
+}
+
 - (NSUInteger)writeEncryptedDataToBuffer:(uint8_t *)buffer maxLength:(NSUInteger)maxLength {
-    NSInteger bytesToWrite = MIN(maxLength, self.processedDataRange.length);
-    [self.processedDataBuffer getBytes:buffer length:bytesToWrite];
+    NSUInteger bytesToWrite = MIN(maxLength, self.processedDataRange.length);
+    [self.processedDataBuffer getBytes:buffer range:NSMakeRange(self.processedDataRange.location, bytesToWrite)];
     
     if (bytesToWrite == self.processedDataRange.length) {
         self.processedDataRange = NSMakeRange(NSNotFound, 0);
         self.processedDataBuffer = nil;
     } else {
-        self.processedDataRange = NSMakeRange(self.processedDataRange.location,
+        self.processedDataRange = NSMakeRange(self.processedDataRange.location + bytesToWrite,
                                               self.processedDataRange.length - bytesToWrite);
     }
     
@@ -427,6 +569,8 @@ NS_ASSUME_NONNULL_END
 - (void)dealloc {
     _notProcessedDataBuffer = nil;
     _processedDataBuffer = nil;
+    _outputBuffer = nil;
+    _inputBuffer = nil;
 }
 
 #pragma mark -
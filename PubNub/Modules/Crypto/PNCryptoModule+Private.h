@@ -9,6 +9,17 @@ NS_ASSUME_NONNULL_BEGIN
 @interface PNCryptoModule (Private)
 
 
+#pragma mark - Information
+
+/// Check whether module can process data from multiple threads at once.
+///
+/// Only built-in cryptors known to be stateless, so module with custom cryptor should be used from one thread at a
+/// time.
+///
+/// - Returns: `YES` in case if all registered cryptors are ``PNAESCBCCryptor`` or ``PNLegacyCryptor``.
+- (BOOL)isConcurrentProcessingSafe;
+
+
 #pragma mark - Misc
 
 /// Serialize crypto module object.
@@ -262,6 +262,17 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Helpers
 
+- (BOOL)isConcurrentProcessingSafe {
+    NSArray<id<PNCryptor>> *cryptors = [@[self.defaultCryptor] arrayByAddingObjectsFromArray:self.cryptors ?: @[]];
+
+    for (id<PNCryptor> cryptor in cryptors) {
+        // Subclasses and custom cryptors may have mutable state.
+        if (cryptor.class != [PNAESCBCCryptor class] && cryptor.class != [PNLegacyCryptor class]) return NO;
+    }
+
+    return YES;
+}
+
 - (id<PNCryptor>)cryptorWithIdentifier:(NSData *)identifier {
     identifier = identifier ?: kPNCryptorLegacyIdentifier;
 
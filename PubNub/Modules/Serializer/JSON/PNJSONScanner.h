@@ -0,0 +1,98 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Types and structures
+
+/// Raw JSON data scanner.
+///
+/// Scanner allows walking through JSON data structure and retrieve byte ranges of values without objects
+/// materialization.
+///
+/// > Note: Scanner doesn't validate JSON data (it is expected that data already has been or will be validated by
+/// JSON serializer).
+typedef struct PNJSONScanner {
+    /// JSON data bytes.
+    const uint8_t *bytes;
+
+    /// Length of JSON data.
+    NSUInteger length;
+
+    /// Current scanner position in JSON data.
+    NSUInteger position;
+
+    /// Whether scanner found unexpected data structure or not.
+    ///
+    /// Flag allows to distinguish end of object members / array elements from malformed data.
+    BOOL failed;
+} PNJSONScanner;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create JSON scanner for data.
+///
+/// - Parameter data: JSON data which should be scanned.
+/// - Returns: Scanner positioned at the beginning of JSON data.
+extern PNJSONScanner PNJSONScannerMake(NSData *data);
+
+
+#pragma mark - Scanning
+
+/// Enter JSON object (`{`) at current scanner position.
+///
+/// - Parameter scanner: Scanner which should be used to process JSON data.
+/// - Returns: `YES` in case if JSON object found at current position.
+extern BOOL PNJSONScannerBeginObject(PNJSONScanner *scanner);
+
+/// Scan next object member key.
+///
+/// Scanner will be positioned at the beginning of member value. Object's closing brace will be consumed if there is no
+/// more members.
+///
+/// - Parameters:
+///   - scanner: Scanner which should be used to process JSON data.
+///   - key: Range of raw (not un-escaped) key characters.
+/// - Returns: `YES` in case if another object member found (``PNJSONScanner/failed`` set if data is malformed).
+extern BOOL PNJSONScannerNextMember(PNJSONScanner *scanner, NSRange *key);
+
+/// Enter JSON array (`[`) at current scanner position.
+///
+/// - Parameter scanner: Scanner which should be used to process JSON data.
+/// - Returns: `YES` in case if JSON array found at current position.
+extern BOOL PNJSONScannerBeginArray(PNJSONScanner *scanner);
+
+/// Move to the next array element.
+///
+/// Scanner will be positioned at the beginning of array element. Array's closing bracket will be consumed if there is
+/// no more elements.
+///
+/// - Parameter scanner: Scanner which should be used to process JSON data.
+/// - Returns: `YES` in case if another array element found (``PNJSONScanner/failed`` set if data is malformed).
+extern BOOL PNJSONScannerNextElement(PNJSONScanner *scanner);
+
+/// Skip value at current scanner position.
+///
+/// - Parameters:
+///   - scanner: Scanner which should be used to process JSON data.
+///   - range: Range of raw value bytes (including string quotes and collection brackets).
+/// - Returns: `YES` in case if value has been skipped.
+extern BOOL PNJSONScannerSkipValue(PNJSONScanner *scanner, NSRange * _Nullable range);
+
+/// Check whether only whitespaces left in JSON data.
+///
+/// - Parameter scanner: Scanner which should be used to process JSON data.
+/// - Returns: `YES` in case if there is no more values in JSON data.
+extern BOOL PNJSONScannerIsAtEnd(PNJSONScanner *scanner);
+
+/// Check whether previously scanned key is equal to the specified one.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan `key`.
+///   - key: Range of raw key characters.
+///   - expected: Expected key value.
+/// - Returns: `YES` in case if key is equal to `expected`.
+extern BOOL PNJSONScannerKeyIsEqual(const PNJSONScanner *scanner, NSRange key, const char *expected);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,210 @@
+#import "PNJSONScanner.h"
+
+
+#pragma mark - Helpers
+
+/// Move scanner position to the next non-whitespace character.
+///
+/// - Parameter scanner: Scanner which should be used to process JSON data.
+/// - Returns: Next non-whitespace character or `0` if end of data reached.
+static inline uint8_t PNJSONScannerPeek(PNJSONScanner *scanner) {
+    while (scanner->position < scanner->length) {
+        uint8_t character = scanner->bytes[scanner->position];
+        if (character != ' ' && character != '\n' && character != '\r' && character != '\t') return character;
+        scanner->position++;
+    }
+
+    return 0;
+}
+
+/// Skip JSON string at current scanner position.
+///
+/// - Parameters:
+///   - scanner: Scanner which should be used to process JSON data.
+///   - range: Range of raw string characters (without quotes).
+/// - Returns: `YES` in case if string has been skipped.
+static BOOL PNJSONScannerSkipString(PNJSONScanner *scanner, NSRange *range) {
+    if (PNJSONScannerPeek(scanner) != '"') {
+        scanner->failed = YES;
+        return NO;
+    }
+
+    NSUInteger start = ++scanner->position;
+    const uint8_t *bytes = scanner->bytes;
+
+    while (scanner->position < scanner->length) {
+        const uint8_t *quote = memchr(bytes + scanner->position, '"', scanner->length - scanner->position);
+        if (!quote) break;
+
+        NSUInteger end = (NSUInteger)(quote - bytes);
+        NSUInteger backslashes = 0;
+        while (end - backslashes > start && bytes[end - backslashes - 1] == '\\') backslashes++;
+        scanner->position = end + 1;
+
+        // Quote escaped only if preceded by odd number of backslashes.
+        if (backslashes % 2 == 0) {
+            if (range) *range = NSMakeRange(start, end - start);
+            return YES;
+        }
+    }
+
+    scanner->position = scanner->length;
+    scanner->failed = YES;
+
+    return NO;
+}
+
+/// Check whether collection entry can start at current scanner position.
+///
+/// Used to ensure that collection entries separated by comma.
+///
+/// - Parameters:
+///   - scanner: Scanner which should be used to process JSON data.
+///   - opening: Collection opening character.
+/// - Returns: `YES` in case if previous non-whitespace character is `opening` or comma.
+static BOOL PNJSONScannerIsAtEntryStart(const PNJSONScanner *scanner, uint8_t opening) {
+    NSUInteger position = scanner->position;
+
+    while (position > 0) {
+        uint8_t character = scanner->bytes[--position];
+        if (character == ' ' || character == '\n' || character == '\r' || character == '\t') continue;
+
+        return character == opening || character == ',';
+    }
+
+    return NO;
+}
+
+
+#pragma mark - Initialization and Configuration
+
+PNJSONScanner PNJSONScannerMake(NSData *data) {
+    PNJSONScanner scanner = { data.bytes, data.length, 0, NO };
+    return scanner;
+}
+
+
+#pragma mark - Scanning
+
+BOOL PNJSONScannerBeginObject(PNJSONScanner *scanner) {
+    if (PNJSONScannerPeek(scanner) != '{') return NO;
+    scanner->position++;
+
+    return YES;
+}
+
+BOOL PNJSONScannerNextMember(PNJSONScanner *scanner, NSRange *key) {
+    uint8_t character = PNJSONScannerPeek(scanner);
+
+    if (character == ',') {
+        scanner->position++;
+        character = PNJSONScannerPeek(scanner);
+    }
+
+    if (character == '}') {
+        scanner->position++;
+        return NO;
+    } else if (!PNJSONScannerIsAtEntryStart(scanner, '{')) {
+        scanner->failed = YES;
+        return NO;
+    }
+
+    if (!PNJSONScannerSkipString(scanner, key)) return NO;
+    if (PNJSONScannerPeek(scanner) != ':') {
+        scanner->failed = YES;
+        return NO;
+    }
+    scanner->position++;
+
+    return YES;
+}
+
+BOOL PNJSONScannerBeginArray(PNJSONScanner *scanner) {
+    if (PNJSONScannerPeek(scanner) != '[') return NO;
+    scanner->position++;
+
+    return YES;
+}
+
+BOOL PNJSONScannerNextElement(PNJSONScanner *scanner) {
+    uint8_t character = PNJSONScannerPeek(scanner);
+
+    if (character == ',') {
+        scanner->position++;
+        character = PNJSONScannerPeek(scanner);
+    }
+
+    if (character == ']') {
+        scanner->position++;
+        return NO;
+    }
+
+    if (character == 0 || !PNJSONScannerIsAtEntryStart(scanner, '[')) {
+        scanner->failed = YES;
+        return NO;
+    }
+
+    return YES;
+}
+
+BOOL PNJSONScannerSkipValue(PNJSONScanner *scanner, NSRange *range) {
+    uint8_t character = PNJSONScannerPeek(scanner);
+    NSUInteger start = scanner->position;
+
+    if (character == 0) {
+        scanner->failed = YES;
+        return NO;
+    }
+
+    if (character == '"') {
+        if (!PNJSONScannerSkipString(scanner, NULL)) return NO;
+    } else if (character == '{' || character == '[') {
+        NSUInteger depth = 0;
+
+        while (scanner->position < scanner->length) {
+            character = scanner->bytes[scanner->position];
+
+            if (character == '"') {
+                if (!PNJSONScannerSkipString(scanner, NULL)) return NO;
+                continue;
+            } else if (character == '{' || character == '[') depth++;
+            else if ((character == '}' || character == ']') && --depth == 0) {
+                scanner->position++;
+                break;
+            }
+
+            scanner->position++;
+        }
+
+        if (depth != 0) {
+            scanner->failed = YES;
+            return NO;
+        }
+    } else {
+        // Number, boolean or null literal.
+        while (scanner->position < scanner->length) {
+            character = scanner->bytes[scanner->position];
+            if (character == ',' || character == '}' || character == ']' || character == ' ' ||
+                character == '\n' || character == '\r' || character == '\t') break;
+            scanner->position++;
+        }
+
+        if (scanner->position == start) {
+            scanner->failed = YES;
+            return NO;
+        }
+    }
+
+    if (range) *range = NSMakeRange(start, scanner->position - start);
+
+    return YES;
+}
+
+BOOL PNJSONScannerIsAtEnd(PNJSONScanner *scanner) {
+    return PNJSONScannerPeek(scanner) == 0;
+}
+
+BOOL PNJSONScannerKeyIsEqual(const PNJSONScanner *scanner, NSRange key, const char *expected) {
+    size_t length = strlen(expected);
+    return key.length == length && memcmp(scanner->bytes + key.location, expected, length) == 0;
+}
@@ -1,4 +1,5 @@
 #import <Foundation/Foundation.h>
+#import "PNJSONCodecPlan.h"
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -26,6 +27,14 @@ NS_ASSUME_NONNULL_BEGIN
 /// Remove any information which has been attached by code at run-time for all custom classes.
 + (void)clearAllClasses;
 
+/// Retrieve coding plan for `aClass`.
+///
+/// Plan created on first access and reused for all following encoding / decoding operations.
+///
+/// - Parameter aClass: Custom object class for which coding plan should be retrieved.
+/// - Returns: Coding plan or `nil` for Foundation classes.
++ (nullable PNJSONCodecPlan *)codecPlanForClass:(Class)aClass;
+
 
 #pragma mark - Helpers
 
@@ -1,5 +1,6 @@
 #import "PNJSONCodableObjects.h"
 #import <objc/runtime.h>
+#import <stdatomic.h>
 #import "PNFunctions.h"
 #import "PNCodable.h"
 #import "PNLock.h"
@@ -7,29 +8,66 @@
 
 #pragma mark Static
 
-/// Key, which is used to associate list of JSON-friendly properties for class.
-static char kPNJSONCodableObjectFoundationProperties;
+/// Maximum number of coding plans which can be looked up without lock (should be power of two).
+static const NSUInteger kPNJSONCodecPlansTableSize = 2048;
 
-/// Key, which is used to associate list of custom properties for class.
-static char kPNJSONCodableObjectCustomProperties;
 
-/// Key, which is used to associate keys with dynamic type for class.
-static char kPNJSONCodableObjectDynamicTypeKeys;
+#pragma mark - Types and structures
 
-/// Key, which is used to associate optional keys for class.
-static char kPNJSONCodableObjectOptionalKeys;
+/// Open-addressed lookup table of retained coding plans.
+///
+/// Each slot published as single pointer to immutable plan which knows its ``PNJSONCodecPlan/codableClass``, so
+/// readers never see class of one plan paired with another. Slots only modified under write lock and plans removed on
+/// reset moved to the retired list until there is no lookup which could still load them, which allows readers to
+/// look up plans without any locks.
+static _Atomic(uintptr_t) _codecPlans[kPNJSONCodecPlansTableSize];
+
+/// Number of coding plan lookups in progress.
+static _Atomic(NSUInteger) _codecPlanLookups;
 
-/// Key, which is used to associate coding keys for class.
-static char kPNJSONCodableObjectCodingKeys;
 
-/// Key, which is used to associate list of known properties for class.
-static char kPNJSONCodableProperties;
+#pragma mark - Helpers
 
-/// Key, which is used to associate results of custom encoding check for class.
-static char kPNJSONCodableHasCustomEncoding;
+/// Compute lookup table slot index for class.
+///
+/// - Parameter codableClass: Class pointer value.
+/// - Returns: Index of slot from which lookup should be started.
+static inline NSUInteger PNJSONCodecPlanSlotIndex(uintptr_t codableClass) {
+    uint64_t hash = (uint64_t)codableClass * 0x9e3779b97f4a7c15ULL;
+    return (NSUInteger)(hash >> 32) & (kPNJSONCodecPlansTableSize - 1);
+}
 
-/// Key, which is used to associate results of custom decoding check for class.
-static char kPNJSONCodableHasCustomDecoding;
+/// Find coding plan for class.
+///
+/// - Parameter aClass: Class for which coding plan should be found.
+/// - Returns: Coding plan or `nil` in case if plan not stored in lookup table.
+static PNJSONCodecPlan *PNJSONCodecPlanLookup(Class aClass) {
+    uintptr_t codableClass = (uintptr_t)(__bridge void *)aClass;
+    NSUInteger idx = PNJSONCodecPlanSlotIndex(codableClass);
+    PNJSONCodecPlan *plan = nil;
+
+    // Lookup announced before slots access, so reset won't release plan until it is retained by the caller.
+    atomic_fetch_add_explicit(&_codecPlanLookups, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (NSUInteger probe = 0; probe < kPNJSONCodecPlansTableSize; probe++) {
+        uintptr_t slotPlan = atomic_load_explicit(&_codecPlans[idx], memory_order_acquire);
+        if (slotPlan == 0) break;
+
+        __unsafe_unretained PNJSONCodecPlan *candidate = (__bridge PNJSONCodecPlan *)(const void *)slotPlan;
+        if (candidate.codableClass == aClass) {
+            // Explicit retain, so it won't be deferred by compiler past lookup completion.
+            plan = CFBridgingRelease(CFRetain((const void *)slotPlan));
+            break;
+        }
+
+        idx = (idx + 1) & (kPNJSONCodecPlansTableSize - 1);
+    }
+
+    atomic_fetch_sub_explicit(&_codecPlanLookups, 1, memory_order_release);
+
+    return plan;
+}
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -50,13 +88,43 @@ NS_ASSUME_NONNULL_BEGIN
 /// List of `NSObject` own methods, so they will be excluded
 @property(strong, nonatomic) NSSet<NSString *> *NSObjectMethods;
 
-/// List of classes which has been modified.
-@property(strong, nonatomic) NSMutableSet<Class> *classes;
+/// Coding plans which didn't fit into lookup table.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, PNJSONCodecPlan *> *overflowPlans;
+
+/// Coding plans which has been removed from lookup table on reset.
+///
+/// Plans kept alive while lookups which started before reset are in progress and released with next write access.
+@property(strong, nonatomic) NSMutableArray<PNJSONCodecPlan *> *retiredPlans;
 
 /// Resources access lock.
 @property(strong, nonatomic) PNLock *lock;
 
 
+#pragma mark - Coding plans
+
+/// Retrieve or create coding plan for class.
+///
+/// > Important: Method should be called only from write access block.
+///
+/// - Parameter aClass: Class for which coding plan should be retrieved.
+/// - Returns: Coding plan for `aClass`.
+- (PNJSONCodecPlan *)codecPlanForClass:(Class)aClass;
+
+/// Store coding plan for future lookup.
+///
+/// > Important: Method should be called only from write access block.
+///
+/// - Parameters:
+///   - plan: Coding plan which should be stored.
+///   - aClass: Class for which coding plan has been created.
+- (void)storeCodecPlan:(PNJSONCodecPlan *)plan forClass:(Class)aClass;
+
+/// Release retired coding plans if there is no lookup which could load them from lookup table.
+///
+/// > Important: Method should be called only from write access block.
+- (void)releaseRetiredCodecPlans;
+
+
 #pragma mark - Helpers
 
 /// Index instance properties list.
@@ -78,26 +146,26 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 /// Run through known `aClass` instance properties and separate them on properties which hold foundation and
 /// custom objects.
-/// Identifier properties will be attached to an `aClass` as associated objects and used later for coding.
 ///
 /// - Parameters:
 ///   - propertyList: List of `aClass` instance properties.
 ///   - aClass: Class for which properties should be identified.
-- (void)identifyAndStoreProperties:(NSSet<NSString *> *)propertyList forClass:(Class)aClass;
-
-/// Ensure that `aClass` adopt ``PNCodable`` protocol.
+///   - foundation: Map of property names to their Foundation classes.
+///   - custom: Map of property names to their custom classes.
+- (void)identifyProperties:(NSSet<NSString *> *)propertyList
+                  forClass:(Class)aClass
+                foundation:(NSDictionary<NSString *, Class> * _Nullable * _Nonnull)foundation
+                    custom:(NSDictionary<NSString *, Class> * _Nullable * _Nonnull)custom;
+
+/// Create coding plan for class.
 ///
-/// Missing implementations from ``PNCodable`` protocol will be stubbed with default implementation.
+/// Plan includes information about ``PNCodable`` protocol methods implemented by `aClass` and its superclasses.
 ///
 /// - Parameters:
-///   - aClass: Class which should conform to ``PNCodable`` protocol.
+///   - aClass: Class for which coding plan should be created.
 ///   - propertyList: List of `aClass` instance properties.
-- (void)ensureCodableClass:(Class)aClass withPropertyList:(NSSet<NSString *> *)propertyList;
-
-/// Clean up any data which has been associated with `aClass`.
-///
-/// - Parameter aClass: Class for which should be removed associated objects.
-- (void)resetInitialStateForClass:(Class)aClass;
+/// - Returns: Coding plan for `aClass`.
+- (PNJSONCodecPlan *)createCodecPlanForClass:(Class)aClass withPropertyList:(NSSet<NSString *> *)propertyList;
 
 
 #pragma mark -
@@ -133,7 +201,8 @@ NS_ASSUME_NONNULL_END
     if ((self = [super init])) {
         _NSObjectProperties = [self propertyListForClass:[NSObject class]];
         _NSObjectMethods = [self methodsListForClass:[NSObject class]];
-        _classes = [NSMutableSet new];
+        _overflowPlans = [NSMutableDictionary new];
+        _retiredPlans = [NSMutableArray new];
 
         _lock = [PNLock lockWithIsolationQueueName:@"objects" subsystemQueueIdentifier:@"com.pubnub.serializer"];
     }
@@ -145,53 +214,106 @@ NS_ASSUME_NONNULL_END
 #pragma mark - Coding / decoding
 
 + (void)makeCodableClass:(Class)aClass {
+    [self codecPlanForClass:aClass];
+}
+
++ (void)clearAllClasses {
     PNJSONCodableObjects *manager = self.sharedManager;
 
     [manager.lock syncWriteAccessWithBlock:^{
-        // Early exit, if class already codable or from Foundation.
-        if ([manager.classes containsObject:aClass] || strncmp(class_getName(aClass), "NS", 2) == 0) return;
-
-        [manager.classes addObject:aClass];
-        NSSet<NSString *> *propertyList = [manager propertyListForClass:aClass];
+        for (NSUInteger idx = 0; idx < kPNJSONCodecPlansTableSize; idx++) {
+            uintptr_t slotPlan = atomic_exchange_explicit(&_codecPlans[idx], 0, memory_order_acq_rel);
+            if (slotPlan != 0) [manager.retiredPlans addObject:CFBridgingRelease((const void *)slotPlan)];
+        }
 
-        [manager identifyAndStoreProperties:propertyList forClass:aClass];
-        [manager ensureCodableClass:aClass withPropertyList:propertyList];
+        [manager.retiredPlans addObjectsFromArray:manager.overflowPlans.allValues];
+        [manager.overflowPlans removeAllObjects];
+        [manager releaseRetiredCodecPlans];
     }];
 }
 
-+ (void)clearAllClasses {
+
+#pragma mark - Coding plans
+
++ (PNJSONCodecPlan *)codecPlanForClass:(Class)aClass {
+    // Foundation classes handled by coders without plan.
+    if (!aClass || strncmp(class_getName(aClass), "NS", 2) == 0) return nil;
+
+    PNJSONCodecPlan *plan = PNJSONCodecPlanLookup(aClass);
+    if (plan) return plan;
+
     PNJSONCodableObjects *manager = self.sharedManager;
+    __block PNJSONCodecPlan *createdPlan;
 
     [manager.lock syncWriteAccessWithBlock:^{
-        for (Class aClass in manager.classes) [manager resetInitialStateForClass:aClass];
-        [manager.classes removeAllObjects];
+        createdPlan = [manager codecPlanForClass:aClass];
     }];
+
+    return createdPlan;
+}
+
+- (PNJSONCodecPlan *)codecPlanForClass:(Class)aClass {
+    PNJSONCodecPlan *plan = PNJSONCodecPlanLookup(aClass) ?: self.overflowPlans[NSStringFromClass(aClass)];
+    [self releaseRetiredCodecPlans];
+
+    if (!plan) {
+        plan = [self createCodecPlanForClass:aClass withPropertyList:[self propertyListForClass:aClass]];
+        [self storeCodecPlan:plan forClass:aClass];
+    }
+
+    return plan;
+}
+
+- (void)storeCodecPlan:(PNJSONCodecPlan *)plan forClass:(Class)aClass {
+    uintptr_t codableClass = (uintptr_t)(__bridge void *)aClass;
+    NSUInteger idx = PNJSONCodecPlanSlotIndex(codableClass);
+
+    for (NSUInteger probe = 0; probe < kPNJSONCodecPlansTableSize; probe++) {
+        if (atomic_load_explicit(&_codecPlans[idx], memory_order_relaxed) == 0) {
+            atomic_store_explicit(&_codecPlans[idx], (uintptr_t)CFBridgingRetain(plan), memory_order_release);
+            return;
+        }
+
+        idx = (idx + 1) & (kPNJSONCodecPlansTableSize - 1);
+    }
+
+    self.overflowPlans[NSStringFromClass(aClass)] = plan;
+}
+
+- (void)releaseRetiredCodecPlans {
+    if (self.retiredPlans.count == 0) return;
+
+    // Lookups which start after this point won't find retired plans in cleared slots.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&_codecPlanLookups, memory_order_acquire) == 0) [self.retiredPlans removeAllObjects];
 }
 
 
 #pragma mark - Helpers
 
 + (BOOL)hasCustomEncodingForClass:(Class)aClass {
-    return ((NSNumber *)objc_getAssociatedObject(aClass, &kPNJSONCodableHasCustomEncoding)).boolValue;
+    return [self codecPlanForClass:aClass].hasCustomEncoding;
 }
 
 + (BOOL)hasCustomDecodingForClass:(Class)aClass {
-    return ((NSNumber *)objc_getAssociatedObject(aClass, &kPNJSONCodableHasCustomDecoding)).boolValue;
+    return [self codecPlanForClass:aClass].hasCustomDecoding;
 }
 
 + (Class)classOfProperty:(NSString *)propertyName forClass:(Class)aClass custom:(BOOL *)customClass dynamic:(BOOL *)dynamicClass; {
     if (!aClass) return nil;
     if (customClass) *customClass = NO;
 
-    if ([[self dynamicTypeKeysForClass:aClass] containsObject:propertyName]) {
+    PNJSONCodecPlan *plan = [self codecPlanForClass:aClass];
+
+    if ([plan.dynamicTypeKeys containsObject:propertyName]) {
         if (dynamicClass) *dynamicClass = YES;
         return nil;
     }
 
-    Class sClass = objc_getAssociatedObject(aClass, &kPNJSONCodableObjectFoundationProperties)[propertyName];
+    Class sClass = plan.foundationProperties[propertyName];
 
     if (!sClass) {
-        sClass = objc_getAssociatedObject(aClass, &kPNJSONCodableObjectCustomProperties)[propertyName];
+        sClass = plan.customProperties[propertyName];
         if (customClass) *customClass = sClass != nil;
     }
 
@@ -205,19 +327,19 @@ NS_ASSUME_NONNULL_END
 }
 
 + (NSSet<NSString *> *)propertyListForClass:(Class)aClass {
-    return objc_getAssociatedObject(aClass, &kPNJSONCodableProperties);
+    return [self codecPlanForClass:aClass].propertyList;
 }
 
 + (NSDictionary<NSString *,NSString *> *)codingKeysForClass:(Class)aClass {
-    return objc_getAssociatedObject(aClass, &kPNJSONCodableObjectCodingKeys);
+    return [self codecPlanForClass:aClass].codingKeys;
 }
 
 + (NSArray<NSString *> *)dynamicTypeKeysForClass:(Class)aClass {
-    return objc_getAssociatedObject(aClass, &kPNJSONCodableObjectDynamicTypeKeys);
+    return [self codecPlanForClass:aClass].dynamicTypeKeys;
 }
 
 + (NSArray<NSString *> *)optionalKeysForClass:(Class)aClass {
-    return objc_getAssociatedObject(aClass, &kPNJSONCodableObjectOptionalKeys);
+    return [self codecPlanForClass:aClass].optionalKeys;
 }
 
 - (NSSet<NSString *> *)propertyListForClass:(Class)aClass {
@@ -290,7 +412,10 @@ NS_ASSUME_NONNULL_END
     return methods;
 }
 
-- (void)identifyAndStoreProperties:(NSSet<NSString *> *)propertyList forClass:(Class)aClass {
+- (void)identifyProperties:(NSSet<NSString *> *)propertyList
+                  forClass:(Class)aClass
+                foundation:(NSDictionary<NSString *, Class> **)foundationProperties
+                    custom:(NSDictionary<NSString *, Class> **)customProperties {
     NSMutableDictionary<NSString *, Class> *foundation = [NSMutableDictionary new];
     NSMutableDictionary<NSString *, Class> *custom = [NSMutableDictionary new];
 
@@ -300,7 +425,7 @@ NS_ASSUME_NONNULL_END
         unsigned long typeLength = strlen(type);
         BOOL isFoundationObject = YES;
         char *className = NULL;
-        Class objectClass;
+        Class objectClass = Nil;
 
         if (type[0] == '@' && typeLength > 3) {
             className = strndup(type + 2, typeLength - 3);
@@ -319,16 +444,12 @@ NS_ASSUME_NONNULL_END
             foundation[name] = objectClass;
         }
     }
-    objc_setAssociatedObject(
-                             aClass,
-                             &kPNJSONCodableObjectFoundationProperties,
-                             foundation,
-                             OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectCustomProperties, custom, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableProperties, propertyList, OBJC_ASSOCIATION_RETAIN);
+
+    *foundationProperties = foundation;
+    *customProperties = custom;
 }
 
-- (void)ensureCodableClass:(Class)aClass withPropertyList:(NSSet<NSString *> *)propertyList {
+- (PNJSONCodecPlan *)createCodecPlanForClass:(Class)aClass withPropertyList:(NSSet<NSString *> *)propertyList {
     Class metaClass = objc_getMetaClass(class_getName(aClass));
     NSSet<NSString *> *methodsList = [self methodsListForClass:aClass];
     BOOL encoding = [methodsList containsObject:NSStringFromSelector(@selector(encodeObjectWithCoder:))];
@@ -338,6 +459,10 @@ NS_ASSUME_NONNULL_END
     NSDictionary<NSString *, NSString *> *codingKeys;
     NSArray<NSString *> *dynamicTypeKeys;
     NSArray<NSString *> *optionalKeys;
+    NSDictionary<NSString *, Class> *foundation;
+    NSDictionary<NSString *, Class> *custom;
+
+    [self identifyProperties:propertyList forClass:aClass foundation:&foundation custom:&custom];
 
     if ([methodsList containsObject:NSStringFromSelector(@selector(codingKeys))]) {
         codingKeys = [(Class<PNCodable>)aClass codingKeys];
@@ -362,14 +487,11 @@ NS_ASSUME_NONNULL_END
     }
 
     if (!isNSObjectClass && strncmp(class_getName([aClass superclass]), "NS", 2) != 0) {
-        Class superClass = [aClass superclass];
-        NSSet<NSString *> *superPropertyList = [self propertyListForClass:superClass];
-        
         // Process super class keys information.
-        [self ensureCodableClass:superClass withPropertyList:superPropertyList];
-        NSDictionary<NSString *,NSString *> *superCodingKeys = [[self class] codingKeysForClass:superClass];
-        NSArray<NSString *> *superDynamicTypeKeys = [[self class] dynamicTypeKeysForClass:superClass];
-        NSArray<NSString *> *superOptionalKeys = [[self class] optionalKeysForClass:superClass];
+        PNJSONCodecPlan *superPlan = [self codecPlanForClass:[aClass superclass]];
+        NSDictionary<NSString *,NSString *> *superCodingKeys = superPlan.codingKeys;
+        NSArray<NSString *> *superDynamicTypeKeys = superPlan.dynamicTypeKeys;
+        NSArray<NSString *> *superOptionalKeys = superPlan.optionalKeys;
 
         if (superCodingKeys.count) {
             NSMutableDictionary *updatedCodingKeys = [codingKeys mutableCopy];
@@ -390,22 +512,15 @@ NS_ASSUME_NONNULL_END
         }
     }
 
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectDynamicTypeKeys, dynamicTypeKeys, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectOptionalKeys, optionalKeys, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableHasCustomEncoding, @(encoding), OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableHasCustomDecoding, @(decoding), OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectCodingKeys, codingKeys, OBJC_ASSOCIATION_RETAIN);
-}
-
-- (void)resetInitialStateForClass:(Class)aClass {
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectFoundationProperties, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectCustomProperties, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectDynamicTypeKeys, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectOptionalKeys, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableHasCustomEncoding, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableHasCustomDecoding, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableObjectCodingKeys, nil, OBJC_ASSOCIATION_RETAIN);
-    objc_setAssociatedObject(aClass, &kPNJSONCodableProperties, nil, OBJC_ASSOCIATION_RETAIN);
+    return [PNJSONCodecPlan planForClass:aClass
+                        withPropertyList:propertyList
+                    foundationProperties:foundation
+                        customProperties:custom
+                              codingKeys:codingKeys
+                            optionalKeys:optionalKeys
+                         dynamicTypeKeys:dynamicTypeKeys
+                       hasCustomEncoding:encoding
+                       hasCustomDecoding:decoding];
 }
 
 #pragma mark -
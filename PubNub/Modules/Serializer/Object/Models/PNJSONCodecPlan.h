@@ -0,0 +1,172 @@
+#import <Foundation/Foundation.h>
+#import <objc/runtime.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Types and structures
+
+/// Codable property descriptor.
+///
+/// Descriptor contains everything which is required to decode / encode property value without run-time introspection.
+///
+/// > Note: Object references are owned by ``PNJSONCodecPlan`` which created descriptor.
+typedef struct PNJSONCodecProperty {
+    /// Name of property in codable class.
+    __unsafe_unretained NSString *name;
+
+    /// Name of field in JSON object which is mapped to the property.
+    __unsafe_unretained NSString *mappedKey;
+
+    /// Expected class of property value.
+    ///
+    /// `Nil` in case if property type can't be identified or is dynamic.
+    __unsafe_unretained Class _Nullable propertyClass;
+
+    /// Value setter selector (`set<Name>:`).
+    SEL _Nullable setterSelector;
+
+    /// Value setter implementation.
+    ///
+    /// `NULL` in case if property doesn't hold object or class doesn't have setter.
+    IMP _Nullable setter;
+
+    /// Value getter selector.
+    SEL _Nullable getterSelector;
+
+    /// Value getter implementation.
+    ///
+    /// `NULL` in case if property doesn't hold object or class doesn't have getter.
+    IMP _Nullable getter;
+
+    /// Instance variable which can be used to store value if there is no ``setter``.
+    Ivar _Nullable ivar;
+
+    /// Whether property value is optional and can be missing in JSON object.
+    BOOL optional;
+
+    /// Whether property holds custom (non-Foundation) object.
+    BOOL custom;
+
+    /// Whether property type depends from decoded JSON object.
+    BOOL dynamic;
+
+    /// Whether property is part of codable class properties list.
+    BOOL known;
+} PNJSONCodecProperty;
+
+
+#pragma mark - Interface declaration
+
+/// Precompiled codable class coding plan.
+///
+/// Plan created once per class and contains flat list of property descriptors, so encoding and decoding will be done
+/// without properties type lookup and key-value coding.
+@interface PNJSONCodecPlan : NSObject
+
+
+#pragma mark - Properties
+
+/// Class for which coding plan has been created.
+@property(unsafe_unretained, nonatomic, readonly) Class codableClass;
+
+/// List of names of instance properties which can be encoded / decoded.
+@property(strong, nonatomic, readonly) NSSet<NSString *> *propertyList;
+
+/// Map of property names to the names of fields in JSON object.
+@property(strong, nonatomic, readonly) NSDictionary<NSString *, NSString *> *codingKeys;
+
+/// Map of property names to their Foundation classes.
+@property(strong, nonatomic, readonly) NSDictionary<NSString *, Class> *foundationProperties;
+
+/// Map of property names to their custom classes.
+@property(strong, nonatomic, readonly) NSDictionary<NSString *, Class> *customProperties;
+
+/// List of property names which may have different type depending from decoded JSON object.
+@property(strong, nonatomic, readonly) NSArray<NSString *> *dynamicTypeKeys;
+
+/// List of property names which can be missing in JSON object.
+@property(strong, nonatomic, readonly) NSArray<NSString *> *optionalKeys;
+
+/// Flat list of codable property descriptors.
+@property(assign, nonatomic, readonly) const PNJSONCodecProperty *properties;
+
+/// Whether class implements ``PNCodable/encodeObjectWithCoder:`` or not.
+@property(assign, nonatomic, readonly) BOOL hasCustomEncoding;
+
+/// Whether class implements ``PNCodable/initObjectWithCoder:`` or not.
+@property(assign, nonatomic, readonly) BOOL hasCustomDecoding;
+
+/// Number of descriptors in ``properties``.
+@property(assign, nonatomic, readonly) NSUInteger count;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create codable class coding plan.
+///
+/// - Parameters:
+///   - aClass: Class for which coding plan should be created.
+///   - propertyList: List of names of instance properties which can be encoded / decoded.
+///   - foundationProperties: Map of property names to their Foundation classes.
+///   - customProperties: Map of property names to their custom classes.
+///   - codingKeys: Map of property names to the names of fields in JSON object.
+///   - optionalKeys: List of property names which can be missing in JSON object.
+///   - dynamicTypeKeys: List of property names which may have different type depending from decoded JSON object.
+///   - encoding: Whether class implements ``PNCodable/encodeObjectWithCoder:`` or not.
+///   - decoding: Whether class implements ``PNCodable/initObjectWithCoder:`` or not.
+/// - Returns: Ready to use coding plan.
++ (instancetype)planForClass:(Class)aClass
+            withPropertyList:(NSSet<NSString *> *)propertyList
+        foundationProperties:(NSDictionary<NSString *, Class> *)foundationProperties
+            customProperties:(NSDictionary<NSString *, Class> *)customProperties
+                  codingKeys:(NSDictionary<NSString *, NSString *> *)codingKeys
+                optionalKeys:(NSArray<NSString *> *)optionalKeys
+             dynamicTypeKeys:(NSArray<NSString *> *)dynamicTypeKeys
+           hasCustomEncoding:(BOOL)encoding
+           hasCustomDecoding:(BOOL)decoding;
+
+
+#pragma mark - Helpers
+
+/// Retrieve descriptor for property.
+///
+/// - Parameter name: Name of property for which descriptor should be retrieved.
+/// - Returns: Property descriptor or `NULL` if property not in ``codingKeys``.
+- (nullable const PNJSONCodecProperty *)propertyNamed:(NSString *)name;
+
+/// Check whether property value is optional and can be missing in JSON object.
+///
+/// - Parameter name: Name of property for which check should be done.
+/// - Returns: `YES` in case if property listed in ``optionalKeys``.
+- (BOOL)isOptionalKey:(NSString *)name;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Property value access
+
+/// Assign property value.
+///
+/// Value will be set with setter or directly to the instance variable if possible and with key-value coding otherwise.
+///
+/// - Parameters:
+///   - property: Descriptor of property which should be changed.
+///   - object: Object for which property should be changed.
+///   - value: New property value.
+extern void PNJSONCodecPropertySetValue(const PNJSONCodecProperty *property, id object, id value);
+
+/// Retrieve property value.
+///
+/// Value will be retrieved with getter if possible and with key-value coding otherwise.
+///
+/// - Parameters:
+///   - property: Descriptor of property which should be read.
+///   - object: Object from which property value should be retrieved.
+/// - Returns: Property value.
+extern id _Nullable PNJSONCodecPropertyValue(const PNJSONCodecProperty *property, id object);
+
+NS_ASSUME_NONNULL_END
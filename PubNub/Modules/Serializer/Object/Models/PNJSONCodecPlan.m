@@ -0,0 +1,202 @@
+#import "PNJSONCodecPlan.h"
+
+
+#pragma mark Helpers
+
+/// Resolve object property accessors.
+///
+/// Lookup follows key-value coding rules: `set<Name>:` setter, `<name>` getter and `_<name>` / `<name>` instance
+/// variables. Accessors resolved only for properties which hold objects (scalar values require key-value coding
+/// boxing / unboxing).
+///
+/// - Parameters:
+///   - property: Property descriptor which should be updated with resolved accessors.
+///   - aClass: Class in which accessors should be resolved.
+static void PNJSONCodecPropertyResolveAccessors(PNJSONCodecProperty *property, Class aClass) {
+    const char *name = property->name.UTF8String;
+    objc_property_t objcProperty = class_getProperty(aClass, name);
+    char *type = objcProperty ? property_copyAttributeValue(objcProperty, "T") : NULL;
+    BOOL isObject = type && type[0] == '@';
+    free(type);
+
+    if (!isObject || strlen(name) == 0) return;
+
+    NSString *setterName = [NSString stringWithFormat:@"set%@%@:",
+                            [property->name substringToIndex:1].uppercaseString,
+                            [property->name substringFromIndex:1]];
+    property->getterSelector = NSSelectorFromString(property->name);
+    property->setterSelector = NSSelectorFromString(setterName);
+    Method getter = class_getInstanceMethod(aClass, property->getterSelector);
+    Method setter = class_getInstanceMethod(aClass, property->setterSelector);
+    property->getter = getter ? method_getImplementation(getter) : NULL;
+    property->setter = setter ? method_getImplementation(setter) : NULL;
+
+    if (!property->setter) {
+        NSString *ivarName = [@"_" stringByAppendingString:property->name];
+        Ivar ivar = class_getInstanceVariable(aClass, ivarName.UTF8String) ?: class_getInstanceVariable(aClass, name);
+        const char *ivarType = ivar ? ivar_getTypeEncoding(ivar) : NULL;
+        if (ivarType && ivarType[0] == '@') property->ivar = ivar;
+    }
+}
+
+void PNJSONCodecPropertySetValue(const PNJSONCodecProperty *property, id object, id value) {
+    if (property->setter) ((void (*)(id, SEL, id))property->setter)(object, property->setterSelector, value);
+    else if (property->ivar) object_setIvarWithStrongDefault(object, property->ivar, value);
+    else [object setValue:value forKey:property->name];
+}
+
+id PNJSONCodecPropertyValue(const PNJSONCodecProperty *property, id object) {
+    if (!property->getter) return [object valueForKey:property->name];
+
+    return ((id (*)(id, SEL))property->getter)(object, property->getterSelector);
+}
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/// Codable class coding plan private extension.
+@interface PNJSONCodecPlan ()
+
+
+#pragma mark - Properties
+
+/// Class for which coding plan has been created.
+@property(unsafe_unretained, nonatomic) Class codableClass;
+
+/// List of names of instance properties which can be encoded / decoded.
+@property(strong, nonatomic) NSSet<NSString *> *propertyList;
+
+/// Map of property names to the names of fields in JSON object.
+@property(strong, nonatomic) NSDictionary<NSString *, NSString *> *codingKeys;
+
+/// Map of property names to their Foundation classes.
+@property(strong, nonatomic) NSDictionary<NSString *, Class> *foundationProperties;
+
+/// Map of property names to their custom classes.
+@property(strong, nonatomic) NSDictionary<NSString *, Class> *customProperties;
+
+/// List of property names which may have different type depending from decoded JSON object.
+@property(strong, nonatomic) NSArray<NSString *> *dynamicTypeKeys;
+
+/// List of property names which can be missing in JSON object.
+@property(strong, nonatomic) NSArray<NSString *> *optionalKeys;
+
+/// Set of property names which can be missing in JSON object.
+@property(strong, nonatomic) NSSet<NSString *> *optionalKeysSet;
+
+/// Map of property names to the index of their descriptors in ``properties``.
+@property(strong, nonatomic) NSDictionary<NSString *, NSNumber *> *propertyIndices;
+
+/// Flat list of codable property descriptors.
+@property(assign, nonatomic) PNJSONCodecProperty *mutableProperties;
+
+/// Whether class implements ``PNCodable/encodeObjectWithCoder:`` or not.
+@property(assign, nonatomic) BOOL hasCustomEncoding;
+
+/// Whether class implements ``PNCodable/initObjectWithCoder:`` or not.
+@property(assign, nonatomic) BOOL hasCustomDecoding;
+
+/// Number of descriptors in ``properties``.
+@property(assign, nonatomic) NSUInteger count;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNJSONCodecPlan
+
+
+#pragma mark - Properties
+
+- (const PNJSONCodecProperty *)properties {
+    return self.mutableProperties;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)planForClass:(Class)aClass
+            withPropertyList:(NSSet<NSString *> *)propertyList
+        foundationProperties:(NSDictionary<NSString *, Class> *)foundationProperties
+            customProperties:(NSDictionary<NSString *, Class> *)customProperties
+                  codingKeys:(NSDictionary<NSString *, NSString *> *)codingKeys
+                optionalKeys:(NSArray<NSString *> *)optionalKeys
+             dynamicTypeKeys:(NSArray<NSString *> *)dynamicTypeKeys
+           hasCustomEncoding:(BOOL)encoding
+           hasCustomDecoding:(BOOL)decoding {
+    NSMutableDictionary<NSString *, NSNumber *> *propertyIndices = [NSMutableDictionary new];
+    NSSet<NSString *> *dynamicTypeKeysSet = [NSSet setWithArray:dynamicTypeKeys];
+    NSSet<NSString *> *optionalKeysSet = [NSSet setWithArray:optionalKeys];
+    PNJSONCodecPlan *plan = [self new];
+    __block NSUInteger idx = 0;
+
+    // Immutable copy owns names which are referenced by property descriptors.
+    codingKeys = [codingKeys copy];
+
+    plan.mutableProperties = codingKeys.count > 0 ? calloc(codingKeys.count, sizeof(PNJSONCodecProperty)) : NULL;
+
+    [codingKeys enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *mappedKey, __unused BOOL *stop) {
+        PNJSONCodecProperty *property = &plan.mutableProperties[idx];
+        property->dynamic = [dynamicTypeKeysSet containsObject:name];
+        property->optional = [optionalKeysSet containsObject:name];
+        property->known = [propertyList containsObject:name];
+        property->mappedKey = mappedKey;
+        property->name = name;
+
+        if (!property->dynamic) {
+            property->propertyClass = foundationProperties[name];
+
+            if (!property->propertyClass) {
+                property->propertyClass = customProperties[name];
+                property->custom = property->propertyClass != nil;
+            }
+        }
+
+        PNJSONCodecPropertyResolveAccessors(property, aClass);
+        propertyIndices[name] = @(idx++);
+    }];
+
+    plan.foundationProperties = foundationProperties;
+    plan.codableClass = aClass;
+    plan.customProperties = customProperties;
+    plan.propertyIndices = propertyIndices;
+    plan.optionalKeysSet = optionalKeysSet;
+    plan.dynamicTypeKeys = dynamicTypeKeys;
+    plan.propertyList = propertyList;
+    plan.optionalKeys = optionalKeys;
+    plan.codingKeys = codingKeys;
+    plan.hasCustomEncoding = encoding;
+    plan.hasCustomDecoding = decoding;
+    plan.count = idx;
+
+    return plan;
+}
+
+- (void)dealloc {
+    if (_mutableProperties) free(_mutableProperties);
+}
+
+
+#pragma mark - Helpers
+
+- (const PNJSONCodecProperty *)propertyNamed:(NSString *)name {
+    NSNumber *index = self.propertyIndices[name];
+    return index ? &self.mutableProperties[index.unsignedIntegerValue] : NULL;
+}
+
+- (BOOL)isOptionalKey:(NSString *)name {
+    return [self.optionalKeysSet containsObject:name];
+}
+
+#pragma mark -
+
+
+@end
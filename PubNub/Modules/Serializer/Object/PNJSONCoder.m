@@ -1,7 +1,7 @@
 #import "PNJSONCoder.h"
 #import "PNJSONCodableObjects.h"
+#import "PNJSONDecoder+Private.h"
 #import "PNJSONEncoder.h"
-#import "PNJSONDecoder.h"
 #import "PNFunctions.h"
 
 
@@ -115,6 +115,19 @@ NS_ASSUME_NONNULL_END
     return decodedObject;
 }
 
+- (id)objectOfClass:(Class)aClass
+           fromData:(NSData *)data
+         jsonObject:(id *)object
+     withAdditional:(NSDictionary *)additionalData
+              error:(NSError **)error {
+    return [PNJSONDecoder decodedObjectOfClass:aClass
+                                      fromData:data
+                                    jsonObject:object
+                                withSerializer:self.serializer
+                                additionalData:additionalData
+                                         error:error];
+}
+
 
 #pragma mark - Helpers
 
@@ -3,7 +3,38 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Private interface declaration
+#pragma mark Protocols
+
+/// Raw JSON data decoding protocol.
+///
+/// Classes which adopt this protocol can be created directly from JSON data bytes and skip intermediate Foundation
+/// objects tree creation.
+@protocol PNJSONDataDecodable <NSObject>
+
+
+@required
+
+/// Create object from raw JSON data.
+///
+/// > Note: Implementation should return `nil` without `error` if it can't handle `data` with `serializer`, so data will
+/// be decoded with general-purpose decoder.
+///
+/// - Parameters:
+///   - data: Raw JSON data.
+///   - serializer: JSON serializer which has been configured for decoder.
+///   - additionalData: Additional information which can be used by custom initializer.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: Decoded object or `nil` in case of decoding failure or if data should be decoded with general-purpose
+/// decoder.
++ (nullable instancetype)decodedObjectFromJSONData:(NSData *)data
+                                    withSerializer:(nullable id<PNJSONSerializer>)serializer
+                                    additionalData:(nullable NSDictionary *)additionalData
+                                             error:(NSError * _Nullable *)error;
+
+@end
+
+
+#pragma mark - Private interface declaration
 
 /// JSON deserializer private extension.
 @interface PNJSONDecoder (Private)
@@ -14,6 +45,36 @@ NS_ASSUME_NONNULL_BEGIN
 /// Additional information which can be used by `aClass` custom initializer.
 @property(strong, nullable, nonatomic) NSDictionary *additionalData;
 
+/// JSON data from which decodable object has been de-serialized.
+///
+/// Data available only for decoder which has been created with ``decodedObjectOfClass:fromData:error:`` and allows
+/// custom decoders to access raw bytes of encoded values.
+@property(strong, nullable, nonatomic, readonly) NSData *decodableData;
+
+
+#pragma mark - Decode Top-Level Objects
+
+/// Decodes and returns an `object` as instance of `aClass` from JSON data.
+///
+/// Allows decoding same JSON data into different classes while data is parsed only once.
+///
+/// - Parameters:
+///   - aClass: Expected class of decoded object.
+///   - data: JSON data with encoded object.
+///   - object: Pointer to the JSON object parsed from `data`. If it points to `nil`, `data` will be parsed and
+///   resulting object stored by pointer for next calls.
+///   - serializer: JSON serializer which conform to ``PNJSONSerializer`` protocol and can be used to parse
+///   JSON binary data. Will fallback to `NSJSONSerialization` if set to `nil`.
+///   - additionalData: Additional information which can be used by `aClass` custom initializer.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: Decoded object, or `nil` in case of decoding failure.
++ (nullable id)decodedObjectOfClass:(Class)aClass
+                           fromData:(NSData *)data
+                         jsonObject:(id _Nullable * _Nonnull)object
+                     withSerializer:(nullable id<PNJSONSerializer>)serializer
+                     additionalData:(nullable NSDictionary *)additionalData
+                              error:(NSError * _Nullable *)error;
+
 #pragma mark -
 
 
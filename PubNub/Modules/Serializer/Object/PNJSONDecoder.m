@@ -1,9 +1,9 @@
 #import "PNJSONDecoder+Private.h"
 #import <objc/runtime.h>
 #import "NSNumberFormatter+PNJSONCodable.h"
-#import "NSDateFormatter+PNJSONCodable.h"
 #import "PNJSONCodableObjects.h"
 #import "PNFunctions.h"
+#import "PNDate.h"
 #import "PNCodable.h"
 #import "PNError.h"
 
@@ -33,8 +33,8 @@ NS_ASSUME_NONNULL_BEGIN
 /// Map of serialized property name to actual property name in specified class.
 @property(strong, nullable, nonatomic) NSDictionary<NSString *, NSString *> *codingKeys;
 
-/// List of object property names, which is optional and can be `nil` in encoded / decoded data.
-@property(strong, nullable, nonatomic) NSArray<NSString *> *optionalKeys;
+/// Coding plan of decoded class.
+@property(strong, nullable, nonatomic) PNJSONCodecPlan *codecPlan;
 
 /// Configured foundation object to JSON data deserializer.
 @property(strong, nullable, nonatomic) id<PNJSONSerializer> serializer;
@@ -51,6 +51,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Object, which stores JSON deserialized object used for data decoding.
 @property(strong, nullable, nonatomic) id decodableValue;
 
+/// JSON data from which decodable object has been de-serialized.
+@property(strong, nullable, nonatomic) NSData *decodableData;
+
 
 #pragma mark - Initialization and configuration
 
@@ -246,9 +249,8 @@ NS_ASSUME_NONNULL_END
             if ([[date class] isSubclassOfClass:_decNumberClass]) {
                 parsed = [NSDate dateWithTimeIntervalSince1970:((NSNumber *)date).doubleValue];
             } else if ([(NSString *)date rangeOfString:@"-"].location != NSNotFound) {
-                parsed = [NSDateFormatter.pnjc_iso8601 dateFromString:(NSString *)date];
-                if (!parsed) parsed = [NSDateFormatter.pnjc_iso8601NoMillisecond dateFromString:(NSString *)date];
-            } else {
+                parsed = [PNDate dateFromISO8601String:(NSString *)date];
+            } else if (!(parsed = [PNDate dateFromTimetokenString:(NSString *)date])) {
                 NSNumber *timestamp = [NSNumberFormatter.pnjc_number numberFromString:(NSString *)date];
                 if (timestamp != nil) parsed = [NSDate dateWithTimeIntervalSince1970:timestamp.doubleValue];
             }
@@ -350,6 +352,7 @@ NS_ASSUME_NONNULL_END
                                    withSerializer:serializer
                                             error:&jsonError])) {
         if (error) *error = jsonError;
+        _decodableData = data;
     }
 
     return self;
@@ -368,10 +371,8 @@ NS_ASSUME_NONNULL_END
         _decodingError = initError;
 
         if (!initError) {
-            [PNJSONCodableObjects makeCodableClass:aClass];
-
-            _optionalKeys = [PNJSONCodableObjects optionalKeysForClass:aClass];
-            _codingKeys = [PNJSONCodableObjects codingKeysForClass:aClass];
+            _codecPlan = [PNJSONCodableObjects codecPlanForClass:aClass];
+            _codingKeys = _codecPlan.codingKeys;
             _serializer = serializer;
         } else if (error) {
             *error = initError;
@@ -400,11 +401,51 @@ NS_ASSUME_NONNULL_END
             withSerializer:(id<PNJSONSerializer>)serializer
             additionalData:(NSDictionary *)additionalData
                      error:(NSError **)error {
-    PNJSONDecoder *decoder = [[self alloc] initForReadingObjectOfClass:aClass
-                                                              fromData:data
-                                                        withSerializer:serializer
-                                                                 error:error];
-     decoder.additionalData = additionalData;
+    id jsonObject;
+
+    return [self decodedObjectOfClass:aClass
+                             fromData:data
+                           jsonObject:&jsonObject
+                       withSerializer:serializer
+                       additionalData:additionalData
+                                error:error];
+}
+
++ (id)decodedObjectOfClass:(Class)aClass
+                  fromData:(NSData *)data
+                jsonObject:(id *)object
+            withSerializer:(id<PNJSONSerializer>)serializer
+            additionalData:(NSDictionary *)additionalData
+                     error:(NSError **)error {
+    PNJSONDecoder *decoder;
+
+    if (*object) {
+        NSError *initError;
+        decoder = [[self alloc] initForReadingObjectOfClass:aClass
+                                                 fromObject:*object
+                                             withSerializer:serializer
+                                                      error:&initError];
+        decoder.decodableData = data;
+        if (initError && error) *error = initError;
+    } else {
+        if ([aClass conformsToProtocol:@protocol(PNJSONDataDecodable)] && [data isKindOfClass:[NSData class]]) {
+            NSError *decodeError;
+            id decodedObject = [(Class<PNJSONDataDecodable>)aClass decodedObjectFromJSONData:data
+                                                                              withSerializer:serializer
+                                                                              additionalData:additionalData
+                                                                                       error:&decodeError];
+            if (decodeError && error) *error = decodeError;
+            if (decodedObject || decodeError) return decodedObject;
+        }
+
+        decoder = [[self alloc] initForReadingObjectOfClass:aClass
+                                                   fromData:data
+                                             withSerializer:serializer
+                                                      error:error];
+        *object = decoder.decodableValue;
+    }
+
+    decoder.additionalData = additionalData;
 
     id decodedObject = [decoder decodeObject];
     if (decoder.error && error) *error = decoder.error;
@@ -813,8 +854,9 @@ NS_ASSUME_NONNULL_END
 }
 
 - (id)decodedCustomObject:(id)value asInstanceOfClass:(Class)aClass {
-    [PNJSONCodableObjects makeCodableClass:aClass];
-    BOOL hasCustomDecoding = [PNJSONCodableObjects hasCustomDecodingForClass:aClass];
+    PNJSONCodecPlan *plan = aClass == self.instanceClass ? self.codecPlan : nil;
+    if (!plan) plan = [PNJSONCodableObjects codecPlanForClass:aClass];
+    BOOL hasCustomDecoding = plan.hasCustomDecoding;
     __block id decodedObject = nil;
 
     if (!hasCustomDecoding && ![[value class] isSubclassOfClass:_decDictionaryClass]) {
@@ -831,59 +873,52 @@ NS_ASSUME_NONNULL_END
                                                                      withSerializer:self.serializer
                                                                               error:&decodeError];
         decoder.additionalData = self.additionalData;
+
+        // Raw JSON data still represent decoded value only for top-level object.
+        if (value == self.decodableValue) decoder.decodableData = self.decodableData;
         decodedObject = [(id<PNCodable>)[aClass alloc] initObjectWithCoder:decoder];
     } else {
         NSDictionary *dictionaryValue = (NSDictionary *)value;
-        NSDictionary *codingKeys = self.codingKeys;
-        NSArray *optionalKeys = self.optionalKeys;
-        __block id instance = [aClass new];
-
-        if (aClass != self.instanceClass) {
-            optionalKeys = [PNJSONCodableObjects optionalKeysForClass:aClass];
-            codingKeys = [PNJSONCodableObjects codingKeysForClass:aClass];
-        }
+        const PNJSONCodecProperty *properties = plan.properties;
+        id instance = [aClass new];
 
         // Early exit in case if passed class can't be instantiated.
         if (!instance) return nil;
 
-        [codingKeys enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *mName, BOOL *stop) {
-            BOOL isDynamic = NO;
-            BOOL customClass;
-            Class class = [PNJSONCodableObjects classOfProperty:name
-                                                       forClass:aClass
-                                                         custom:&customClass
-                                                        dynamic:&isDynamic];
-            if (!class && isDynamic) {
-                class = [PNJSONCodableObjects decodingClassOfProperty:mName
+        for (NSUInteger idx = 0; idx < plan.count; idx++) {
+            const PNJSONCodecProperty *property = &properties[idx];
+            Class class = property->propertyClass;
+
+            if (property->dynamic) {
+                class = [PNJSONCodableObjects decodingClassOfProperty:property->mappedKey
                                                              forClass:aClass
                                                   inDecodedDictionary:dictionaryValue];
             }
 
-            BOOL optional = [optionalKeys containsObject:name];
-            id encodedObject = dictionaryValue[mName];
+            id encodedObject = dictionaryValue[property->mappedKey];
 
             if (encodedObject) {
-                id property;
+                id propertyValue;
 
-                if (customClass) {
-                    property = [self decodedCustomObject:encodedObject asInstanceOfClass:class];
+                if (property->custom) {
+                    propertyValue = [self decodedCustomObject:encodedObject asInstanceOfClass:class];
                 } else {
-                    property = [self decodedObject:encodedObject ofClass:class withError:YES];
+                    propertyValue = [self decodedObject:encodedObject ofClass:class withError:YES];
                 }
 
-                if (property) {
-                    [instance setValue:property forKey:name];
+                if (propertyValue) {
+                    PNJSONCodecPropertySetValue(property, instance, propertyValue);
                 } else if (self.decodingError) {
                     instance = nil;
-                    *stop = YES;
+                    break;
                 }
-            } else if (!optional) {
+            } else if (!property->optional) {
                 NSString *className = class ? NSStringFromClass(class) : @"unknown";
-                self.decodingError = [self decodingErrorObjectOfType:className forMissingKey:name];
+                self.decodingError = [self decodingErrorObjectOfType:className forMissingKey:property->name];
                 instance = nil;
-                *stop = YES;
+                break;
             }
-        }];
+        }
 
         decodedObject = instance;
     }
@@ -913,7 +948,7 @@ NS_ASSUME_NONNULL_END
 }
 
 - (BOOL)isOptionalKey:(NSString *)key {
-    return [self.optionalKeys containsObject:key];
+    return [self.codecPlan isOptionalKey:key];
 }
 
 - (id)objectFromData:(NSData *)jsonData
@@ -400,34 +400,32 @@ NS_ASSUME_NONNULL_END
 
 - (id)encodedCustomObject:(id<PNCodable>)value {
     Class objectClass = [value class];
-    __block BOOL encodingFailed = NO;
+    PNJSONCodecPlan *plan = [PNJSONCodableObjects codecPlanForClass:objectClass];
     id encodedObject = nil;
 
-    [PNJSONCodableObjects makeCodableClass:objectClass];
-
-    if ([PNJSONCodableObjects hasCustomEncodingForClass:objectClass]) {
+    if (plan.hasCustomEncoding) {
         PNJSONEncoder *encoder = [[PNJSONEncoder alloc] initWithJSONSerializer:self.serializer];
         [(id<PNCodable>)value encodeObjectWithCoder:encoder];
         [encoder finishEncoding];
 
         encodedObject = encoder.encodableValue;
     } else {
-        NSSet<NSString *> *properties = [PNJSONCodableObjects propertyListForClass:objectClass];
-        NSDictionary *codingKeyMap = [PNJSONCodableObjects codingKeysForClass:objectClass];
+        const PNJSONCodecProperty *properties = plan.properties;
         NSMutableDictionary *storage = [NSMutableDictionary new];
 
-        [codingKeyMap enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *map, BOOL *stop) {
-            if ([properties containsObject:name]) {
-                id object = [(id)value valueForKey:name];
+        for (NSUInteger idx = 0; idx < plan.count; idx++) {
+            const PNJSONCodecProperty *property = &properties[idx];
+
+            if (property->known) {
+                id object = PNJSONCodecPropertyValue(property, value);
                 // Runtime can't detect optional properties, so encode them if they are present.
-                if (object) [self encodeObject:object forKey:map in:storage];
+                if (object) [self encodeObject:object forKey:property->mappedKey in:storage];
             } else {
-                self.encodingError = [self encodingErrorForMissingProperty:name inClass:objectClass];
+                self.encodingError = [self encodingErrorForMissingProperty:property->name inClass:objectClass];
             }
 
-            encodingFailed = self.encodingError != nil;
-            *stop = encodingFailed;
-        }];
+            if (self.encodingError) break;
+        }
 
         if (!self.encodingError) encodedObject = storage;
     }
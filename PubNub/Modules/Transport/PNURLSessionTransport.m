@@ -40,8 +40,23 @@ NS_ASSUME_NONNULL_BEGIN
 @property(assign, nonatomic) UIBackgroundTaskIdentifier tasksCompletionIdentifier;
 #endif // TARGET_OS_IOS && !defined(TARGET_IS_EXTENSION)
 
-/// List of the currently active requests.
-@property(strong, nonatomic) NSMutableArray<PNTransportRequest *> *requests;
+/// Map of the currently active requests to their identifiers.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, PNTransportRequest *> *requests;
+
+/// Map of the currently active tagged requests to their tags.
+@property(strong, nonatomic)
+    NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, PNTransportRequest *> *> *taggedRequests;
+
+/// Session tasks which has been resumed and occupy slots of the connections budget.
+@property(strong, nonatomic) NSMutableSet<NSURLSessionTask *> *activeTasks;
+
+/// Session tasks which wait for a free slot in the connections budget.
+@property(strong, nonatomic) NSMutableArray<NSURLSessionTask *> *pendingTasks;
+
+/// Number of clients which use transport.
+///
+/// Transport shared between multiple clients will be invalidated only when the last of them stops using it.
+@property(assign, nonatomic) NSUInteger clientsCount;
 
 /// Transport module configuration.
 @property(copy, nonatomic) PNTransportConfiguration *configuration;
@@ -55,9 +70,6 @@ NS_ASSUME_NONNULL_BEGIN
 /// Session which should be used to create requests to remote origin endpoints.
 @property(strong, nullable, nonatomic) NSURLSession *session;
 
-/// Cancelled requests filter predicate.
-@property(strong, nonatomic) NSPredicate *cancelledPredicate;
-
 /// Unique `PubNub` transport instance identifier.
 @property(strong, nonatomic) NSString *identifier;
 
@@ -100,6 +112,34 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - State
 
+/// Store request in active requests registry.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Parameter request: Cancellable transport request which has been sent.
+- (void)registerRequest:(PNTransportRequest *)request;
+
+/// Remove request from active requests registry.
+///
+/// > Important: Method should be called within write access block.
+///
+/// - Parameter request: Transport request which has been completed or cancelled.
+- (void)unregisterRequest:(PNTransportRequest *)request;
+
+/// Resume session task if there is a free slot in the connections budget.
+///
+/// Task will be queued and resumed later if the maximum number of connections already in use.
+///
+/// - Parameter task: Session task which should be resumed.
+- (void)resumeTask:(NSURLSessionTask *)task;
+
+/// Release connections budget slot occupied by completed session task.
+///
+/// Next queued task will be resumed in place of completed task.
+///
+/// - Parameter task: Session task which has been completed.
+- (void)releaseTask:(NSURLSessionTask *)task;
+
 /// Complete background task (if any).
 ///
 /// Free up system resources when background execution context not required anymore.
@@ -155,24 +195,35 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Initialization and Configuration
 
-- (void)setupWithConfiguration:(PNTransportConfiguration *)configuration {
-    self.configuration = configuration;
-    
-    _cancelledPredicate = [NSPredicate predicateWithBlock:^BOOL(PNTransportRequest *request, __unused id bindings) {
-        return !request.cancelled;
-    }];
-    
+- (instancetype)init {
+    if ((self = [super init])) {
 #if TARGET_OS_IOS
-    _tasksCompletionIdentifier = UIBackgroundTaskInvalid;
+        _tasksCompletionIdentifier = UIBackgroundTaskInvalid;
 #endif // TARGET_OS_IOS
-    
-    _lock = [PNLock lockWithIsolationQueueName:@"transport" subsystemQueueIdentifier:@"com.pubnub.transport"];
-    _configuration = [configuration copy];
-    _requests = [NSMutableArray new];
-    
-    // Finalize transport configuration.
-    [self setupURLSession];
-    [self printIfRequiredSessionCustomizationInformation];
+
+        _lock = [PNLock lockWithIsolationQueueName:@"transport" subsystemQueueIdentifier:@"com.pubnub.transport"];
+        _requests = [NSMutableDictionary new];
+        _taggedRequests = [NSMutableDictionary new];
+        _activeTasks = [NSMutableSet new];
+        _pendingTasks = [NSMutableArray new];
+    }
+
+    return self;
+}
+
+- (void)setupWithConfiguration:(PNTransportConfiguration *)configuration {
+    __block BOOL configured = NO;
+
+    [self.lock syncWriteAccessWithBlock:^{
+        // Shared transport configured by the first client which started to use it.
+        configured = self.clientsCount++ > 0;
+        if (configured) return;
+
+        self->_configuration = [configuration copy];
+        [self setupURLSession];
+    }];
+
+    if (!configured) [self printIfRequiredSessionCustomizationInformation];
 }
 
 
@@ -182,12 +233,29 @@ NS_ASSUME_NONNULL_END
     if (!block) return;
 
     [self.lock writeAccessWithBlock:^{
-        block(self.requests);
-        // Filter out potentially cancelled requests after block has been called.
-        [self.requests filterUsingPredicate:self.cancelledPredicate];
+        block(self.requests.allValues);
+
+        // Remove potentially cancelled requests after block has been called.
+        for (PNTransportRequest *request in self.requests.allValues) {
+            if (request.cancelled) [self unregisterRequest:request];
+        }
     }];
 }
 
+- (void)cancelRequestsWithTag:(NSString *)tag {
+    __block NSArray<PNTransportRequest *> *requests;
+
+    [self.lock syncWriteAccessWithBlock:^{
+        requests = self.taggedRequests[tag].allValues;
+    }];
+
+    // Cancellation blocks unregister requests on their own.
+    for (PNTransportRequest *request in requests) {
+        dispatch_block_t cancelBlock = request.cancel;
+        if (cancelBlock) cancelBlock();
+    }
+}
+
 
 #pragma mark - Request processing
 
@@ -206,6 +274,8 @@ NS_ASSUME_NONNULL_END
     task = [session dataTaskWithRequest:urlRequest
                       completionHandler:^(NSData *data, NSURLResponse *response, NSError *error) {
         PNStrongify(self);
+        [self releaseTask:task];
+
         BOOL retriableError = error && error.code != NSURLErrorCancelled;
         NSInteger statusCode = ((NSHTTPURLResponse *)response).statusCode;
         BOOL retriableStatusCode = statusCode >= 400 && statusCode != 403;
@@ -251,13 +321,34 @@ NS_ASSUME_NONNULL_END
         session = self.session;
     }];
 
-    task = [session downloadTaskWithRequest:urlRequest
-                          completionHandler:^(NSURL *location, NSURLResponse *response, NSError *error) {
+    void(^completionHandler)(NSURL *, NSURLResponse *, NSError *);
+    BOOL resumed = request.resumeData != nil;
+
+    completionHandler = ^(NSURL *location, NSURLResponse *response, NSError *error) {
         PNStrongify(self);
+        [self releaseTask:task];
+
         BOOL retriableError = error && error.code != NSURLErrorCancelled;
         NSInteger statusCode = ((NSHTTPURLResponse *)response).statusCode;
         BOOL retriableStatusCode = statusCode >= 400 && statusCode != 403;
         NSTimeInterval delay = 0.f;
+
+        if (resumed && !error && statusCode >= 400 && !request.cancelled) {
+            // Resume information is stale (for example, pre-signed file URL expired), so download should start over.
+            [self.configuration.logger warnWithLocation:@"PNURLSessionTransport"
+                                      andMessageFactory:^PNLogEntry * {
+                NSString *message = PNStringFormat(@"Unable to resume file download (status code: %@). Restart "
+                                                   "download.", @(statusCode));
+                return [PNStringLogEntry entryWithMessage:message];
+            }];
+
+            request.resumeData = nil;
+            [self sendDownloadRequest:request withCompletionBlock:block];
+            return;
+        }
+
+        // Received part of the file will be used by the next attempt to continue download with `Range` request.
+        request.resumeData = error.userInfo[NSURLSessionDownloadTaskResumeDataKey];
         
         if ((retriableError || retriableStatusCode) && request.retriable && !request.cancelled) {
             PNRequestRetryConfiguration *retry = self.configuration.retryConfiguration;
@@ -284,7 +375,15 @@ NS_ASSUME_NONNULL_END
                   [self errorForRequest:request withURL:task.originalRequest.URL error:error]
             );
         }
-    }];
+    };
+
+    if (resumed) {
+        task = [session downloadTaskWithResumeData:request.resumeData completionHandler:completionHandler];
+        [self.configuration.logger debugWithLocation:@"PNURLSessionTransport"
+                                   andMessageFactory:^PNLogEntry * {
+            return [PNStringLogEntry entryWithMessage:@"Resume interrupted file download."];
+        }];
+    } else task = [session downloadTaskWithRequest:urlRequest completionHandler:completionHandler];
     
     [self sendRequest:request withSessionTask:task];
 }
@@ -292,7 +391,7 @@ NS_ASSUME_NONNULL_END
 - (void)sendRequest:(PNTransportRequest *)request withSessionTask:(NSURLSessionTask *)task {
     if (request.cancellable) {
         [self.lock writeAccessWithBlock:^{
-            [self.requests addObject:request];
+            [self registerRequest:request];
         }];
 
         __weak __typeof(request) weakRequest = request;
@@ -309,10 +408,12 @@ NS_ASSUME_NONNULL_END
 
             [self.lock writeAccessWithBlock:^{
                 __strong __typeof__(weakRequest) strongRequest = weakRequest;
-                if (strongRequest) [self.requests removeObject:strongRequest];
+                if (strongRequest) [self unregisterRequest:strongRequest];
             }];
 
-            if (cancelled || taskState != NSURLSessionTaskStateRunning) return;
+            // Suspended task is waiting in the queue for a free slot in the connections budget.
+            BOOL started = taskState == NSURLSessionTaskStateRunning || taskState == NSURLSessionTaskStateSuspended;
+            if (cancelled || !started) return;
             
             [self.configuration.logger traceWithLocation:@"PNURLSessionTransport"
                                               andMessage:[PNStringLogEntry entryWithMessage:@"On-demand request aborting"]];
@@ -321,11 +422,14 @@ NS_ASSUME_NONNULL_END
                 return [PNNetworkRequestLogEntry entryWithMessage:weakRequest details:@"Aborted" canceled:YES failed:NO];
             }];
 
-            [task cancel];
+            // Already received part of the file can be used later to continue download.
+            if ([task isKindOfClass:[NSURLSessionDownloadTask class]]) {
+                [(NSURLSessionDownloadTask *)task cancelByProducingResumeData:^(__unused NSData *resumeData) {}];
+            } else [task cancel];
         };
     }
 
-    [task resume];
+    [self resumeTask:task];
 }
 
 - (PNTransportRequest *)transportRequestFromTransportRequest:(PNTransportRequest *)request {
@@ -335,6 +439,7 @@ NS_ASSUME_NONNULL_END
     NSMutableDictionary *headers = [(self.HTTPAdditionalHeaders ?: @{}) mutableCopy];
     [headers addEntriesFromDictionary:request.headers];
 
+    // Stream bodies (file uploads) are sent uncompressed.
     if ((request.method == TransportPOSTMethod || request.method == TransportPATCHMethod) &&
         !request.bodyStreamAvailable && request.shouldCompressBody) {
         NSUInteger bodyLength = request.body.length;
@@ -344,7 +449,7 @@ NS_ASSUME_NONNULL_END
         
         [self.configuration.logger traceWithLocation:@"PNURLSessionTransport"
                                   andMessageFactory:^PNLogEntry * {
-            double compressionRatio = bodyLength / request.body.length ;
+            double compressionRatio = (double)bodyLength / MAX(request.body.length, 1);
             return [PNStringLogEntry entryWithMessage:PNStringFormat(@"Body of %@ bytes, compressed by %.2fx to %@ bytes.",
                                                                      @(bodyLength), compressionRatio, @(request.body.length))];
         }];
@@ -361,7 +466,7 @@ NS_ASSUME_NONNULL_END
                                     data:(NSData *)data {
     [self.lock writeAccessWithBlock:^{
         request.cancel = nil;
-        [self.requests removeObject:request];
+        [self unregisterRequest:request];
         NSUInteger activeRequestsCount = self.requests.count;
 
         if (activeRequestsCount == 0) [self endBackgroundTasksCompletionIfRequired];
@@ -401,6 +506,56 @@ NS_ASSUME_NONNULL_END
     [self endBackgroundTasksCompletionIfRequired];
 }
 
+- (void)resumeTask:(NSURLSessionTask *)task {
+    [self.lock writeAccessWithBlock:^{
+        if (self.activeTasks.count < MAX(self.configuration.maximumConnections, 1)) {
+            [self.activeTasks addObject:task];
+            [task resume];
+        } else [self.pendingTasks addObject:task];
+    }];
+}
+
+- (void)releaseTask:(NSURLSessionTask *)task {
+    [self.lock writeAccessWithBlock:^{
+        if (![self.activeTasks containsObject:task]) {
+            [self.pendingTasks removeObject:task];
+            return;
+        }
+
+        [self.activeTasks removeObject:task];
+
+        while (self.pendingTasks.count) {
+            NSURLSessionTask *pendingTask = self.pendingTasks.firstObject;
+            [self.pendingTasks removeObjectAtIndex:0];
+
+            // Skip tasks which has been cancelled while were waiting in the queue.
+            if (pendingTask.state != NSURLSessionTaskStateSuspended) continue;
+
+            [self.activeTasks addObject:pendingTask];
+            [pendingTask resume];
+            break;
+        }
+    }];
+}
+
+- (void)registerRequest:(PNTransportRequest *)request {
+    self.requests[request.identifier] = request;
+    if (!request.tag) return;
+
+    NSMutableDictionary<NSString *, PNTransportRequest *> *requests = self.taggedRequests[request.tag];
+    if (!requests) self.taggedRequests[request.tag] = requests = [NSMutableDictionary new];
+    requests[request.identifier] = request;
+}
+
+- (void)unregisterRequest:(PNTransportRequest *)request {
+    [self.requests removeObjectForKey:request.identifier];
+    if (!request.tag) return;
+
+    NSMutableDictionary<NSString *, PNTransportRequest *> *requests = self.taggedRequests[request.tag];
+    [requests removeObjectForKey:request.identifier];
+    if (requests.count == 0) [self.taggedRequests removeObjectForKey:request.tag];
+}
+
 - (void)endBackgroundTasksCompletionIfRequired {
 #if TARGET_OS_OSX
     if (self.tasksCompletionIdentifier == nil) return;
@@ -420,6 +575,9 @@ NS_ASSUME_NONNULL_END
 
 - (void)invalidate {
     [self.lock writeAccessWithBlock:^{
+        // Shared transport should stay active while it is used by other clients.
+        if (self.clientsCount > 0 && --self.clientsCount > 0) return;
+
         [self endBackgroundTasksCompletionIfRequired];
         [self.session invalidateAndCancel];
         self->_session = nil;
@@ -432,7 +590,7 @@ NS_ASSUME_NONNULL_END
 - (void)setupURLSession {
     NSURLSessionConfiguration *configuration = [self urlSessionConfiguration];
     NSOperationQueue *queue = [NSOperationQueue new];
-    queue.maxConcurrentOperationCount = configuration.HTTPMaximumConnectionsPerHost;
+    queue.maxConcurrentOperationCount = MAX(self.configuration.maximumConnections, 1);
     self.session = [NSURLSession sessionWithConfiguration:configuration delegate:self delegateQueue:queue];
 }
 
@@ -441,7 +599,9 @@ NS_ASSUME_NONNULL_END
     NSURLSessionConfiguration *configuration = nil;
     
     configuration = [NSURLSessionConfiguration pn_ephemeralSessionConfigurationWithIdentifier:self.identifier];
-    configuration.HTTPMaximumConnectionsPerHost = self.configuration.maximumConnections;
+    // Multiplexed requests sent as HTTP/2 streams over single connection and limited only by connections budget.
+    if (self.configuration.shouldMultiplexRequests) configuration.HTTPMaximumConnectionsPerHost = 1;
+    else configuration.HTTPMaximumConnectionsPerHost = self.configuration.maximumConnections;
     _HTTPAdditionalHeaders = [configuration.HTTPAdditionalHeaders copy];
     _cachePolicy = configuration.requestCachePolicy;
     
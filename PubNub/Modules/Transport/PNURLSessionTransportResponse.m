@@ -1,4 +1,5 @@
 #import "PNURLSessionTransportResponse.h"
+#import "PNGZIP.h"
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -82,12 +83,20 @@ NS_ASSUME_NONNULL_END
 - (instancetype)initWithNSURLResponse:(NSURLResponse *)response data:(NSData *)data {
     if ((self = [super init])) {
         _response = (NSHTTPURLResponse *)response;
-        _data = data;
         
         NSDictionary *responseHeaders = _response.allHeaderFields;
         NSMutableDictionary *headers = [NSMutableDictionary dictionaryWithCapacity:responseHeaders.count];
         for (NSString *header in responseHeaders.allKeys) headers[header.lowercaseString] = responseHeaders[header];
         _headers = headers;
+
+        // `NSURLSession` usually decompress body on its own, but keeps `Content-Encoding` header.
+        NSString *encoding = [headers[@"content-encoding"] lowercaseString];
+        if (([encoding isEqualToString:@"gzip"] || [encoding isEqualToString:@"deflate"]) &&
+            [PNGZIP isCompressedData:data]) {
+            data = [PNGZIP GZIPInflatedData:data] ?: data;
+        }
+
+        _data = data;
     }
     
     return self;
@@ -0,0 +1,57 @@
+#import <Foundation/Foundation.h>
+#import "PNSubscribeCursorData.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Subscribe response envelope parser.
+///
+/// Parser walks through raw subscribe response bytes once and builds real-time updates without intermediate
+/// `NSDictionary` representation of the whole response. Regular messages and signals are created directly from scanned
+/// fields (payload kept as slice of response data and de-serialized on first access), while other event types are
+/// materialized as `NSDictionary` for further processing.
+///
+/// > Note: Parser reports failure for any unexpected envelope structure and it is expected that response will be
+/// processed by general purpose JSON decoder in this case.
+@interface PNSubscribeEnvelopeParser : NSObject
+
+
+#pragma mark - Properties
+
+/// Next subscription cursor.
+@property(strong, nullable, nonatomic, readonly) PNSubscribeCursorData *cursor;
+
+/// List of parsed real-time updates.
+///
+/// List contains `PNSubscribeMessageEventData` / `PNSubscribeSignalEventData` instances for events which has been
+/// created directly from scanned data and `NSDictionary` instances for events which require additional processing.
+@property(strong, nullable, nonatomic, readonly) NSArray *updates;
+
+/// Buffer with `uint32_t` payload fingerprint for each entry in ``updates``.
+@property(strong, nullable, nonatomic, readonly) NSData *fingerprints;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure subscribe response envelope parser.
+///
+/// - Parameter data: Raw subscribe response JSON data.
+/// - Returns: Configured and ready to use subscribe response envelope parser.
++ (instancetype)parserWithData:(NSData *)data;
+
+
+#pragma mark - Parse
+
+/// Parse subscribe response envelope.
+///
+/// - Returns: `YES` in case if whole response has been parsed and ``cursor`` with ``updates`` is ready.
+- (BOOL)parse;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
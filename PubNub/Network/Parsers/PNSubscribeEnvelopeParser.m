@@ -0,0 +1,438 @@
+#import "PNSubscribeEnvelopeParser.h"
+#import "PNSubscribeMessageEventData+Private.h"
+#import "PNSubscribeCursorData+Private.h"
+#import "PNSubscribeEventData+Private.h"
+#import "PNSubscribeSignalEventData.h"
+#import "PNPrivateStructures.h"
+#import "PNJSONScanner.h"
+#import "PNFunctions.h"
+#import "PNHelpers.h"
+
+
+#pragma mark Types and structures
+
+/// Raw real-time update fields.
+///
+/// Each field stores range of raw value bytes (including string quotes and collection brackets) or `NSNotFound`
+/// location if field is missing in real-time update.
+typedef struct PNSubscribeEnvelopeUpdate {
+    /// Shard identifier (`a`).
+    NSRange shard;
+
+    /// Subscription name (`b`).
+    NSRange subscription;
+
+    /// Channel name (`c`).
+    NSRange channel;
+
+    /// Event payload (`d`).
+    NSRange payload;
+
+    /// Event type (`e`).
+    NSRange type;
+
+    /// Debug flags (`f`).
+    NSRange flags;
+
+    /// Sender identifier (`i`).
+    NSRange sender;
+
+    /// Publish sequence number (`s`).
+    NSRange sequence;
+
+    /// Event publish time cursor (`p`).
+    NSRange publishTimetoken;
+
+    /// User-defined publish time cursor (`o`).
+    NSRange userTimetoken;
+
+    /// User-provided metadata (`u`).
+    NSRange metadata;
+
+    /// User-specified message type (`cmt`).
+    NSRange customMessageType;
+} PNSubscribeEnvelopeUpdate;
+
+
+#pragma mark - Helpers
+
+/// Check whether field is present in scanned real-time update.
+static inline BOOL PNSubscribeEnvelopeHasField(NSRange field) {
+    return field.location != NSNotFound;
+}
+
+/// Create real-time update fields storage with all fields marked as missing.
+static PNSubscribeEnvelopeUpdate PNSubscribeEnvelopeUpdateMake(void) {
+    PNSubscribeEnvelopeUpdate update;
+    NSRange *fields = (NSRange *)&update;
+
+    for (NSUInteger idx = 0; idx < sizeof(update) / sizeof(NSRange); idx++) fields[idx] = NSMakeRange(NSNotFound, 0);
+
+    return update;
+}
+
+/// Retrieve storage for real-time update field value range.
+///
+/// - Parameters:
+///   - update: Real-time update fields storage.
+///   - scanner: Scanner which has been used to scan `key`.
+///   - key: Range of raw key characters.
+/// - Returns: Pointer to the field range or `NULL` if field not used by parser.
+static NSRange *PNSubscribeEnvelopeUpdateField(PNSubscribeEnvelopeUpdate *update,
+                                               const PNJSONScanner *scanner,
+                                               NSRange key) {
+    if (PNJSONScannerKeyIsEqual(scanner, key, "cmt")) return &update->customMessageType;
+    if (key.length != 1) return NULL;
+
+    switch (scanner->bytes[key.location]) {
+        case 'a': return &update->shard;
+        case 'b': return &update->subscription;
+        case 'c': return &update->channel;
+        case 'd': return &update->payload;
+        case 'e': return &update->type;
+        case 'f': return &update->flags;
+        case 'i': return &update->sender;
+        case 's': return &update->sequence;
+        case 'p': return &update->publishTimetoken;
+        case 'o': return &update->userTimetoken;
+        case 'u': return &update->metadata;
+        default: return NULL;
+    }
+}
+
+/// De-serialize value from its slice of JSON data.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan value.
+///   - range: Range of raw value bytes.
+/// - Returns: De-serialized value or `nil` in case of malformed data.
+static id PNSubscribeEnvelopeObject(const PNJSONScanner *scanner, NSRange range) {
+    NSData *data = [NSData dataWithBytesNoCopy:(void *)(scanner->bytes + range.location)
+                                        length:range.length
+                                  freeWhenDone:NO];
+
+    return [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:nil];
+}
+
+/// Create string from raw JSON string value.
+///
+/// Strings without escape sequences created directly from UTF-8 bytes.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan value.
+///   - range: Range of raw value bytes (including quotes).
+/// - Returns: String or `nil` in case if value is not JSON string.
+static NSString *PNSubscribeEnvelopeString(const PNJSONScanner *scanner, NSRange range) {
+    const uint8_t *bytes = scanner->bytes + range.location;
+    if (range.length < 2 || bytes[0] != '"') return nil;
+
+    if (memchr(bytes + 1, '\\', range.length - 2)) {
+        NSString *string = PNSubscribeEnvelopeObject(scanner, range);
+        return [string isKindOfClass:[NSString class]] ? string : nil;
+    }
+
+    return [[NSString alloc] initWithBytes:bytes + 1 length:range.length - 2 encoding:NSUTF8StringEncoding];
+}
+
+/// Parse integer from raw JSON number value.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan value.
+///   - range: Range of raw value bytes.
+///   - value: Pointer which will be used to store parsed value.
+/// - Returns: `YES` in case if whole value has been parsed as integer.
+static BOOL PNSubscribeEnvelopeInteger(const PNJSONScanner *scanner, NSRange range, long long *value) {
+    const uint8_t *bytes = scanner->bytes + range.location;
+    BOOL negative = range.length > 0 && bytes[0] == '-';
+    NSUInteger idx = negative ? 1 : 0;
+    unsigned long long result = 0;
+
+    if (range.length == idx || range.length - idx > 18) return NO;
+
+    for (; idx < range.length; idx++) {
+        if (bytes[idx] < '0' || bytes[idx] > '9') return NO;
+        result = result * 10 + (bytes[idx] - '0');
+    }
+
+    *value = negative ? -(long long)result : (long long)result;
+
+    return YES;
+}
+
+/// Parse timetoken from raw JSON string or number value.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan value.
+///   - range: Range of raw value bytes.
+///   - value: Pointer which will be used to store parsed value.
+/// - Returns: `YES` in case if whole value has been parsed as unsigned integer.
+static BOOL PNSubscribeEnvelopeTimetoken(const PNJSONScanner *scanner, NSRange range, unsigned long long *value) {
+    const uint8_t *bytes = scanner->bytes + range.location;
+    unsigned long long result = 0;
+
+    if (range.length >= 2 && bytes[0] == '"' && bytes[range.length - 1] == '"') {
+        range.length -= 2;
+        bytes++;
+    }
+
+    if (range.length == 0 || range.length > 19) return NO;
+
+    for (NSUInteger idx = 0; idx < range.length; idx++) {
+        if (bytes[idx] < '0' || bytes[idx] > '9') return NO;
+        result = result * 10 + (bytes[idx] - '0');
+    }
+
+    *value = result;
+
+    return YES;
+}
+
+/// Create time cursor from raw JSON object value.
+///
+/// - Parameters:
+///   - scanner: Scanner which has been used to scan value.
+///   - range: Range of raw value bytes.
+/// - Returns: Time cursor or `nil` in case if value doesn't have expected structure.
+static PNSubscribeCursorData *PNSubscribeEnvelopeCursor(const PNJSONScanner *scanner, NSRange range) {
+    PNJSONScanner cursorScanner = { scanner->bytes, NSMaxRange(range), range.location, NO };
+    NSRange timetokenRange = NSMakeRange(NSNotFound, 0);
+    NSRange regionRange = NSMakeRange(NSNotFound, 0);
+    unsigned long long timetoken;
+    long long region;
+    NSRange key;
+
+    if (!PNJSONScannerBeginObject(&cursorScanner)) return nil;
+
+    while (PNJSONScannerNextMember(&cursorScanner, &key)) {
+        NSRange *field = NULL;
+        if (PNJSONScannerKeyIsEqual(&cursorScanner, key, "t")) field = &timetokenRange;
+        else if (PNJSONScannerKeyIsEqual(&cursorScanner, key, "r")) field = &regionRange;
+
+        if (!PNJSONScannerSkipValue(&cursorScanner, field)) return nil;
+    }
+
+    if (cursorScanner.failed || !PNSubscribeEnvelopeHasField(timetokenRange) ||
+        !PNSubscribeEnvelopeTimetoken(&cursorScanner, timetokenRange, &timetoken)) {
+        return nil;
+    }
+
+    if (PNSubscribeEnvelopeHasField(regionRange) && !PNSubscribeEnvelopeInteger(&cursorScanner, regionRange, &region)) {
+        return nil;
+    }
+
+    return [PNSubscribeCursorData cursorWithTimetoken:@(timetoken)
+                                               region:PNSubscribeEnvelopeHasField(regionRange) ? @(region) : nil];
+}
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/// Subscribe response envelope parser private extension.
+@interface PNSubscribeEnvelopeParser ()
+
+
+#pragma mark - Properties
+
+/// Next subscription cursor.
+@property(strong, nullable, nonatomic) PNSubscribeCursorData *cursor;
+
+/// List of parsed real-time updates.
+@property(strong, nullable, nonatomic) NSArray *updates;
+
+/// Buffer with `uint32_t` payload fingerprint for each entry in ``updates``.
+@property(strong, nullable, nonatomic) NSData *fingerprints;
+
+/// Raw subscribe response JSON data.
+@property(strong, nonatomic) NSData *data;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize subscribe response envelope parser.
+///
+/// - Parameter data: Raw subscribe response JSON data.
+/// - Returns: Initialized subscribe response envelope parser.
+- (instancetype)initWithData:(NSData *)data;
+
+
+#pragma mark - Parse
+
+/// Parse list of real-time updates (`m` field).
+///
+/// - Parameter scanner: Scanner positioned at the beginning of real-time updates array.
+/// - Returns: `YES` in case if all real-time updates has been parsed.
+- (BOOL)parseUpdatesWithScanner:(PNJSONScanner *)scanner;
+
+/// Create `message` or `signal` event from scanned real-time update fields.
+///
+/// - Parameters:
+///   - update: Raw real-time update fields.
+///   - scanner: Scanner which has been used to scan real-time update.
+/// - Returns: Event data object or `nil` in case if real-time update should be processed as `NSDictionary`.
+- (nullable PNSubscribeEventData *)eventFromUpdate:(const PNSubscribeEnvelopeUpdate *)update
+                                           scanner:(const PNJSONScanner *)scanner;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNSubscribeEnvelopeParser
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)parserWithData:(NSData *)data {
+    return [[self alloc] initWithData:data];
+}
+
+- (instancetype)initWithData:(NSData *)data {
+    if ((self = [super init])) _data = data;
+
+    return self;
+}
+
+
+#pragma mark - Parse
+
+- (BOOL)parse {
+    PNJSONScanner scanner = PNJSONScannerMake(self.data);
+    PNSubscribeCursorData *cursor;
+    BOOL hasUpdates = NO;
+    NSRange range;
+
+    if (!PNJSONScannerBeginObject(&scanner)) return NO;
+
+    while (PNJSONScannerNextMember(&scanner, &range)) {
+        if (PNJSONScannerKeyIsEqual(&scanner, range, "t")) {
+            if (!PNJSONScannerSkipValue(&scanner, &range)) return NO;
+            if (!(cursor = PNSubscribeEnvelopeCursor(&scanner, range))) return NO;
+        } else if (PNJSONScannerKeyIsEqual(&scanner, range, "m")) {
+            if (![self parseUpdatesWithScanner:&scanner]) return NO;
+            hasUpdates = YES;
+        } else if (!PNJSONScannerSkipValue(&scanner, NULL)) return NO;
+    }
+
+    if (scanner.failed || !PNJSONScannerIsAtEnd(&scanner) || !cursor || !hasUpdates) return NO;
+    self.cursor = cursor;
+
+    return YES;
+}
+
+- (BOOL)parseUpdatesWithScanner:(PNJSONScanner *)scanner {
+    if (!PNJSONScannerBeginArray(scanner)) return NO;
+
+    NSMutableData *fingerprints = [NSMutableData new];
+    NSMutableArray *updates = [NSMutableArray new];
+    NSRange range;
+
+    while (PNJSONScannerNextElement(scanner)) {
+        PNSubscribeEnvelopeUpdate update = PNSubscribeEnvelopeUpdateMake();
+        NSUInteger start = scanner->position;
+
+        if (!PNJSONScannerBeginObject(scanner)) return NO;
+
+        while (PNJSONScannerNextMember(scanner, &range)) {
+            NSRange *field = PNSubscribeEnvelopeUpdateField(&update, scanner, range);
+            if (!PNJSONScannerSkipValue(scanner, field)) return NO;
+        }
+
+        if (scanner->failed) return NO;
+
+        BOOL hasPayload = PNSubscribeEnvelopeHasField(update.payload);
+        uint32_t fingerprint = PNMessageFingerprintFromBytes(hasPayload ? scanner->bytes + update.payload.location : NULL,
+                                                             hasPayload ? update.payload.length : 0);
+        id event = [self eventFromUpdate:&update scanner:scanner];
+
+        if (!event) {
+            event = PNSubscribeEnvelopeObject(scanner, NSMakeRange(start, scanner->position - start));
+            if (![event isKindOfClass:[NSDictionary class]]) return NO;
+        }
+
+        [fingerprints appendBytes:&fingerprint length:sizeof(uint32_t)];
+        [updates addObject:event];
+    }
+
+    if (scanner->failed) return NO;
+
+    self.fingerprints = fingerprints;
+    self.updates = updates;
+
+    return YES;
+}
+
+- (PNSubscribeEventData *)eventFromUpdate:(const PNSubscribeEnvelopeUpdate *)update
+                                  scanner:(const PNJSONScanner *)scanner {
+    long long type = PNRegularMessageType;
+    long long sequence;
+    long long flags;
+
+    if (PNSubscribeEnvelopeHasField(update->type) && !PNSubscribeEnvelopeInteger(scanner, update->type, &type)) {
+        return nil;
+    }
+
+    // Only messages and signals can be created without additional payload processing.
+    if ((type != PNRegularMessageType && type != PNSignalMessageType) || !PNSubscribeEnvelopeHasField(update->shard) ||
+        !PNSubscribeEnvelopeHasField(update->flags) || !PNSubscribeEnvelopeHasField(update->publishTimetoken) ||
+        !PNSubscribeEnvelopeHasField(update->channel) || !PNSubscribeEnvelopeHasField(update->payload) ||
+        !PNSubscribeEnvelopeInteger(scanner, update->flags, &flags)) {
+        return nil;
+    }
+
+    NSString *channel = PNSubscribeEnvelopeString(scanner, update->channel);
+    if (!channel || [PNChannel isPresenceObject:channel]) return nil;
+
+    NSString *shard = PNSubscribeEnvelopeString(scanner, update->shard);
+    PNSubscribeCursorData *publishTimetoken = PNSubscribeEnvelopeCursor(scanner, update->publishTimetoken);
+    if (!shard || !publishTimetoken) return nil;
+
+    NSString *subscription, *sender, *customMessageType;
+    PNSubscribeCursorData *userTimetoken;
+    NSDictionary *metadata;
+
+    if (PNSubscribeEnvelopeHasField(update->subscription) &&
+        !(subscription = PNSubscribeEnvelopeString(scanner, update->subscription))) return nil;
+    if (PNSubscribeEnvelopeHasField(update->sender) &&
+        !(sender = PNSubscribeEnvelopeString(scanner, update->sender))) return nil;
+    if (PNSubscribeEnvelopeHasField(update->customMessageType) &&
+        !(customMessageType = PNSubscribeEnvelopeString(scanner, update->customMessageType))) return nil;
+    if (PNSubscribeEnvelopeHasField(update->userTimetoken) &&
+        !(userTimetoken = PNSubscribeEnvelopeCursor(scanner, update->userTimetoken))) return nil;
+    if (PNSubscribeEnvelopeHasField(update->sequence) &&
+        !PNSubscribeEnvelopeInteger(scanner, update->sequence, &sequence)) return nil;
+    if (PNSubscribeEnvelopeHasField(update->metadata)) {
+        metadata = PNSubscribeEnvelopeObject(scanner, update->metadata);
+        if (![metadata isKindOfClass:[NSDictionary class]]) return nil;
+    }
+
+    Class eventClass = type == PNRegularMessageType ? [PNSubscribeMessageEventData class]
+                                                    : [PNSubscribeSignalEventData class];
+    PNSubscribeMessageEventData *event = [eventClass new];
+    event.sequenceNumber = PNSubscribeEnvelopeHasField(update->sequence) ? @(sequence) : nil;
+    event.customMessageType = customMessageType;
+    event.publishTimetoken = publishTimetoken;
+    event.userTimetoken = userTimetoken;
+    event.subscription = subscription;
+    event.senderIdentifier = sender;
+    event.messageType = @(type);
+    event.debugFlags = @(flags);
+    event.userMetadata = metadata;
+    event.shardIdentifier = shard;
+    event.channel = channel;
+    // Payload de-serialized only when message accessed (by decryption or by listener).
+    [event setMessageData:self.data range:update->payload];
+
+    return event;
+}
+
+#pragma mark -
+
+
+@end
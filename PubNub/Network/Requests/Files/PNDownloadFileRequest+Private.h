@@ -26,6 +26,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Name under which uploaded `file` is stored for `channel`.
 @property(copy, nonatomic, readonly) NSString *name;
 
+/// Information from previous interrupted download which allows continuing it from the received offset.
+@property(strong, nullable, nonatomic) NSData *resumeData;
+
 #pragma mark -
 
 
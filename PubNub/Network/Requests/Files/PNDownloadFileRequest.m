@@ -1,6 +1,6 @@
 #import "PNDownloadFileRequest+Private.h"
 #import "PNBaseRequest+Private.h"
-#import "PNTransportRequest.h"
+#import "PNTransportRequest+Private.h"
 #import "PNFunctions.h"
 #import "PNHelpers.h"
 
@@ -30,6 +30,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Name under which uploaded `file` is stored for `channel`.
 @property(copy, nonatomic) NSString *name;
 
+/// Information from previous interrupted download which allows continuing it from the received offset.
+@property(strong, nullable, nonatomic) NSData *resumeData;
+
 
 #pragma mark - Initialization and configuration
 
@@ -73,6 +76,13 @@ NS_ASSUME_NONNULL_END
     return YES;
 }
 
+- (PNTransportRequest *)request {
+    PNTransportRequest *request = super.request;
+    request.resumeData = self.resumeData;
+
+    return request;
+}
+
 - (NSString *)path {
     return PNStringFormat(@"/v1/files/%@/channels/%@/files/%@/%@",
                           self.subscribeKey,
@@ -25,6 +25,15 @@ NS_ASSUME_NONNULL_BEGIN
 /// Name with which uploaded file should be stored.
 @property(strong, nonatomic) NSString *filename;
 
+/// Number of file bytes which has been passed to the transport.
+@property(assign, readonly, nonatomic) NSUInteger uploadedBytes;
+
+/// Time which has been spent to pass file data to the transport.
+@property(assign, readonly, nonatomic) NSTimeInterval uploadDuration;
+
+/// Time which transport spent waiting for the next portion of read (and encrypted) file data.
+@property(assign, readonly, nonatomic) NSTimeInterval uploadStallTime;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -1,6 +1,7 @@
 #import "PNFileUploadRequest.h"
 #import "PNTransportRequest+Private.h"
 #import "NSInputStream+PNCrypto.h"
+#import "PNPipelinedInputStream.h"
 #import "PNSequenceInputStream.h"
 #import "PNBaseRequest+Private.h"
 #import "PNFunctions.h"
@@ -10,9 +11,18 @@
 #endif // __has_include(<UniformTypeIdentifiers/UniformTypeIdentifiers.h>)
 
 
+#pragma mark Constants
+
+/// Size of each buffer which is used to prepare (read and encrypt) file data ahead of transport.
+static NSUInteger const kPNFileUploadPipelineBufferSize = 256 * 1024;
+
+/// Maximum number of buffers with prepared file data which can be held in memory.
+static NSUInteger const kPNFileUploadPipelineBuffersCount = 4;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Private interface declaration
+#pragma mark - Private interface declaration
 
 /// `File data upload` request private extension.
 @interface PNFileUploadRequest ()
@@ -26,6 +36,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Pre-processed body input stream.
 @property(strong, nonatomic) NSInputStream *httpBodyInputStream;
 
+/// Stream which prepares file data ahead of transport.
+@property(strong, nullable, nonatomic) PNPipelinedInputStream *fileDataStream;
+
 /// List of fields which should be sent as `multipart/form-data` fields.
 @property(strong, nonatomic) NSArray<NSDictionary *> *formData;
 
@@ -122,6 +135,18 @@ NS_ASSUME_NONNULL_END
     return request;
 }
 
+- (NSUInteger)uploadedBytes {
+    return self.fileDataStream.bytesRead;
+}
+
+- (NSTimeInterval)uploadDuration {
+    return self.fileDataStream.duration;
+}
+
+- (NSTimeInterval)uploadStallTime {
+    return self.fileDataStream.readerStallTime;
+}
+
 - (NSInputStream *)bodyStream {
     return self.httpBodyInputStream ?: _bodyStream;
 }
@@ -265,7 +290,10 @@ NS_ASSUME_NONNULL_END
         }
     }
     [streamLengths addObject:fileStreamSize];
-    [inputStreams addObject:stream];
+    self.fileDataStream = [PNPipelinedInputStream inputStreamWithInputStream:stream
+                                                                  bufferSize:kPNFileUploadPipelineBufferSize
+                                                                buffersCount:kPNFileUploadPipelineBuffersCount];
+    [inputStreams addObject:self.fileDataStream];
 
     NSData *multipartFormEndData = [self multipartFormEndDataWithBoundary:boundary];
     [streamLengths addObject:@(multipartFormEndData.length)];
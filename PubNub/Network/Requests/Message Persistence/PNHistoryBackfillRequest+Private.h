@@ -0,0 +1,23 @@
+#import "PNHistoryBackfillRequest.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// `History backfill` request private extension.
+@interface PNHistoryBackfillRequest (Private)
+
+
+#pragma mark - Misc
+
+/// Serialize request object.
+///
+/// - Returns: Request object data represented as `NSDictionary`.
+- (NSDictionary *)dictionaryRepresentation;
+
+#pragma mark -
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,79 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface implementation
+
+/// `History backfill` request.
+///
+/// Request describe timetoken range which should be pulled out from storage for set of channels. Range split into
+/// equal timetoken windows and messages from each window streamed out in timetoken order as soon as all channels'
+/// messages for it has been fetched.
+@interface PNHistoryBackfillRequest : NSObject
+
+
+#pragma mark - Properties
+
+/// List of channel names for which events should be pulled out from storage.
+@property(copy, nonatomic, readonly) NSArray<NSString *> *channels;
+
+/// Progress token from previous backfill of the same range.
+///
+/// Token can be taken from ``PNHistoryBackfillProgress/token`` passed to the batch or completion block. When set,
+/// backfill will continue from the first window which hasn't been passed to the batch block.
+@property(copy, nullable, nonatomic) NSString *progressToken;
+
+/// Maximum number of concurrent `fetch history` requests.
+///
+/// > Note: By default set to `0` which means that ``PNConfiguration/maximumServiceConnections`` will be used.
+@property(assign, nonatomic) NSUInteger maximumConcurrentRequests;
+
+/// Number of timetoken windows into which range should be split.
+///
+/// Each window is fetched independently (one request chain per channel) and passed to the batch block as a single
+/// batch.
+///
+/// > Note: By default set to `10`.
+@property(assign, nonatomic) NSUInteger windowsCount;
+
+/// Include events' metadata presence flag.
+///
+/// Each fetched entry will contain published data under `message` key and published message `meta` will be available
+/// under `metadata` key.
+@property(assign, nonatomic) BOOL includeMetadata;
+
+/// Backfill range start timetoken.
+///
+/// Timetoken of the oldest event which should be returned (inclusive).
+@property(strong, nonatomic, readonly) NSNumber *start;
+
+/// Backfill range end timetoken.
+///
+/// Timetoken of the newest event which should be returned (inclusive).
+@property(strong, nonatomic, readonly) NSNumber *end;
+
+
+#pragma mark - Initialization and Constructor
+
+/// Create `History backfill` request.
+///
+/// - Parameters:
+///   - channels: List of channel names for which events should be pulled out from storage.
+///   - start: Timetoken of the oldest event which should be returned (inclusive).
+///   - end: Timetoken of the newest event which should be returned (inclusive).
+/// - Returns: Ready to use `History backfill` request.
++ (instancetype)requestWithChannels:(NSArray<NSString *> *)channels start:(NSNumber *)start end:(NSNumber *)end;
+
+/// Forbids request initialization.
+///
+/// - Returns: Initialized request.
+/// - Throws: Interface not available exception and requirement to use provided constructor method.
+- (instancetype)init NS_UNAVAILABLE;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
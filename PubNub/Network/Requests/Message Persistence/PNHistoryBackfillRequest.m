@@ -0,0 +1,88 @@
+#import "PNHistoryBackfillRequest+Private.h"
+
+
+#pragma mark Constants
+
+/// Default number of timetoken windows into which backfill range is split.
+static NSUInteger const kPNHistoryBackfillDefaultWindowsCount = 10;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/// `History backfill` request private extension.
+@interface PNHistoryBackfillRequest ()
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize `History backfill` request.
+///
+/// - Parameters:
+///   - channels: List of channel names for which events should be pulled out from storage.
+///   - start: Timetoken of the oldest event which should be returned (inclusive).
+///   - end: Timetoken of the newest event which should be returned (inclusive).
+/// - Returns: Initialized `History backfill` request.
+- (instancetype)initWithChannels:(NSArray<NSString *> *)channels start:(NSNumber *)start end:(NSNumber *)end;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNHistoryBackfillRequest
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)requestWithChannels:(NSArray<NSString *> *)channels start:(NSNumber *)start end:(NSNumber *)end {
+    return [[self alloc] initWithChannels:channels start:start end:end];
+}
+
+- (instancetype)initWithChannels:(NSArray<NSString *> *)channels start:(NSNumber *)start end:(NSNumber *)end {
+    if ((self = [super init])) {
+        _windowsCount = kPNHistoryBackfillDefaultWindowsCount;
+        _channels = [channels copy];
+        _start = start;
+        _end = end;
+    }
+
+    return self;
+}
+
+- (instancetype)init {
+    NSDictionary *errorInformation = @{ NSLocalizedRecoverySuggestionErrorKey: @"Use provided request constructor" };
+
+    @throw [NSException exceptionWithName:@"PNInterfaceNotAvailable"
+                                   reason:@"+new or -init methods unavailable."
+                                 userInfo:errorInformation];
+}
+
+
+#pragma mark - Misc
+
+- (NSDictionary *)dictionaryRepresentation {
+    NSMutableDictionary *request = [@{
+        @"maximumConcurrentRequests": @(self.maximumConcurrentRequests),
+        @"includeMetadata": @(self.includeMetadata),
+        @"windowsCount": @(self.windowsCount),
+        @"channels": self.channels ?: @[],
+    } mutableCopy];
+
+    if (self.progressToken) request[@"progressToken"] = self.progressToken;
+    if (self.start) request[@"start"] = self.start;
+    if (self.end) request[@"end"] = self.end;
+
+    return request;
+}
+
+#pragma mark -
+
+
+@end
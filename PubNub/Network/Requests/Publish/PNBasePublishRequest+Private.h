@@ -12,10 +12,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Properties
 
-/// Message which has been prepared for publish.
+/// Percent-escaped message which has been prepared for publish with `GET` request.
 ///
 /// Depending from request configuration this object may store encrypted message with mobile push payloads.
-@property(strong, nullable, nonatomic, readonly) NSString *preparedMessage;
+@property(strong, nullable, nonatomic, readonly) NSString *preparedMessagePathSegment;
+
+/// UTF-8 data of message which has been prepared for publish.
+@property(strong, nullable, nonatomic, readonly) NSData *preparedMessageData;
 
 /// Crypto module for data processing.
 ///
@@ -48,30 +51,6 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithChannel:(NSString *)channel;
 
 
-#pragma mark - Helpers
-
-/// Merge user-specified message with push payloads into single message which will be processed on the **PubNub**
-/// service.
-///
-/// In case if aside from `message` has been passed `payloads` this method will merge them into format known by the
-/// **PubNub** service and will cause further push distribution to specified vendors.
-///
-/// - Parameters:
-///   - message: Message which should be merged with `payloads`.
-///   - payloads: `NSDictionary` with payloads for different push notification services (Apple with `'apns'` key and
-///   Google with `'gcm'`).
-/// - Returns: Merged message or original message if there is no data in `payloads`.
-- (NSDictionary<NSString *, id> *)mergedMessage:(nullable id)message
-                          withMobilePushPayload:(nullable NSDictionary<NSString *, id> *)payloads;
-
-/// Try perform encryption of data which should be pushed to **PubNub** services.
-///
-/// - Parameters:
-///   - message: Data which crypto module should try to encrypt.
-///   - error: Pointer into which data encryption error will be passed.
-/// - Returns: Encrypted Base64-encoded string or original message.
-- (nullable NSString *)encryptedMessage:(NSString *)message error:(NSError **)error;
-
 #pragma mark -
 
 
@@ -1,4 +1,5 @@
 #import "PNBasePublishRequest+Private.h"
+#import "PNPublishMessageEncoder.h"
 #import "PNBaseRequest+Private.h"
 #import "PNFunctions.h"
 #import "PNHelpers.h"
@@ -31,10 +32,13 @@ NS_ASSUME_NONNULL_BEGIN
 /// Dictionary with payloads for different vendors (Apple with `'apns'` key and Google with `'gcm'`).
 @property(strong, nullable, nonatomic) NSDictionary *payloads;
 
-/// Message which has been prepared for publish.
+/// UTF-8 data of message which has been prepared for publish.
 ///
 /// Depending from request configuration this object may store encrypted message with mobile push payloads.
-@property(strong, nullable, nonatomic) NSString *preparedMessage;
+@property(strong, nullable, nonatomic) NSData *preparedMessageData;
+
+/// Percent-escaped prepared message which is used as `GET` request path segment.
+@property(strong, nullable, nonatomic) NSString *preparedMessagePathSegment;
 
 /// Publish request sequence number.
 @property(assign, nonatomic) NSUInteger sequenceNumber;
@@ -92,10 +96,18 @@ NS_ASSUME_NONNULL_END
 }
 
 - (NSData *)body {
-    if (self.httpMethod == TransportPOSTMethod) return [self.preparedMessage dataUsingEncoding:NSUTF8StringEncoding];
+    if (self.httpMethod == TransportPOSTMethod) return self.preparedMessageData;
     return nil;
 }
 
+- (NSString *)preparedMessagePathSegment {
+    if (!_preparedMessagePathSegment && self.preparedMessageData) {
+        _preparedMessagePathSegment = [PNString percentEscapedStringFromUTF8Data:self.preparedMessageData];
+    }
+
+    return _preparedMessagePathSegment;
+}
+
 
 - (id)preFormattedMessage {
     return self.message;
@@ -126,14 +138,10 @@ NS_ASSUME_NONNULL_END
 - (PNError *)validate {
     if (self.channel.length == 0) return [self missingParameterError:@"channel" forObjectRequest:@"Request"];
     
-    NSString *preFormattedMessage = self.preFormattedMessage;
-    NSString *messageForPublish = @"";
+    PNPublishMessageEncoder *encoder = [PNPublishMessageEncoder encoderWithMessage:self.preFormattedMessage];
     NSError *error = nil;
 
-    messageForPublish = [PNJSON JSONStringFrom:preFormattedMessage withError:&error];
-    BOOL isMessageEncrypted = NO;
-
-    if (error) {
+    if (![encoder serializeWithError:&error]) {
         NSDictionary *userInfo = PNErrorUserInfo(
             @"Request parameters error",
             @"Message serialization did fail",
@@ -144,43 +152,32 @@ NS_ASSUME_NONNULL_END
         return [PNError errorWithDomain:PNAPIErrorDomain code:PNAPIErrorUnacceptableParameters userInfo:userInfo];
     }
     
-    if (self.cryptoModule) {
-        NSString *encryptedMessage = [self encryptedMessage:messageForPublish error:&error];
-        
-        if (!error) {
-            messageForPublish = [encryptedMessage copy];
-            isMessageEncrypted = YES;
-        } else if (error) {
-            NSDictionary *userInfo = PNErrorUserInfo(
-                @"Request parameters error",
-                @"Message encryption did fail.",
-                nil,
-                error
-            );
+    if (self.cryptoModule && ![encoder encryptWithCryptoModule:self.cryptoModule error:&error]) {
+        NSDictionary *userInfo = PNErrorUserInfo(
+            @"Request parameters error",
+            @"Message encryption did fail.",
+            nil,
+            error
+        );
 
-            return [PNError errorWithDomain:PNAPIErrorDomain code:PNAPIErrorUnacceptableParameters userInfo:userInfo];
-        }
+        return [PNError errorWithDomain:PNAPIErrorDomain code:PNAPIErrorUnacceptableParameters userInfo:userInfo];
     }
     
-    if (self.payloads.count) {
-        id targetMessage = isMessageEncrypted ? messageForPublish : preFormattedMessage;
-        NSDictionary *mergedData = [self mergedMessage:targetMessage withMobilePushPayload:self.payloads];
-        messageForPublish = [PNJSON JSONStringFrom:mergedData withError:&error];
+    if (self.payloads.count && ![encoder mergeMobilePushPayloads:self.payloads error:&error]) {
+        NSDictionary *userInfo = PNErrorUserInfo(
+            @"Request parameters error",
+            @"Message merge with push notification payload did fail",
+            @"Ensure that only JSON-compatible values used in message.",
+            error
+        );
         
-        if (error) {
-            NSDictionary *userInfo = PNErrorUserInfo(
-                @"Request parameters error",
-                @"Message merge with push notification payload did fail",
-                @"Ensure that only JSON-compatible values used in message.",
-                error
-            );
-            
-            return [PNError errorWithDomain:PNAPIErrorDomain code:PNAPIErrorUnacceptableParameters userInfo:userInfo];
-        }
+        return [PNError errorWithDomain:PNAPIErrorDomain code:PNAPIErrorUnacceptableParameters userInfo:userInfo];
     }
     
-    if (messageForPublish.length == 0) return [self missingParameterError:@"message" forObjectRequest:@"Request"];
-    else self.preparedMessage = messageForPublish;
+    if (encoder.data.length == 0) return [self missingParameterError:@"message" forObjectRequest:@"Request"];
+
+    self.preparedMessageData = encoder.data;
+    self.preparedMessagePathSegment = nil;
 
     if (self.metadata) {
         NSString *metadataForPublish = [PNJSON JSONStringFrom:self.metadata withError:&error];
@@ -201,51 +198,6 @@ NS_ASSUME_NONNULL_END
 }
 
 
-#pragma mark - Misc
-
-- (NSDictionary<NSString *, id> *)mergedMessage:(id)message
-                          withMobilePushPayload:(NSDictionary<NSString *, id> *)payloads {
-    NSDictionary *originalMessage = message ?: @{};
-    if (message && ![message isKindOfClass:[NSDictionary class]]) originalMessage = @{ @"pn_other": message };
-
-    NSMutableDictionary *mergedMessage = [originalMessage mutableCopy];
-
-    for (NSString *pushProviderType in payloads) {
-        NSString *providerKey = pushProviderType;
-        id payload = payloads[pushProviderType];
-
-        if (![pushProviderType hasPrefix:@"pn_"]) {
-            providerKey = [NSString stringWithFormat:@"pn_%@", pushProviderType];
-
-            if ([pushProviderType isEqualToString:@"aps"]) {
-                payload = @{pushProviderType:payload};
-                providerKey = @"pn_apns";
-            }
-        }
-
-        [mergedMessage setValue:payload forKey:providerKey];
-    }
-    
-    return [mergedMessage copy];
-}
-
-- (NSString *)encryptedMessage:(NSString *)message error:(NSError **)error {
-    NSString *encryptedMessage = message;
-    NSData *JSONData = [message dataUsingEncoding:NSUTF8StringEncoding];
-    PNResult<NSData *> *encryptionResult = [self.cryptoModule encryptData:JSONData];
-
-    if (encryptionResult.isError) {
-        *error = encryptionResult.error;
-        encryptedMessage = nil;
-    } else {
-        NSString *base64 = [encryptionResult.data base64EncodedStringWithOptions:(NSDataBase64EncodingOptions)0];
-        encryptedMessage = [PNJSON JSONStringFrom:base64 withError:error];
-    }
-    
-    return encryptedMessage;
-}
-
-
 #pragma mark - Misc
 
 - (NSDictionary *)dictionaryRepresentation {
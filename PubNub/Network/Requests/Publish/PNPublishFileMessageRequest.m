@@ -87,7 +87,7 @@ NS_ASSUME_NONNULL_END
                           self.publishKey,
                           self.subscribeKey,
                           [PNString percentEscapedString:self.channel],
-                          self.httpMethod == TransportPOSTMethod ? @"" : [PNString percentEscapedString:self.preparedMessage]);
+                          self.httpMethod == TransportPOSTMethod ? @"" : self.preparedMessagePathSegment);
 }
 
 
@@ -0,0 +1,69 @@
+#import <Foundation/Foundation.h>
+#import "PNCryptoProvider.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Publish message encoder.
+///
+/// Encoder writes serialized message, its Base64-encoded ciphertext and mobile push payloads into single growable
+/// buffer. Mobile push payload keys appended to the already serialized message without message re-serialization.
+///
+/// Encoding done in stages, which should be called in order: `serialize` → `encrypt` (optional) → `merge`
+/// (optional).
+///
+/// > Note: Encoder produce same payload as it was built with `PNJSON` serialization of the message, encryption and
+/// merge with mobile push payloads.
+@interface PNPublishMessageEncoder : NSObject
+
+
+#pragma mark - Properties
+
+/// Encoded message UTF-8 data.
+///
+/// Data can be used as request body or as source for URL path segment.
+@property(strong, nonatomic, readonly) NSData *data;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create and configure publish message encoder.
+///
+/// - Parameter message: Message which should be encoded.
+/// - Returns: Configured and ready to use publish message encoder.
++ (instancetype)encoderWithMessage:(nullable id)message;
+
+
+#pragma mark - Encoding
+
+/// Serialize message into the buffer.
+///
+/// - Parameter error: Pointer into which message serialization error will be passed.
+/// - Returns: Whether message has been serialized or not.
+- (BOOL)serializeWithError:(NSError **)error;
+
+/// Replace serialized message with its Base64-encoded ciphertext.
+///
+/// - Parameters:
+///   - cryptoModule: Crypto module which should be used for message encryption.
+///   - error: Pointer into which message encryption error will be passed.
+/// - Returns: Whether message has been encrypted or not.
+- (BOOL)encryptWithCryptoModule:(id<PNCryptoProvider>)cryptoModule error:(NSError **)error;
+
+/// Append mobile push payloads to the serialized message.
+///
+/// - Parameters:
+///   - payloads: `NSDictionary` with payloads for different push notification services (Apple with `'apns'` key and
+///   Google with `'gcm'`).
+///   - error: Pointer into which payloads serialization error will be passed.
+/// - Returns: Whether payloads have been added to the message or not.
+- (BOOL)mergeMobilePushPayloads:(NSDictionary<NSString *, id> *)payloads error:(NSError **)error;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,339 @@
+#import "PNPublishMessageEncoder.h"
+#import "PNHelpers.h"
+
+
+#pragma mark Constants
+
+/// Base64 encoding alphabet.
+static const char kPNPublishBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Prefix which is used for non-dictionary messages merged with mobile push payloads.
+static const char kPNPublishOtherMessagePrefix[] = "{\"pn_other\":";
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+/// Publish message encoder private extension.
+@interface PNPublishMessageEncoder ()
+
+
+#pragma mark - Properties
+
+/// Buffer into which encoded message is written.
+@property(strong, nonatomic) NSMutableData *buffer;
+
+/// Whether buffer contains Base64-encoded message ciphertext or not.
+@property(assign, nonatomic, getter = isEncrypted) BOOL encrypted;
+
+/// Message which should be encoded.
+@property(strong, nullable, nonatomic) id message;
+
+
+#pragma mark - Initialization and Configuration
+
+/// Initialize publish message encoder.
+///
+/// - Parameter message: Message which should be encoded.
+/// - Returns: Initialized publish message encoder.
+- (instancetype)initWithMessage:(nullable id)message;
+
+
+#pragma mark - Helpers
+
+/// Append UTF-8 representation of the string to the buffer.
+///
+/// - Parameter string: String which should be written.
+- (void)appendString:(NSString *)string;
+
+/// Append Base64 representation of the data to the buffer.
+///
+/// - Parameter data: Data which should be encoded.
+- (void)appendBase64EncodedData:(NSData *)data;
+
+/// Append mobile push payloads as key / value pairs of JSON object.
+///
+/// - Parameters:
+///   - entries: List of serialized `"key":value` pairs.
+///   - separated: Whether first entry should be separated from previous buffer content or not.
+- (void)appendPayloadEntries:(NSArray<NSData *> *)entries separated:(BOOL)separated;
+
+/// Serialize mobile push payloads as key / value pairs.
+///
+/// - Parameters:
+///   - payloads: `NSDictionary` with payloads for different push notification services.
+///   - hasCollision: Pointer into which will be stored whether provider key collides with message or another
+///   provider key.
+///   - error: Pointer into which payloads serialization error will be passed.
+/// - Returns: Serialized `"key":value` pairs or `nil` in case of error.
+- (nullable NSArray<NSData *> *)payloadEntriesFrom:(NSDictionary<NSString *, id> *)payloads
+                                      hasCollision:(BOOL *)hasCollision
+                                             error:(NSError **)error;
+
+/// Key under which mobile push payload should be stored in message.
+///
+/// - Parameters:
+///   - pushProviderType: Push notification service type from `payloads` dictionary.
+///   - payload: Pointer to the payload which will be wrapped if required by provider.
+/// - Returns: Provider key which is known to the **PubNub** service.
+- (NSString *)providerKeyForType:(NSString *)pushProviderType payload:(id _Nonnull * _Nonnull)payload;
+
+/// Merge message with push payloads with dictionary and serialize it into the buffer.
+///
+/// Used when provider key collides with a key in message and new value should override it.
+///
+/// - Parameters:
+///   - payloads: `NSDictionary` with payloads for different push notification services.
+///   - error: Pointer into which merged message serialization error will be passed.
+/// - Returns: Whether merged message has been serialized or not.
+- (BOOL)serializeMergedMessageWithPayloads:(NSDictionary<NSString *, id> *)payloads error:(NSError **)error;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNPublishMessageEncoder
+
+
+#pragma mark - Properties
+
+- (NSData *)data {
+    return self.buffer;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)encoderWithMessage:(id)message {
+    return [[self alloc] initWithMessage:message];
+}
+
+- (instancetype)initWithMessage:(id)message {
+    if ((self = [super init])) {
+        _buffer = [NSMutableData new];
+        _message = message;
+    }
+
+    return self;
+}
+
+
+#pragma mark - Encoding
+
+- (BOOL)serializeWithError:(NSError **)error {
+    id message = self.message;
+    self.buffer.length = 0;
+
+    if (!message) return YES;
+
+    if ([message respondsToSelector:@selector(count)]) {
+        NSData *data = [NSJSONSerialization dataWithJSONObject:message options:(NSJSONWritingOptions)0 error:error];
+        if (!data) return NO;
+
+        [self.buffer appendData:data];
+    } else if ([PNJSON isJSONString:message]) {
+        [self appendString:[message description]];
+    } else {
+        [self.buffer appendBytes:"\"" length:1];
+        [self appendString:[message description]];
+        [self.buffer appendBytes:"\"" length:1];
+    }
+
+    return YES;
+}
+
+- (BOOL)encryptWithCryptoModule:(id<PNCryptoProvider>)cryptoModule error:(NSError **)error {
+    PNResult<NSData *> *encryptionResult = [cryptoModule encryptData:self.buffer];
+
+    if (encryptionResult.isError) {
+        *error = encryptionResult.error;
+        return NO;
+    }
+
+    // Serialized message is not required anymore and buffer can be reused for ciphertext encoding.
+    self.buffer.length = 0;
+    [self.buffer appendBytes:"\"" length:1];
+    [self appendBase64EncodedData:encryptionResult.data];
+    [self.buffer appendBytes:"\"" length:1];
+    self.encrypted = YES;
+
+    return YES;
+}
+
+- (BOOL)mergeMobilePushPayloads:(NSDictionary<NSString *, id> *)payloads error:(NSError **)error {
+    BOOL isDictionary = !self.isEncrypted && [self.message isKindOfClass:[NSDictionary class]];
+    BOOL hasCollision = NO;
+    NSArray<NSData *> *entries = [self payloadEntriesFrom:payloads hasCollision:&hasCollision error:error];
+
+    if (!entries) return NO;
+    if (hasCollision) return [self serializeMergedMessageWithPayloads:payloads error:error];
+
+    NSMutableData *buffer = self.buffer;
+    NSUInteger prefixLength = sizeof(kPNPublishOtherMessagePrefix) - 1;
+
+    if (!self.message && !self.isEncrypted) {
+        [buffer appendBytes:"{" length:1];
+        [self appendPayloadEntries:entries separated:NO];
+    } else if (isDictionary) {
+        // Drop closing brace to continue message object with payload keys.
+        buffer.length -= 1;
+        [self appendPayloadEntries:entries separated:((NSDictionary *)self.message).count > 0];
+    } else if (self.isEncrypted) {
+        // Base64 alphabet doesn't have characters which should be escaped except wrapping quotes.
+        [buffer replaceBytesInRange:NSMakeRange(buffer.length - 1, 0) withBytes:"\\" length:1];
+        [buffer replaceBytesInRange:NSMakeRange(0, 0) withBytes:kPNPublishOtherMessagePrefix length:prefixLength];
+        [buffer replaceBytesInRange:NSMakeRange(prefixLength, 0) withBytes:"\"\\" length:2];
+        [buffer appendBytes:"\"" length:1];
+        [self appendPayloadEntries:entries separated:YES];
+    } else if ([self.message isKindOfClass:[NSArray class]]) {
+        [buffer replaceBytesInRange:NSMakeRange(0, 0) withBytes:kPNPublishOtherMessagePrefix length:prefixLength];
+        [self appendPayloadEntries:entries separated:YES];
+    } else {
+        // Scalar messages serialized by `PNJSON` verbatim, so they should be serialized as JSON fragment.
+        NSData *data = [NSJSONSerialization dataWithJSONObject:self.message
+                                                       options:NSJSONWritingFragmentsAllowed
+                                                         error:error];
+        if (!data) return NO;
+
+        buffer.length = 0;
+        [buffer appendBytes:kPNPublishOtherMessagePrefix length:prefixLength];
+        [buffer appendData:data];
+        [self appendPayloadEntries:entries separated:YES];
+    }
+
+    [buffer appendBytes:"}" length:1];
+
+    return YES;
+}
+
+
+#pragma mark - Helpers
+
+- (void)appendString:(NSString *)string {
+    NSUInteger maximumLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    NSUInteger offset = self.buffer.length;
+    NSUInteger usedLength = 0;
+
+    self.buffer.length = offset + maximumLength;
+    [string getBytes:(uint8_t *)self.buffer.mutableBytes + offset
+           maxLength:maximumLength
+          usedLength:&usedLength
+            encoding:NSUTF8StringEncoding
+             options:(NSStringEncodingConversionOptions)0
+               range:NSMakeRange(0, string.length)
+      remainingRange:NULL];
+    self.buffer.length = offset + usedLength;
+}
+
+- (void)appendBase64EncodedData:(NSData *)data {
+    NSUInteger offset = self.buffer.length;
+    NSUInteger length = data.length;
+    const uint8_t *bytes = data.bytes;
+
+    self.buffer.length = offset + ((length + 2) / 3) * 4;
+    char *encoded = (char *)self.buffer.mutableBytes + offset;
+    NSUInteger idx = 0;
+
+    for (; idx + 2 < length; idx += 3) {
+        uint32_t triplet = (uint32_t)bytes[idx] << 16 | (uint32_t)bytes[idx + 1] << 8 | bytes[idx + 2];
+        *encoded++ = kPNPublishBase64Alphabet[(triplet >> 18) & 0x3F];
+        *encoded++ = kPNPublishBase64Alphabet[(triplet >> 12) & 0x3F];
+        *encoded++ = kPNPublishBase64Alphabet[(triplet >> 6) & 0x3F];
+        *encoded++ = kPNPublishBase64Alphabet[triplet & 0x3F];
+    }
+
+    if (idx < length) {
+        uint32_t triplet = (uint32_t)bytes[idx] << 16 | (idx + 1 < length ? (uint32_t)bytes[idx + 1] << 8 : 0);
+        *encoded++ = kPNPublishBase64Alphabet[(triplet >> 18) & 0x3F];
+        *encoded++ = kPNPublishBase64Alphabet[(triplet >> 12) & 0x3F];
+        *encoded++ = idx + 1 < length ? kPNPublishBase64Alphabet[(triplet >> 6) & 0x3F] : '=';
+        *encoded = '=';
+    }
+}
+
+- (void)appendPayloadEntries:(NSArray<NSData *> *)entries separated:(BOOL)separated {
+    for (NSData *entry in entries) {
+        if (separated) [self.buffer appendBytes:"," length:1];
+
+        [self.buffer appendData:entry];
+        separated = YES;
+    }
+}
+
+- (NSArray<NSData *> *)payloadEntriesFrom:(NSDictionary<NSString *, id> *)payloads
+                             hasCollision:(BOOL *)hasCollision
+                                    error:(NSError **)error {
+    BOOL isDictionary = !self.isEncrypted && [self.message isKindOfClass:[NSDictionary class]];
+    BOOL isWrapped = self.isEncrypted || (self.message && !isDictionary);
+    NSDictionary *message = isDictionary ? self.message : nil;
+    NSMutableArray<NSData *> *entries = [NSMutableArray arrayWithCapacity:payloads.count];
+    NSMutableSet<NSString *> *providerKeys = [NSMutableSet setWithCapacity:payloads.count];
+
+    for (NSString *pushProviderType in payloads) {
+        id payload = payloads[pushProviderType];
+        NSString *providerKey = [self providerKeyForType:pushProviderType payload:&payload];
+
+        if (message[providerKey] || [providerKeys containsObject:providerKey]) *hasCollision = YES;
+        else if (isWrapped && [providerKey isEqualToString:@"pn_other"]) *hasCollision = YES;
+        [providerKeys addObject:providerKey];
+
+        // Serialized single entry object is used to get properly escaped key along with payload.
+        NSData *entry = [NSJSONSerialization dataWithJSONObject:@{ providerKey: payload }
+                                                        options:(NSJSONWritingOptions)0
+                                                          error:error];
+        if (!entry) return nil;
+
+        [entries addObject:[entry subdataWithRange:NSMakeRange(1, entry.length - 2)]];
+    }
+
+    return entries;
+}
+
+- (NSString *)providerKeyForType:(NSString *)pushProviderType payload:(id *)payload {
+    if ([pushProviderType hasPrefix:@"pn_"]) return pushProviderType;
+
+    if ([pushProviderType isEqualToString:@"aps"]) {
+        *payload = @{ pushProviderType: *payload };
+        return @"pn_apns";
+    }
+
+    return [NSString stringWithFormat:@"pn_%@", pushProviderType];
+}
+
+- (BOOL)serializeMergedMessageWithPayloads:(NSDictionary<NSString *, id> *)payloads error:(NSError **)error {
+    NSMutableDictionary *mergedMessage = [NSMutableDictionary new];
+
+    if (self.isEncrypted) {
+        NSString *encryptedMessage = [[NSString alloc] initWithData:self.buffer encoding:NSUTF8StringEncoding];
+        mergedMessage[@"pn_other"] = encryptedMessage;
+    } else if ([self.message isKindOfClass:[NSDictionary class]]) {
+        [mergedMessage addEntriesFromDictionary:self.message];
+    } else if (self.message) {
+        mergedMessage[@"pn_other"] = self.message;
+    }
+
+    for (NSString *pushProviderType in payloads) {
+        id payload = payloads[pushProviderType];
+        NSString *providerKey = [self providerKeyForType:pushProviderType payload:&payload];
+        [mergedMessage setValue:payload forKey:providerKey];
+    }
+
+    NSData *data = [NSJSONSerialization dataWithJSONObject:mergedMessage options:(NSJSONWritingOptions)0 error:error];
+    if (!data) return NO;
+
+    [self.buffer setData:data];
+
+    return YES;
+}
+
+#pragma mark -
+
+
+@end
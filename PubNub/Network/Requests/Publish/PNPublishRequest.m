@@ -25,7 +25,7 @@
                           self.publishKey,
                           self.subscribeKey,
                           [PNString percentEscapedString:self.channel],
-                          self.httpMethod == TransportPOSTMethod ? @"" : [PNString percentEscapedString:self.preparedMessage]);
+                          self.httpMethod == TransportPOSTMethod ? @"" : self.preparedMessagePathSegment);
 }
 
 
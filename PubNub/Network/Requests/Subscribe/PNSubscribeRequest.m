@@ -1,5 +1,6 @@
 #import "PNSubscribeRequest+Private.h"
 #import "PNBaseRequest+Private.h"
+#import "PNPrivateStructures.h"
 #import "PNTransportRequest.h"
 #import "PNFunctions.h"
 #import "PNHelpers.h"
@@ -66,6 +67,7 @@ NS_ASSUME_NONNULL_END
     PNTransportRequest *request = super.request;
     request.timeout = self.subscribeMaximumIdleTime;
     request.cancellable = YES;
+    request.tag = PNOperationTypeStrings[PNSubscribeOperation];
 
     return request;
 }
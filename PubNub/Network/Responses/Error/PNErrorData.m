@@ -106,6 +106,7 @@ NS_ASSUME_NONNULL_END
     } else if (error.code == PNAPIErrorRequestURITooLong) self.category = PNRequestURITooLongCategory;
     else if(error.code == PNAPIErrorMalformedServiceResponse) self.category = PNMalformedResponseCategory;
     else if(error.code == PNAPIErrorMalformedFilterExpression) self.category = PNMalformedFilterExpressionCategory;
+    else if(error.code == PNAPIErrorPublishQueueFull) self.category = PNPublishQueueFullCategory;
     else if(error.code == PNCryptorErrorInsufficientMemory || error.code == PNCryptorErrorDecryption) {
         self.category = PNDecryptionErrorCategory;
     }
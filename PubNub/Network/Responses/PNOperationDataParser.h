@@ -44,6 +44,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property(assign, nonatomic) BOOL errorOnly;
 
 
+#pragma mark - Metrics
+
+/// Number of responses for which status data has been decoded because result data decoding failed.
+@property(class, assign, nonatomic, readonly) NSUInteger statusDataFallbacksCount;
+
+/// Number of responses for which error data has been decoded because status data decoding failed.
+@property(class, assign, nonatomic, readonly) NSUInteger errorDataFallbacksCount;
+
+/// Number of responses which can't be decoded as any of expected data classes.
+@property(class, assign, nonatomic, readonly) NSUInteger malformedResponsesCount;
+
+/// Number of decoding attempts which used already parsed response body instead of parsing it again.
+@property(class, assign, nonatomic, readonly) NSUInteger reusedResponseBodiesCount;
+
+
 #pragma mark - Initialization and Configuration
 
 /// Create operation data parser.
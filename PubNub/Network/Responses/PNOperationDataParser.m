@@ -6,11 +6,27 @@
 #import "PNErrorStatus.h"
 #import "PNFunctions.h"
 #import "PNXMLParser.h"
+#import <stdatomic.h>
+
+
+#pragma mark Static
+
+/// Number of responses for which status data has been decoded because result data decoding failed.
+static _Atomic(NSUInteger) _statusDataFallbacksCount = 0;
+
+/// Number of responses for which error data has been decoded because status data decoding failed.
+static _Atomic(NSUInteger) _errorDataFallbacksCount = 0;
+
+/// Number of responses which can't be decoded as any of expected data classes.
+static _Atomic(NSUInteger) _malformedResponsesCount = 0;
+
+/// Number of decoding attempts which used already parsed response body instead of parsing it again.
+static _Atomic(NSUInteger) _reusedResponseBodiesCount = 0;
 
 
 NS_ASSUME_NONNULL_BEGIN
 
-#pragma mark Private interface declaration
+#pragma mark - Private interface declaration
 
 @interface PNOperationDataParseResult<ResultType, StatusType> ()
 
@@ -79,6 +95,23 @@ NS_ASSUME_NONNULL_BEGIN
                 withAdditionalData:(nullable NSDictionary *)additionalData;
 
 
+#pragma mark - Processing
+
+/// De-serialize service response body and populate it to instance of specified class.
+///
+/// - Parameters:
+///   - aClass: Expected class of de-serialized object.
+///   - data: Response data provided by service.
+///   - object: Pointer to the JSON object parsed from `data` by one of previous calls. If it points to `nil`, `data`
+///   will be parsed and resulting object stored by pointer for next calls.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: De-serialized object, or `nil` in case of decoding failure.
+- (nullable id)objectOfClass:(Class)aClass
+                    fromData:(nullable NSData *)data
+                  jsonObject:(id _Nullable * _Nonnull)object
+                       error:(PNError * _Nullable * _Nonnull)error;
+
+
 #pragma mark - Helpers
 
 /// Create unexpected content type error data object.
@@ -150,7 +183,24 @@ NS_ASSUME_NONNULL_END
 @implementation PNOperationDataParser
 
 
-#pragma mark - Properties 
+#pragma mark - Metrics
+
++ (NSUInteger)statusDataFallbacksCount {
+    return atomic_load_explicit(&_statusDataFallbacksCount, memory_order_relaxed);
+}
+
++ (NSUInteger)errorDataFallbacksCount {
+    return atomic_load_explicit(&_errorDataFallbacksCount, memory_order_relaxed);
+}
+
++ (NSUInteger)malformedResponsesCount {
+    return atomic_load_explicit(&_malformedResponsesCount, memory_order_relaxed);
+}
+
++ (NSUInteger)reusedResponseBodiesCount {
+    return atomic_load_explicit(&_reusedResponseBodiesCount, memory_order_relaxed);
+}
+
 
 #pragma mark - Initialization and Configuration
 
@@ -192,6 +242,7 @@ NS_ASSUME_NONNULL_END
     BOOL isJSON = [self isJSONResponse:response];
     BOOL isXML = !isJSON && [self isXMLResponse:response];
     BOOL malformedResponse = NO;
+    id jsonObject;
     id resultData;
     id statusData;
     id result;
@@ -200,32 +251,37 @@ NS_ASSUME_NONNULL_END
     if (error) statusData = [PNErrorData dataWithError:error];
     else if (!isJSON && !isXML && !ignoreBody) statusData = [self errorDataWithUnexpectedServiceResponseError:error];
     else if (isJSON && response.statusCode >= 400) {
-        statusData = [self.serializer objectOfClass:[PNErrorData class]
-                                           fromData:data
-                                     withAdditional:additional
-                                              error:&error];
+        statusData = [self objectOfClass:[PNErrorData class] fromData:data jsonObject:&jsonObject error:&error];
     } else if (isJSON) {
         error = nil;
 
+        // Response body parsed once and shared between result, status and error data decoding attempts.
         if (expectingResult) {
             Class dataClass = [self.resultClass responseDataClass];
-            resultData = [self.serializer objectOfClass:dataClass fromData:data withAdditional:additional error:&error];
+            resultData = [self objectOfClass:dataClass fromData:data jsonObject:&jsonObject error:&error];
         }
 
         if (error || (!expectingResult && !resultData)) {
+            if (expectingResult) atomic_fetch_add_explicit(&_statusDataFallbacksCount, 1, memory_order_relaxed);
+
             Class dataClass = [self.statusClass statusDataClass];
-            statusData = [self.serializer objectOfClass:dataClass fromData:data withAdditional:additional error:&error];
+            statusData = [self objectOfClass:dataClass fromData:data jsonObject:&jsonObject error:&error];
             if (error) malformedResponse = YES;
         }
 
         // Fallback for case when only status expected but it can't be deserialized to the provided data class object.
         if (error && !expectingResult) {
+            atomic_fetch_add_explicit(&_errorDataFallbacksCount, 1, memory_order_relaxed);
+
             Class dataClass = [PNErrorData class];
-            statusData = [self.serializer objectOfClass:dataClass fromData:data withAdditional:additional error:&error];
+            statusData = [self objectOfClass:dataClass fromData:data jsonObject:&jsonObject error:&error];
             if (malformedResponse) ((PNErrorData *)statusData).category = PNMalformedResponseCategory;
         }
 
-        if (!resultData && !statusData) statusData = [self errorDataWithMalformedServiceResponseError:error];
+        if (!resultData && !statusData) {
+            atomic_fetch_add_explicit(&_malformedResponsesCount, 1, memory_order_relaxed);
+            statusData = [self errorDataWithMalformedServiceResponseError:error];
+        }
     } else if (response.statusCode >= 400 && isXML) {
         statusData = [self errorDataWithXMLResponse:data error:error];
     } else if (!ignoreBody) statusData = [self errorDataWithMalformedServiceResponseError:error];
@@ -244,6 +300,23 @@ NS_ASSUME_NONNULL_END
     return [[PNOperationDataParseResult alloc] initWithResult:result status:status];
 }
 
+- (id)objectOfClass:(Class)aClass fromData:(NSData *)data jsonObject:(id *)object error:(PNError **)error {
+    SEL sharedObjectSelector = @selector(objectOfClass:fromData:jsonObject:withAdditional:error:);
+
+    // Custom serializers may not support decoding with shared JSON object.
+    if (![self.serializer respondsToSelector:sharedObjectSelector]) {
+        return [self.serializer objectOfClass:aClass fromData:data withAdditional:self.additionalData error:error];
+    }
+
+    if (*object) atomic_fetch_add_explicit(&_reusedResponseBodiesCount, 1, memory_order_relaxed);
+
+    return [self.serializer objectOfClass:aClass
+                                 fromData:data
+                               jsonObject:object
+                           withAdditional:self.additionalData
+                                    error:error];
+}
+
 
 #pragma mark - Helpers
 
@@ -0,0 +1,27 @@
+#import "PNSubscribeCursorData.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// Subscribe request time cursor response private extension.
+@interface PNSubscribeCursorData (Private)
+
+
+#pragma mark - Initialization and Configuration
+
+/// Create subscription cursor.
+///
+/// - Parameters:
+///   - timetoken: High-precision **PubNub** time token of published data.
+///   - region: Data center region for which `timetoken` has been generated.
+/// - Returns: Ready to use subscription cursor.
++ (instancetype)cursorWithTimetoken:(NSNumber *)timetoken region:(nullable NSNumber *)region;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -1,4 +1,4 @@
-#import "PNSubscribeCursorData.h"
+#import "PNSubscribeCursorData+Private.h"
 #import "PNCodable.h"
 
 
@@ -10,6 +10,16 @@ NS_ASSUME_NONNULL_BEGIN
 @interface PNSubscribeCursorData () <PNCodable>
 
 
+#pragma mark - Initialization and Configuration
+
+/// Initialize subscription cursor.
+///
+/// - Parameters:
+///   - timetoken: High-precision **PubNub** time token of published data.
+///   - region: Data center region for which `timetoken` has been generated.
+/// - Returns: Initialized subscription cursor.
+- (instancetype)initWithTimetoken:(NSNumber *)timetoken region:(nullable NSNumber *)region;
+
 #pragma mark -
 
 
@@ -36,6 +46,22 @@ NS_ASSUME_NONNULL_END
     return @[@"region"];
 }
 
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)cursorWithTimetoken:(NSNumber *)timetoken region:(NSNumber *)region {
+    return [[self alloc] initWithTimetoken:timetoken region:region];
+}
+
+- (instancetype)initWithTimetoken:(NSNumber *)timetoken region:(NSNumber *)region {
+    if ((self = [super init])) {
+        _timetoken = timetoken;
+        _region = region;
+    }
+
+    return self;
+}
+
 #pragma mark -
 
 
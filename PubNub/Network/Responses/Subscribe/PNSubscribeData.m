@@ -5,8 +5,12 @@
 #import "PNSubscribeObjectEventData.h"
 #import "PNSubscribeSignalEventData.h"
 #import "PNSubscribeFileEventData.h"
+#import "PNSubscribeEnvelopeParser.h"
+#import "PNJSONDecoder+Private.h"
+#import "PNJSONSerialization.h"
 #import "PNCryptoProvider.h"
-#import "PNJSONDecoder.h"
+#import "PNCryptoModule+Private.h"
+#import "PNJSONScanner.h"
 #import "PNCodable.h"
 #import "PNSubscribeMessageEventData+Private.h"
 #import "PNSubscribeFileEventData+Private.h"
@@ -17,12 +21,23 @@
 #import "PNHelpers.h"
 
 
+#pragma mark Static
+
+/// Minimum number of real-time updates for which events will be created concurrently when crypto module is set.
+///
+/// Smaller batches processed inline, because dispatch overhead is comparable with decryption time.
+static NSUInteger const kPNSubscribeDataConcurrentDecryptionThreshold = 16;
+
+/// Maximum number of concurrent workers which can be used to create events from real-time updates.
+static NSUInteger const kPNSubscribeDataMaximumDecryptionWorkers = 8;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Interface declaration
 
 /// Subscribe request response private extension.
-@interface PNSubscribeData () <PNCodable>
+@interface PNSubscribeData () <PNCodable, PNJSONDataDecodable>
 
 
 #pragma mark - Properties
@@ -49,6 +64,67 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Helpers
 
+/// Queue on which real-time updates decryption is done concurrently.
+///
+/// - Returns: Shared concurrent decryption queue.
++ (dispatch_queue_t)decryptionQueue;
+
+/// Create event data objects from real-time updates.
+///
+/// Encrypted updates processed concurrently with a bounded number of workers when there is enough of them, otherwise
+/// processed inline on the calling thread. Order of events is the same as order of `updates`.
+///
+/// > Note: Concurrent processing used only with ``PNCryptoModule`` which has only built-in (stateless) cryptors. Custom
+/// crypto providers and modules with custom cryptors always used from the calling thread.
+///
+/// - Parameters:
+///   - updates: Real-time updates from subscribe response (`NSDictionary` or already created event objects).
+///   - fingerprints: Buffer with `uint32_t` payload fingerprint for each update or `NULL` to compute them from
+///   parsed updates (used only when there is no raw response data).
+///   - cryptoModule: Crypto module which should be used to decrypt payloads.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: List of event data objects or `nil` in case of decoding error.
++ (nullable NSArray<PNSubscribeEventData *> *)eventsFromUpdates:(NSArray *)updates
+                                                   fingerprints:(nullable const uint32_t *)fingerprints
+                                                   cryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
+                                                          error:(NSError **)error;
+
+/// Create real-time update event data object from parsed update.
+///
+/// - Parameters:
+///   - update: `NSDictionary` with real-time update information or event object created by envelope parser.
+///   - fingerprint: Real-time update payload fingerprint.
+///   - cryptoModule: Crypto module which should be used to decrypt payload.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: Event data object or `nil` in case of decoding error.
++ (nullable PNSubscribeEventData *)eventFromParsedUpdate:(id)update
+                                             fingerprint:(uint32_t)fingerprint
+                                            cryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
+                                                   error:(NSError **)error;
+
+/// Create real-time update event data object.
+///
+/// - Parameters:
+///   - update: Real-time update information from subscribe response.
+///   - fingerprint: Real-time update payload fingerprint.
+///   - cryptoModule: Crypto module which should be used to decrypt payload.
+///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
+/// - Returns: Event data object or `nil` in case of decoding error.
++ (nullable PNSubscribeEventData *)eventFromUpdate:(NSDictionary *)update
+                                       fingerprint:(uint32_t)fingerprint
+                                      cryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
+                                             error:(NSError **)error;
+
+/// Compute real-time updates payload fingerprints from raw subscribe response data.
+///
+/// Fingerprints computed directly from bytes of `d` fields, so payloads won't be serialized to JSON once more.
+///
+/// - Parameters:
+///   - data: Raw subscribe response JSON data.
+///   - count: Number of real-time updates in de-serialized subscribe response.
+/// - Returns: Buffer with `uint32_t` fingerprint for each real-time update or `nil` if data can't be scanned.
++ (nullable NSData *)payloadFingerprintsFromData:(nullable NSData *)data count:(NSUInteger)count;
+
 /// Decrypt payload.
 ///
 /// - Parameters:
@@ -56,7 +132,7 @@ NS_ASSUME_NONNULL_BEGIN
 ///   - cryptoModule: cryptor which should be used to decrypt data.
 ///   - error: If an error occurs, upon return contains an `NSError` object that describes the problem.
 /// - Returns: Decrypted payload or original `data` if `cryptoModule` not set.
-- (id)decryptedMessageFromData:(id)data
++ (id)decryptedMessageFromData:(id)data
               withCryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
                          error:(NSError **)error;
 
@@ -84,6 +160,25 @@ NS_ASSUME_NONNULL_END
     return self;
 }
 
++ (instancetype)decodedObjectFromJSONData:(NSData *)data
+                           withSerializer:(id<PNJSONSerializer>)serializer
+                           additionalData:(NSDictionary *)additionalData
+                                    error:(NSError **)error {
+    // Envelope parser uses `NSJSONSerialization`, so custom serializer should handle response in general decoder.
+    if (serializer && ![serializer isKindOfClass:[PNJSONSerialization class]]) return nil;
+
+    PNSubscribeEnvelopeParser *parser = [PNSubscribeEnvelopeParser parserWithData:data];
+    id<PNCryptoProvider> cryptoModule = additionalData[@"cryptoModule"];
+    if (![parser parse]) return nil;
+
+    NSArray<PNSubscribeEventData *> *updates = [self eventsFromUpdates:parser.updates
+                                                          fingerprints:parser.fingerprints.bytes
+                                                          cryptoModule:cryptoModule
+                                                                 error:error];
+
+    return updates ? [[self alloc] initWithUpdates:updates cursor:parser.cursor] : nil;
+}
+
 - (instancetype)initObjectWithCoder:(id<PNDecoder>)coder {
     id<PNCryptoProvider> cryptoModule = coder.additionalData[@"cryptoModule"];
     NSDictionary *payload = [coder decodeObjectOfClass:[NSDictionary class]];
@@ -96,101 +191,249 @@ NS_ASSUME_NONNULL_END
     if (error) return nil;
     
     NSArray<NSDictionary *> *receivedUpdates = payload[@"m"];
-    NSMutableArray<PNSubscribeEventData *> *updates = [NSMutableArray arrayWithCapacity:receivedUpdates.count];
-
-    [receivedUpdates enumerateObjectsUsingBlock:^(NSDictionary *update, __unused NSUInteger idx, __unused BOOL *stop) {
-        PNMessageType messageType = ((NSNumber *)update[@"e"]).unsignedIntegerValue;
-        NSString *fingerprint = PNMessageFingerprint(update[@"d"]);
-        NSMutableDictionary *patchedUpdate = [update mutableCopy];
-        NSString *channel = update[@"c"];
-        id updatePayload = update[@"d"];
-        PNSubscribeEventData *data;
-        NSError *decryptionError;
-        Class dataClass;
-
-        [patchedUpdate removeObjectForKey:@"d"];
-        if (messageType == PNRegularMessageType && [PNChannel isPresenceObject:channel]) {
-            NSMutableDictionary *presenceData = [updatePayload mutableCopy];
-            dataClass = [PNSubscribePresenceEventData class];
-            messageType = PNPresenceMessageType;
-
-            if (presenceData[@"data"]) presenceData[@"state"] = presenceData[@"data"];
-
-            // Rearrange for deserialization model.
-            [patchedUpdate addEntriesFromDictionary:@{
-                @"action": updatePayload[@"action"],
-                @"presence": presenceData
-            }];
-        } else if (!update[@"e"] || messageType == PNRegularMessageType || messageType == PNSignalMessageType) {
-            if (!update[@"e"]) messageType = PNRegularMessageType;
-            dataClass = messageType == PNRegularMessageType ? [PNSubscribeMessageEventData class]
-                                                            : [PNSubscribeSignalEventData class];
-
-            if (messageType == PNRegularMessageType) {
-                updatePayload = [self decryptedMessageFromData:updatePayload
-                                              withCryptoModule:cryptoModule
-                                                         error:&decryptionError];
-            }
+    NSData *rawData = [coder isKindOfClass:[PNJSONDecoder class]] ? ((PNJSONDecoder *)coder).decodableData : nil;
+    NSData *fingerprints = [[self class] payloadFingerprintsFromData:rawData count:receivedUpdates.count];
+    NSArray<PNSubscribeEventData *> *updates = [[self class] eventsFromUpdates:receivedUpdates
+                                                                  fingerprints:fingerprints.bytes
+                                                                  cryptoModule:cryptoModule
+                                                                         error:&error];
+
+    return updates ? [self initWithUpdates:updates cursor:cursor] : nil;
+}
+
+
+#pragma mark - Helpers
+
++ (dispatch_queue_t)decryptionQueue {
+    static dispatch_queue_t _decryptionQueue;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_CONCURRENT,
+                                                                                   QOS_CLASS_USER_INITIATED,
+                                                                                   0);
+        _decryptionQueue = dispatch_queue_create("com.pubnub.subscribe.decryption", attributes);
+    });
+
+    return _decryptionQueue;
+}
 
-            // Rearrange for deserialization model.
-            [patchedUpdate addEntriesFromDictionary:@{ @"message": updatePayload }];
-        } else if (messageType == PNObjectMessageType) {
-            NSMutableDictionary *membershipData = [updatePayload mutableCopy];
-            dataClass = [PNSubscribeObjectEventData class];
-
-            // Rearrange for deserialization model.
-            if (membershipData[@"data"][@"uuid"]) {
-                NSMutableDictionary *data = [membershipData[@"data"] mutableCopy];
-                data[@"_uuid"] = data[@"uuid"];
-                [data removeObjectForKey:@"uuid"];
-                membershipData[@"data"] = data;
++ (NSArray<PNSubscribeEventData *> *)eventsFromUpdates:(NSArray *)updates
+                                          fingerprints:(const uint32_t *)fingerprints
+                                          cryptoModule:(id<PNCryptoProvider>)cryptoModule
+                                                 error:(NSError **)error {
+    NSUInteger count = updates.count;
+    if (count == 0) return @[];
+
+    __strong PNSubscribeEventData **events = (__strong PNSubscribeEventData **)calloc(count, sizeof(id));
+    __strong NSError **errors = (__strong NSError **)calloc(count, sizeof(id));
+    void(^processRange)(NSUInteger, NSUInteger) = ^(NSUInteger startIdx, NSUInteger endIdx) {
+        for (NSUInteger idx = startIdx; idx < endIdx; idx++) {
+            @autoreleasepool {
+                id update = updates[idx];
+                uint32_t fingerprint = fingerprints ? fingerprints[idx] : PNMessageFingerprintValue(update[@"d"]);
+                NSError *eventError;
+
+                events[idx] = [self eventFromParsedUpdate:update
+                                              fingerprint:fingerprint
+                                             cryptoModule:cryptoModule
+                                                    error:&eventError];
+                errors[idx] = eventError;
             }
+        }
+    };
+
+    BOOL concurrent = [cryptoModule isKindOfClass:[PNCryptoModule class]];
+    concurrent = concurrent && [(PNCryptoModule *)cryptoModule isConcurrentProcessingSafe];
+    concurrent = concurrent && count >= kPNSubscribeDataConcurrentDecryptionThreshold;
+
+    if (concurrent) {
+        NSUInteger workers = MIN(NSProcessInfo.processInfo.activeProcessorCount,
+                                 kPNSubscribeDataMaximumDecryptionWorkers);
+        // Each worker should get at least half of threshold updates to process.
+        workers = MIN(workers, count * 2 / kPNSubscribeDataConcurrentDecryptionThreshold);
+        NSUInteger stride = (count + workers - 1) / workers;
+
+        dispatch_apply(workers, [self decryptionQueue], ^(size_t worker) {
+            processRange(MIN(worker * stride, count), MIN((worker + 1) * stride, count));
+        });
+    } else {
+        processRange(0, count);
+    }
+
+    NSMutableArray<PNSubscribeEventData *> *result = [NSMutableArray arrayWithCapacity:count];
+    NSError *eventsError = nil;
+
+    for (NSUInteger idx = 0; idx < count; idx++) {
+        if (!eventsError && errors[idx]) eventsError = errors[idx];
+        else if (!eventsError && events[idx]) [result addObject:events[idx]];
+
+        events[idx] = nil;
+        errors[idx] = nil;
+    }
+
+    free(events);
+    free(errors);
+
+    if (eventsError && error) *error = eventsError;
+
+    return !eventsError ? result : nil;
+}
+
++ (PNSubscribeEventData *)eventFromParsedUpdate:(id)update
+                                    fingerprint:(uint32_t)fingerprint
+                                   cryptoModule:(id<PNCryptoProvider>)cryptoModule
+                                          error:(NSError **)error {
+    if ([update isKindOfClass:[NSDictionary class]]) {
+        return [self eventFromUpdate:update fingerprint:fingerprint cryptoModule:cryptoModule error:error];
+    }
+
+    PNSubscribeEventData *event = update;
+    event.pnFingerprintValue = fingerprint;
+
+    if (cryptoModule && event.messageType.unsignedIntegerValue == PNRegularMessageType) {
+        PNSubscribeMessageEventData *messageEvent = update;
+        NSError *decryptionError;
 
-            // Rearrange for deserialization model.
-            [patchedUpdate addEntriesFromDictionary:membershipData];
-        } else if (messageType == PNMessageActionType) {
-            dataClass = [PNSubscribeMessageActionEventData class];
+        messageEvent.message = [self decryptedMessageFromData:messageEvent.message
+                                             withCryptoModule:cryptoModule
+                                                        error:&decryptionError];
+        if (decryptionError) messageEvent.decryptionError = decryptionError;
+    }
 
-            // Rearrange for deserialization model.
-            NSMutableDictionary *actionEventData = [updatePayload mutableCopy];
-            NSMutableDictionary *actionData = [actionEventData[@"data"] mutableCopy];
-            actionData[@"uuid"] = update[@"i"];
-            actionEventData[@"data"] = actionData;
+    return event;
+}
 
-            [patchedUpdate addEntriesFromDictionary:actionEventData];
-        } else if (messageType == PNFileMessageType) {
-            dataClass = [PNSubscribeFileEventData class];
++ (PNSubscribeEventData *)eventFromUpdate:(NSDictionary *)update
+                              fingerprint:(uint32_t)fingerprint
+                             cryptoModule:(id<PNCryptoProvider>)cryptoModule
+                                    error:(NSError **)error {
+    PNMessageType messageType = ((NSNumber *)update[@"e"]).unsignedIntegerValue;
+    NSMutableDictionary *patchedUpdate = [update mutableCopy];
+    NSString *channel = update[@"c"];
+    id updatePayload = update[@"d"];
+    PNSubscribeEventData *data;
+    NSError *decryptionError;
+    Class dataClass;
+
+    [patchedUpdate removeObjectForKey:@"d"];
+    if (messageType == PNRegularMessageType && [PNChannel isPresenceObject:channel]) {
+        NSMutableDictionary *presenceData = [updatePayload mutableCopy];
+        dataClass = [PNSubscribePresenceEventData class];
+        messageType = PNPresenceMessageType;
+
+        if (presenceData[@"data"]) presenceData[@"state"] = presenceData[@"data"];
+
+        // Rearrange for deserialization model.
+        [patchedUpdate addEntriesFromDictionary:@{
+            @"action": updatePayload[@"action"],
+            @"presence": presenceData
+        }];
+    } else if (!update[@"e"] || messageType == PNRegularMessageType || messageType == PNSignalMessageType) {
+        if (!update[@"e"]) messageType = PNRegularMessageType;
+        dataClass = messageType == PNRegularMessageType ? [PNSubscribeMessageEventData class]
+                                                        : [PNSubscribeSignalEventData class];
+
+        if (messageType == PNRegularMessageType) {
             updatePayload = [self decryptedMessageFromData:updatePayload
                                           withCryptoModule:cryptoModule
                                                      error:&decryptionError];
+        }
 
-            // Rearrange for deserialization model.
-            [patchedUpdate addEntriesFromDictionary:updatePayload];
+        // Rearrange for deserialization model.
+        [patchedUpdate addEntriesFromDictionary:@{ @"message": updatePayload }];
+    } else if (messageType == PNObjectMessageType) {
+        NSMutableDictionary *membershipData = [updatePayload mutableCopy];
+        dataClass = [PNSubscribeObjectEventData class];
+
+        // Rearrange for deserialization model.
+        if (membershipData[@"data"][@"uuid"]) {
+            NSMutableDictionary *data = [membershipData[@"data"] mutableCopy];
+            data[@"_uuid"] = data[@"uuid"];
+            [data removeObjectForKey:@"uuid"];
+            membershipData[@"data"] = data;
         }
 
-        data = [PNJSONDecoder decodedObjectOfClass:dataClass fromDictionary:patchedUpdate withError:&error];
-        if (fingerprint) data.pnFingerprint = fingerprint;
+        // Rearrange for deserialization model.
+        [patchedUpdate addEntriesFromDictionary:membershipData];
+    } else if (messageType == PNMessageActionType) {
+        dataClass = [PNSubscribeMessageActionEventData class];
+
+        // Rearrange for deserialization model.
+        NSMutableDictionary *actionEventData = [updatePayload mutableCopy];
+        NSMutableDictionary *actionData = [actionEventData[@"data"] mutableCopy];
+        actionData[@"uuid"] = update[@"i"];
+        actionEventData[@"data"] = actionData;
+
+        [patchedUpdate addEntriesFromDictionary:actionEventData];
+    } else if (messageType == PNFileMessageType) {
+        dataClass = [PNSubscribeFileEventData class];
+        updatePayload = [self decryptedMessageFromData:updatePayload
+                                      withCryptoModule:cryptoModule
+                                                 error:&decryptionError];
+
+        // Rearrange for deserialization model.
+        [patchedUpdate addEntriesFromDictionary:updatePayload];
+    }
 
-        if (data && !error) {
-            data.messageType = @(messageType);
-            
-            if (decryptionError) {
-                if (messageType == PNFileMessageType) ((PNSubscribeFileEventData *)data).decryptionError = decryptionError;
-                else ((PNSubscribeMessageEventData *)data).decryptionError = decryptionError;
-            }
+    data = [PNJSONDecoder decodedObjectOfClass:dataClass fromDictionary:patchedUpdate withError:error];
+    data.pnFingerprintValue = fingerprint;
+
+    if (data && !*error) {
+        data.messageType = @(messageType);
 
-            [updates addObject:data];
+        if (decryptionError) {
+            if (messageType == PNFileMessageType) ((PNSubscribeFileEventData *)data).decryptionError = decryptionError;
+            else ((PNSubscribeMessageEventData *)data).decryptionError = decryptionError;
         }
-        else if (error) *stop = YES;
-    }];
+    }
 
-    return !error ? [self initWithUpdates:updates cursor:cursor] : nil;
+    return data;
 }
 
++ (NSData *)payloadFingerprintsFromData:(NSData *)data count:(NSUInteger)count {
+    if (data.length == 0 || count == 0) return nil;
 
-#pragma mark - Helpers
+    NSMutableData *fingerprints = [NSMutableData dataWithLength:sizeof(uint32_t) * count];
+    uint32_t *fingerprintValues = fingerprints.mutableBytes;
+    PNJSONScanner scanner = PNJSONScannerMake(data);
+    NSUInteger updateIdx = 0;
+    NSRange range;
+
+    if (!PNJSONScannerBeginObject(&scanner)) return nil;
+
+    while (PNJSONScannerNextMember(&scanner, &range)) {
+        if (!PNJSONScannerKeyIsEqual(&scanner, range, "m")) {
+            if (!PNJSONScannerSkipValue(&scanner, NULL)) return nil;
+            continue;
+        }
+
+        if (!PNJSONScannerBeginArray(&scanner)) return nil;
+
+        while (PNJSONScannerNextElement(&scanner)) {
+            if (updateIdx >= count || !PNJSONScannerBeginObject(&scanner)) return nil;
+            fingerprintValues[updateIdx] = PNMessageFingerprintFromBytes(NULL, 0);
+
+            while (PNJSONScannerNextMember(&scanner, &range)) {
+                BOOL isPayload = PNJSONScannerKeyIsEqual(&scanner, range, "d");
+                if (!PNJSONScannerSkipValue(&scanner, &range)) return nil;
+
+                if (isPayload) {
+                    fingerprintValues[updateIdx] = PNMessageFingerprintFromBytes(scanner.bytes + range.location,
+                                                                                 range.length);
+                }
+            }
+
+            updateIdx++;
+        }
+
+        break;
+    }
+
+    return updateIdx == count ? fingerprints : nil;
+}
 
-- (id)decryptedMessageFromData:(id)data withCryptoModule:(id<PNCryptoProvider>)cryptoModule error:(NSError **)error {
++ (id)decryptedMessageFromData:(id)data withCryptoModule:(id<PNCryptoProvider>)cryptoModule error:(NSError **)error {
     if (!cryptoModule) return data;
 
     BOOL isDictionary = [data isKindOfClass:[NSDictionary class]];
@@ -12,31 +12,43 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Properties
 
+/// User provided message type (set only when `publish` called with `meta`).
+@property (nonatomic, nullable, strong) NSDictionary *userMetadata;
+
+/// Actual name of subscription through which event has been delivered.
+@property(strong, nonatomic) NSString *subscription;
+
+/// Name of channel where update received.
+@property(strong, nonatomic) NSString *channel;
+
 /// User-defined (local) `publish` time.
-@property(strong, nullable, nonatomic, readonly) PNSubscribeCursorData *userTimetoken;
+@property(strong, nullable, nonatomic) PNSubscribeCursorData *userTimetoken;
 
 /// Event `publish` time.
 ///
 /// This is the time when message has been received by **PubNub** network.
-@property(strong, nonatomic, readonly) PNSubscribeCursorData *publishTimetoken;
+@property(strong, nonatomic) PNSubscribeCursorData *publishTimetoken;
 
 /// Identifier of client which sent message (set only for publish).
-@property(strong, nullable, nonatomic, readonly) NSString *senderIdentifier;
+@property(strong, nullable, nonatomic) NSString *senderIdentifier;
 
 /// Sequence number of published messages (clients keep track of their own value locally).
-@property(strong, nullable, nonatomic, readonly) NSNumber *sequenceNumber;
+@property(strong, nullable, nonatomic) NSNumber *sequenceNumber;
 
 /// Shard number on which the event has been stored.
-@property(strong, nonatomic, readonly) NSString *shardIdentifier;
+@property(strong, nonatomic) NSString *shardIdentifier;
 
 /// Unique payload message finerprint.
-@property(strong, nullable, nonatomic) NSString *pnFingerprint;
+@property(strong, nullable, nonatomic, readonly) NSString *pnFingerprint;
+
+/// Numeric representation of unique payload message fingerprint.
+@property(assign, nonatomic) uint32_t pnFingerprintValue;
 
 /// PubNub defined event type.
 @property(strong, nullable, nonatomic) NSNumber *messageType;
 
 /// A numeric representation of enabled debug flags.
-@property(strong, nonatomic, readonly) NSNumber *debugFlags;
+@property(strong, nonatomic) NSNumber *debugFlags;
 
 /// Stores reference on **PubNub** server region identifier (which generated `timetoken` value).
 @property (nonatomic, readonly) NSNumber *region;
@@ -10,19 +10,6 @@ NS_ASSUME_NONNULL_BEGIN
 /// General real-time subscription update private extension.
 @interface PNSubscribeEventData () <PNCodable>
 
-
-#pragma mark - Properties
-
-/// Actual name of subscription through which event has been delivered.
-///
-/// Actual name of subscription through which event has been delivered.PubNub client can be used to subscribe to the
-/// group of channels to receive updates and (group name will be set for field). With this approach there will be no
-/// need to separately add *N* number of channels to `subscribe` method call.
-@property(strong, nonatomic) NSString *subscription;
-
-/// Name of channel where update received.
-@property(strong, nonatomic) NSString *channel;
-
 #pragma mark -
 
 
@@ -65,7 +52,7 @@ NS_ASSUME_NONNULL_END
 }
 
 + (NSArray<NSString *> *)ignoredKeys {
-    return @[@"timetoken", @"region", @"pnFingerprint"];
+    return @[@"timetoken", @"region", @"pnFingerprint", @"pnFingerprintValue"];
 }
 
 - (NSString *)subscription {
@@ -84,6 +71,10 @@ NS_ASSUME_NONNULL_END
     return self.publishTimetoken.region;
 }
 
+- (NSString *)pnFingerprint {
+    return [NSString stringWithFormat:@"%08x", self.pnFingerprintValue];
+}
+
 
 #pragma mark - Misc
 
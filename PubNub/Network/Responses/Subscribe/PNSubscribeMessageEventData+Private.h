@@ -11,9 +11,27 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Properties
 
+/// User-specified message type.
+@property(strong, nullable, nonatomic) NSString *customMessageType;
+
+/// Message which has been delivered through data object live feed.
+@property(strong, nullable, nonatomic) id message;
+
 /// Decryption error happened during data processing or not.
 @property(strong, nonatomic) NSError *decryptionError;
 
+
+#pragma mark - Lazy message
+
+/// Set raw message payload which will be de-serialized on first ``message`` access.
+///
+/// > Note: `data` retained until ``message`` accessed or replaced.
+///
+/// - Parameters:
+///   - data: Data which contains raw JSON message payload (usually whole subscribe response).
+///   - range: Range of raw message payload bytes in `data`.
+- (void)setMessageData:(NSData *)data range:(NSRange)range;
+
 #pragma mark -
 
 
@@ -1,5 +1,6 @@
 #import "PNSubscribeMessageEventData+Private.h"
 #import "PNSubscribeEventData+Private.h"
+#import <os/lock.h>
 #import "PNCodable.h"
 
 
@@ -8,11 +9,31 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma mark Private interface declaration
 
 /// `Message event` data private extension.
-@interface PNSubscribeMessageEventData () <PNCodable>
+@interface PNSubscribeMessageEventData () <PNCodable> {
+    /// Lock which protects lazy ``message`` de-serialization.
+    os_unfair_lock _messageLock;
+
+    /// Data which contains raw message payload.
+    ///
+    /// Data released after first ``message`` access.
+    NSData *_messageData;
+
+    /// Range of raw message payload bytes in ``_messageData``.
+    NSRange _messageRange;
+
+    /// Message which has been delivered through data object live feed.
+    id _message;
+}
 
 
 #pragma mark - Properties
 
+/// User-specified message type.
+@property(strong, nullable, nonatomic) NSString *customMessageType;
+
+/// Message which has been delivered through data object live feed.
+@property(strong, nullable, nonatomic) id message;
+
 /// Decryption error happened during data processing or not.
 @property(strong, nonatomic) NSError *decryptionError;
 
@@ -46,10 +67,51 @@ NS_ASSUME_NONNULL_END
     return @[@"publisher", @"decryptionError"];
 }
 
+- (id)message {
+    os_unfair_lock_lock(&_messageLock);
+    if (_messageData) {
+        const uint8_t *bytes = (const uint8_t *)_messageData.bytes + _messageRange.location;
+        NSData *data = [NSData dataWithBytesNoCopy:(void *)bytes length:_messageRange.length freeWhenDone:NO];
+        _message = [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:nil];
+        _messageData = nil;
+    }
+    id message = _message;
+    os_unfair_lock_unlock(&_messageLock);
+
+    return message;
+}
+
+- (void)setMessage:(id)message {
+    os_unfair_lock_lock(&_messageLock);
+    _messageData = nil;
+    _message = message;
+    os_unfair_lock_unlock(&_messageLock);
+}
+
 - (NSString *)publisher {
     return self.senderIdentifier;
 }
 
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+    if ((self = [super init])) _messageLock = OS_UNFAIR_LOCK_INIT;
+
+    return self;
+}
+
+
+#pragma mark - Lazy message
+
+- (void)setMessageData:(NSData *)data range:(NSRange)range {
+    os_unfair_lock_lock(&_messageLock);
+    _messageData = data;
+    _messageRange = range;
+    _message = nil;
+    os_unfair_lock_unlock(&_messageLock);
+}
+
 #pragma mark -
 
 
@@ -0,0 +1,56 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface implementation
+
+/// Pipelined input stream.
+///
+/// Stream reads ahead source stream on worker queue into a bounded ring of buffers, so expensive source stream
+/// processing (like data encryption) overlaps with the reader (like network transport) draining previously prepared
+/// buffers.
+///
+/// > Note: Stream holds at most `buffersCount` buffers in memory. Worker waits for the reader when all buffers are
+/// filled and reader waits for the worker when all buffers are drained.
+@interface PNPipelinedInputStream : NSInputStream
+
+
+#pragma mark - Information
+
+/// Number of bytes which has been passed to the reader.
+@property(assign, readonly) NSUInteger bytesRead;
+
+/// Time passed from the first `read` call till source stream end.
+@property(assign, readonly) NSTimeInterval duration;
+
+/// Time which reader spent waiting for the worker to prepare next buffer.
+///
+/// Large value means that source stream processing is slower than the reader.
+@property(assign, readonly) NSTimeInterval readerStallTime;
+
+/// Time which worker spent waiting for the reader to drain one of filled buffers.
+///
+/// Large value means that the reader is slower than source stream processing.
+@property(assign, readonly) NSTimeInterval workerStallTime;
+
+
+#pragma mark - Initialization and configuration
+
+/// Create a pipelined input stream.
+///
+/// - Parameters:
+///   - stream: Source input stream which should be read ahead.
+///   - bufferSize: Size of each buffer in the ring.
+///   - buffersCount: Number of buffers in the ring.
+/// - Returns: Initialized pipelined input stream.
++ (instancetype)inputStreamWithInputStream:(NSInputStream *)stream
+                                bufferSize:(NSUInteger)bufferSize
+                              buffersCount:(NSUInteger)buffersCount;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
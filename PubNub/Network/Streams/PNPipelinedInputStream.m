@@ -0,0 +1,357 @@
+#import "PNPipelinedInputStream.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+/// Pipelined input stream private extension.
+@interface PNPipelinedInputStream ()
+
+
+#pragma mark - Information
+
+/// Pipelined input stream processing error.
+@property (readwrite, nullable, copy) NSError *streamError;
+
+/// Pipelined input stream status.
+@property (nonatomic, assign) NSStreamStatus streamStatus;
+
+/// Source input stream which is read ahead by worker.
+@property(strong, nonatomic) NSInputStream *stream;
+
+/// Queue on which source input stream is read.
+@property(strong, nonatomic) dispatch_queue_t workerQueue;
+
+/// Semaphore which count buffers which can be filled by the worker.
+@property(strong, nonatomic) dispatch_semaphore_t freeBuffers;
+
+/// Semaphore which count buffers which can be drained by the reader.
+@property(strong, nonatomic) dispatch_semaphore_t filledBuffers;
+
+/// Ring of buffers which is used to pass data from the worker to the reader.
+@property(strong, nonatomic) NSArray<NSMutableData *> *buffers;
+
+/// Number of bytes stored in each of ring buffers.
+///
+/// Zero-length buffer is used by worker to mark end of source stream.
+@property(strong, nonatomic) NSMutableData *lengths;
+
+/// Source input stream read error.
+@property(strong, nullable) NSError *workerError;
+
+/// Number of bytes which has been passed to the reader.
+@property(assign) NSUInteger bytesRead;
+
+/// Time passed from the first `read` call till source stream end.
+@property(assign) NSTimeInterval duration;
+
+/// Time which reader spent waiting for the worker to prepare next buffer.
+@property(assign) NSTimeInterval readerStallTime;
+
+/// Time which worker spent waiting for the reader to drain one of filled buffers.
+@property(assign) NSTimeInterval workerStallTime;
+
+/// Time when reader requested data for the first time.
+@property(assign, nonatomic) CFAbsoluteTime startTime;
+
+/// Number of buffers which has been filled by the worker.
+///
+/// > Important: Property should be accessed only from `workerQueue`.
+@property(assign, nonatomic) NSUInteger filledBuffersCount;
+
+/// Number of buffers which has been drained by the reader.
+@property(assign, nonatomic) NSUInteger drainedBuffersCount;
+
+/// Offset in currently drained buffer.
+@property(assign, nonatomic) NSUInteger bufferOffset;
+
+/// Whether the reader has been given buffer which it drains or not.
+@property(assign, nonatomic) BOOL hasBuffer;
+
+/// Whether worker reached end of source stream or not.
+///
+/// > Important: Property should be accessed only from `workerQueue`.
+@property(assign, nonatomic) BOOL sourceEnded;
+
+/// Whether the reader received end of source stream marker or not.
+@property(assign, nonatomic) BOOL sourceDrained;
+
+/// Whether stream has been closed and worker should stop or not.
+@property(assign) BOOL cancelled;
+
+
+#pragma mark - Initialization and configuration
+
+/// Initialize a pipelined input stream.
+///
+/// - Parameters:
+///   - stream: Source input stream which should be read ahead.
+///   - bufferSize: Size of each buffer in the ring.
+///   - buffersCount: Number of buffers in the ring.
+/// - Returns: Initialized pipelined input stream.
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                         bufferSize:(NSUInteger)bufferSize
+                       buffersCount:(NSUInteger)buffersCount;
+
+
+#pragma mark - Worker
+
+/// Start source stream read ahead on `workerQueue`.
+- (void)startWorker;
+
+/// Fill next free buffer with data from source stream.
+///
+/// > Important: Method should be called on `workerQueue` after free buffer has been acquired.
+///
+/// - Returns: Whether worker should continue to fill buffers or not.
+- (BOOL)fillNextBuffer;
+
+
+#pragma mark - Helpers
+
+/// Update stream status and error if required.
+///
+/// - Parameter error: `NSError` instance with information about what exactly went wrong during stream processing.
+- (void)setStreamProcessingError:(nullable NSError *)error;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNPipelinedInputStream
+
+
+#pragma mark - Information
+
+@synthesize streamStatus, streamError, delegate;
+
+
+#pragma mark - Initialization and configuration
+
++ (instancetype)inputStreamWithInputStream:(NSInputStream *)stream
+                                bufferSize:(NSUInteger)bufferSize
+                              buffersCount:(NSUInteger)buffersCount {
+    return [[self alloc] initWithInputStream:stream bufferSize:bufferSize buffersCount:buffersCount];
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                         bufferSize:(NSUInteger)bufferSize
+                       buffersCount:(NSUInteger)buffersCount {
+    if ((self = [super init])) {
+        NSMutableArray<NSMutableData *> *buffers = [NSMutableArray new];
+        buffersCount = MAX(buffersCount, 2);
+
+        for (NSUInteger idx = 0; idx < buffersCount; idx++) {
+            [buffers addObject:[NSMutableData dataWithLength:MAX(bufferSize, 1)]];
+        }
+
+        _workerQueue = dispatch_queue_create("com.pubnub.pipelined-stream", DISPATCH_QUEUE_SERIAL);
+        _lengths = [NSMutableData dataWithLength:sizeof(NSUInteger) * buffersCount];
+        _freeBuffers = dispatch_semaphore_create((long)buffersCount);
+        _filledBuffers = dispatch_semaphore_create(0);
+        _buffers = [buffers copy];
+        _stream = stream;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    self.cancelled = YES;
+}
+
+
+#pragma mark - NSStream
+
+- (id)propertyForKey:(NSStreamPropertyKey)__unused key {
+    return nil;
+}
+
+- (BOOL)setProperty:(id)__unused property forKey:(NSStreamPropertyKey)__unused key {
+    return NO;
+}
+
+- (void)open {
+    if (self.streamStatus != NSStreamStatusNotOpen) return;
+
+    self.streamStatus = NSStreamStatusOpen;
+    [self startWorker];
+}
+
+- (void)close {
+    if (self.streamStatus != NSStreamStatusError && self.streamStatus != NSStreamStatusClosed) {
+        self.streamStatus = NSStreamStatusClosed;
+    }
+
+    if (!self.cancelled) {
+        self.cancelled = YES;
+        // Wake up worker if it waits for free buffer.
+        dispatch_semaphore_signal(self.freeBuffers);
+    }
+}
+
+- (void)scheduleInRunLoop:(NSRunLoop *)__unused aRunLoop forMode:(NSRunLoopMode)__unused mode {
+}
+
+- (void)removeFromRunLoop:(NSRunLoop *)__unused aRunLoop forMode:(NSRunLoopMode)__unused mode {
+}
+
+
+#pragma mark - NSInputStream
+
+- (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)length {
+    if (self.streamStatus == NSStreamStatusNotOpen) [self open];
+    if (self.streamStatus == NSStreamStatusClosed || self.streamStatus == NSStreamStatusError) {
+        return self.streamStatus == NSStreamStatusClosed ? 0 : -1;
+    }
+
+    if (self.startTime == 0.f) self.startTime = CFAbsoluteTimeGetCurrent();
+    const NSUInteger *lengths = self.lengths.bytes;
+    NSUInteger totalBytesRead = 0;
+
+    while (totalBytesRead < length && !self.sourceDrained) {
+        if (!self.hasBuffer) {
+            if (totalBytesRead > 0) {
+                // Return already read data instead of waiting for the worker.
+                if (dispatch_semaphore_wait(self.filledBuffers, DISPATCH_TIME_NOW) != 0) break;
+            } else {
+                CFAbsoluteTime waitStartTime = CFAbsoluteTimeGetCurrent();
+                dispatch_semaphore_wait(self.filledBuffers, DISPATCH_TIME_FOREVER);
+                self.readerStallTime += CFAbsoluteTimeGetCurrent() - waitStartTime;
+            }
+
+            self.bufferOffset = 0;
+            self.hasBuffer = YES;
+        }
+
+        NSUInteger bufferIdx = self.drainedBuffersCount % self.buffers.count;
+        NSUInteger bufferLength = lengths[bufferIdx];
+
+        if (bufferLength == 0) {
+            self.duration = CFAbsoluteTimeGetCurrent() - self.startTime;
+            self.sourceDrained = YES;
+            break;
+        }
+
+        NSUInteger bytesToCopy = MIN(length - totalBytesRead, bufferLength - self.bufferOffset);
+        const uint8_t *bufferBytes = self.buffers[bufferIdx].bytes;
+        memcpy(buffer + totalBytesRead, bufferBytes + self.bufferOffset, bytesToCopy);
+        self.bufferOffset += bytesToCopy;
+        totalBytesRead += bytesToCopy;
+
+        if (self.bufferOffset == bufferLength) {
+            self.drainedBuffersCount++;
+            self.hasBuffer = NO;
+            dispatch_semaphore_signal(self.freeBuffers);
+        }
+    }
+
+    self.bytesRead += totalBytesRead;
+
+    if (totalBytesRead == 0 && self.sourceDrained) {
+        if (self.workerError) {
+            [self setStreamProcessingError:self.workerError];
+            [self close];
+            return -1;
+        }
+
+        [self close];
+    }
+
+    return (NSInteger)totalBytesRead;
+}
+
+- (BOOL)getBuffer:(uint8_t * _Nullable *)__unused buffer length:(NSUInteger *)__unused length {
+    return NO;
+}
+
+- (BOOL)hasBytesAvailable {
+    return YES;
+}
+
+
+#pragma mark - Worker
+
+- (void)startWorker {
+    dispatch_semaphore_t freeBuffers = self.freeBuffers;
+    __weak __typeof(self) weakSelf = self;
+
+    dispatch_async(self.workerQueue, ^{
+        NSInputStream *stream = weakSelf.stream;
+        if (stream.streamStatus == NSStreamStatusNotOpen) [stream open];
+        BOOL proceed = stream != nil;
+
+        while (proceed) {
+            CFAbsoluteTime waitStartTime = CFAbsoluteTimeGetCurrent();
+
+            // Periodically check whether stream still exists, so worker won't wait forever for abandoned reader.
+            if (dispatch_semaphore_wait(freeBuffers, dispatch_time(DISPATCH_TIME_NOW, NSEC_PER_SEC)) != 0) {
+                proceed = weakSelf != nil && !weakSelf.cancelled;
+                continue;
+            }
+
+            __strong __typeof(weakSelf) strongSelf = weakSelf;
+            strongSelf.workerStallTime += CFAbsoluteTimeGetCurrent() - waitStartTime;
+            proceed = [strongSelf fillNextBuffer];
+        }
+
+        [stream close];
+    });
+}
+
+- (BOOL)fillNextBuffer {
+    if (self.cancelled) return NO;
+
+    NSUInteger bufferIdx = self.filledBuffersCount % self.buffers.count;
+    NSMutableData *buffer = self.buffers[bufferIdx];
+    uint8_t *bytes = buffer.mutableBytes;
+    NSUInteger capacity = buffer.length;
+    BOOL sourceEnded = self.sourceEnded;
+    NSUInteger bufferLength = 0;
+
+    while (!sourceEnded && bufferLength < capacity) {
+        // Source stream (like cryptor stream) may autorelease temporary objects on each read.
+        @autoreleasepool {
+            NSInteger bytesRead = [self.stream read:bytes + bufferLength maxLength:capacity - bufferLength];
+
+            if (bytesRead > 0) bufferLength += (NSUInteger)bytesRead;
+            else {
+                if (bytesRead < 0) {
+                    self.workerError = self.stream.streamError ?: [NSError errorWithDomain:NSPOSIXErrorDomain
+                                                                                      code:EIO
+                                                                                  userInfo:nil];
+                }
+                sourceEnded = YES;
+            }
+        }
+    }
+
+    ((NSUInteger *)self.lengths.mutableBytes)[bufferIdx] = bufferLength;
+    self.sourceEnded = sourceEnded;
+    self.filledBuffersCount++;
+    dispatch_semaphore_signal(self.filledBuffers);
+
+    // Zero-length buffer marks end of source stream, so there is nothing left to fill.
+    return bufferLength > 0;
+}
+
+
+#pragma mark - Helpers
+
+- (void)setStreamProcessingError:(NSError *)error {
+    if (!error) return;
+    self.streamError = error;
+    self.streamStatus = NSStreamStatusError;
+}
+
+#pragma mark -
+
+
+@end
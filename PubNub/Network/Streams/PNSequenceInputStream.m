@@ -144,14 +144,15 @@ NS_ASSUME_NONNULL_END
 
         bytesRead = [stream read:&buffer[totalBytesRead] maxLength:bytesToRead];
 
-        if (bytesRead == 0 || bytesRead < bytesToRead) {
-            [stream close];
-            self.currentStreamIdx++;
-        } else if (bytesRead < 0) {
+        if (bytesRead < 0) {
             [self setStreamProcessingError:stream.streamError];
             [stream close];
             [self close];
             return -1;
+        } else if (bytesRead == 0) {
+            // Short read doesn't mean that stream is exhausted (pipelined stream may return only prepared data).
+            [stream close];
+            self.currentStreamIdx++;
         }
 
         totalBytesRead += bytesRead;
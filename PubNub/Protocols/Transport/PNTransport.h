@@ -60,6 +60,17 @@ typedef void(^PNDownloadRequestCompletionBlock)(PNTransportRequest *request,
 /// any potential race of conditions if in `block` some of them are cancelled.
 - (void)requestsWithBlock:(void(^)(NSArray<PNTransportRequest *> *))block;
 
+@optional
+
+/// Cancel all active requests with specified tag.
+///
+/// Transport module should keep tagged requests indexed to cancel them without iteration over all active requests.
+///
+/// - Parameter tag: Tag of the group of requests which should be cancelled.
+- (void)cancelRequestsWithTag:(NSString *)tag;
+
+@required
+
 
 #pragma mark - Request processing
 
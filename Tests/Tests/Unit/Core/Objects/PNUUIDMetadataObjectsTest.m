@@ -418,6 +418,52 @@ NS_ASSUME_NONNULL_END
     }];
 }
 
+
+#pragma mark - Tests :: Stream all :: Call
+
+- (void)testItShouldNotChangeUserRequestWhenStreamAllUUIDMetadataCalled {
+    PNFetchAllUUIDMetadataRequest *userRequest = [PNFetchAllUUIDMetadataRequest new];
+    NSString *expectedFilterExpression = @"updated >= '2019-08-31T00:00:00Z'";
+    NSString *expectedStart = [NSUUID UUID].UUIDString;
+    NSString *expectedNext = [NSUUID UUID].UUIDString;
+    NSMutableArray<NSString *> *starts = [NSMutableArray new];
+    userRequest.filter = expectedFilterExpression;
+    userRequest.start = expectedStart;
+    userRequest.limit = 56;
+
+
+    id clientMock = [self mockForObject:self.client];
+    OCMStub([clientMock allUUIDMetadataWithRequest:[OCMArg any] completion:[OCMArg any]])
+        .andDo(^(NSInvocation *invocation) {
+            PNFetchAllUUIDMetadataRequest *request = [self objectForInvocation:invocation argumentAtIndex:1];
+            PNFetchAllUUIDMetadataCompletionBlock block = [self objectForInvocation:invocation argumentAtIndex:2];
+            id data = OCMClassMock([PNUUIDMetadataFetchAllData class]);
+            id result = OCMClassMock([PNFetchAllUUIDMetadataResult class]);
+            OCMStub([data next]).andReturn(starts.count == 0 ? expectedNext : nil);
+            OCMStub([data metadata]).andReturn(@[]);
+            OCMStub([(PNFetchAllUUIDMetadataResult *)result data]).andReturn(data);
+
+            XCTAssertNotEqual(request, userRequest);
+            XCTAssertEqualObjects(request.filter, expectedFilterExpression);
+            XCTAssertEqual(request.limit, 56);
+            [starts addObject:request.start];
+
+            block(result, nil);
+        });
+
+    [self waitToCompleteIn:self.testCompletionDelay codeBlock:^(dispatch_block_t handler) {
+        [self.client streamAllUUIDMetadataWithRequest:userRequest
+                                              batches:^(NSArray *objects, BOOL *stop) {}
+                                           completion:^(NSUInteger count, PNErrorStatus *status) {
+            XCTAssertNil(status);
+            handler();
+        }];
+    }];
+
+    XCTAssertEqualObjects(starts, (@[expectedStart, expectedNext]));
+    XCTAssertEqualObjects(userRequest.start, expectedStart);
+}
+
 #pragma mark -
 
 #pragma clang diagnostic pop
@@ -253,6 +253,20 @@ NS_ASSUME_NONNULL_END
                           @"Should inherit the last time token from source");
 }
 
+/// Test that `inheritStateFromSubscriber:` invalidates cached channels and groups lists.
+- (void)testInheritStateChangesObjectsVersion {
+    PNSubscriber *source = self.client.subscriberManager;
+    [source addChannels:@[@"test-channel"]];
+
+    PubNub *newClient = [PubNub clientWithConfiguration:self.client.configuration
+                                          callbackQueue:dispatch_get_main_queue()];
+    NSUInteger objectsVersion = newClient.subscriberManager.objectsVersion;
+    [newClient.subscriberManager inheritStateFromSubscriber:source];
+
+    XCTAssertNotEqual(newClient.subscriberManager.objectsVersion, objectsVersion,
+                      @"Inherited channels should invalidate cached channels list");
+}
+
 
 #pragma mark - Tests :: Unexpected disconnect after copyWithConfiguration during mid-subscribe
 
@@ -0,0 +1,208 @@
+#import <PubNub/PNCCCryptorWrapper.h>
+#import <CommonCrypto/CommonCryptor.h>
+#import <CommonCrypto/CommonDigest.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private wrapper methods exposure
+
+@interface PNCCCryptorWrapper (TestAccess)
+
+
+#pragma mark - Contexts pool
+
+/// Shared idle cryptor contexts pool.
++ (void)accessContextsPoolWithBlock:(void(^)(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                             NSCountedSet<NSData *> *usage))block;
+
+/// Create identifier of idle cryptor contexts pool.
++ (NSData *)contextPoolKeyForCipherKey:(NSData *)cipherKey operation:(CCOperation)operation;
+
+@end
+
+
+#pragma mark - Interface declaration
+
+/// `CCCryptor` wrapper unit tests.
+@interface PNCCCryptorWrapperTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Count idle cryptor contexts stored in the pool.
+///
+/// - Parameters:
+///   - key: Cipher key for which contexts have been created.
+///   - operation: Operation for which contexts have been configured: `kCCEncrypt` or `kCCDecrypt`.
+/// - Returns: Number of idle contexts for `key`.
+- (NSUInteger)pooledContextsCountForKey:(NSData *)key operation:(CCOperation)operation;
+
+/// Encrypt data with one-shot `CCCrypt` call.
+///
+/// - Parameters:
+///   - data: Data which should be encrypted.
+///   - key: Cipher key which should be used for encryption.
+///   - initializationVector: Initialization vector which should be used for encryption.
+/// - Returns: Encrypted data.
+- (NSData *)referenceEncryptedData:(NSData *)data withKey:(NSData *)key initializationVector:(NSData *)initializationVector;
+
+/// Create data filled with random bytes.
+///
+/// - Parameter length: Length of data which should be created.
+/// - Returns: Data with random bytes.
+- (NSData *)randomDataWithLength:(NSUInteger)length;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNCCCryptorWrapperTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Contexts reuse
+
+- (void)testItShouldEncryptWithNewInitializationVectorWhenContextReused {
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *data = [self randomDataWithLength:100];
+    [PNCCCryptorWrapper retainContextsForCipherKey:key];
+
+    for (NSUInteger attempt = 0; attempt < 10; attempt++) {
+        NSData *initializationVector = [self randomDataWithLength:kCCBlockSizeAES128];
+        PNCCCryptorWrapper *encryptor = [PNCCCryptorWrapper AESCBCEncryptorWithCipherKey:key
+                                                                   initializationVector:initializationVector].data;
+        NSData *encrypted = [encryptor processedDataFrom:data].data;
+
+        XCTAssertEqualObjects(encrypted, [self referenceEncryptedData:data
+                                                              withKey:key
+                                                 initializationVector:initializationVector]);
+    }
+
+    [PNCCCryptorWrapper releaseContextsForCipherKey:key];
+}
+
+- (void)testItShouldDecryptWhenContextReusedAfterFailedDecryption {
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *initializationVector = [self randomDataWithLength:kCCBlockSizeAES128];
+    NSData *data = [self randomDataWithLength:64];
+    NSData *encrypted = [self referenceEncryptedData:data withKey:key initializationVector:initializationVector];
+    [PNCCCryptorWrapper retainContextsForCipherKey:key];
+
+    PNCCCryptorWrapper *decryptor = [PNCCCryptorWrapper AESCBCDecryptorWithCipherKey:key
+                                                               initializationVector:initializationVector].data;
+    NSData *truncated = [encrypted subdataWithRange:NSMakeRange(0, encrypted.length - 3)];
+    XCTAssertNotEqualObjects([decryptor processedDataFrom:truncated].data, data);
+    decryptor = nil;
+
+    for (NSUInteger attempt = 0; attempt < 10; attempt++) {
+        decryptor = [PNCCCryptorWrapper AESCBCDecryptorWithCipherKey:key initializationVector:initializationVector].data;
+        XCTAssertEqualObjects([decryptor processedDataFrom:encrypted].data, data);
+    }
+
+    decryptor = nil;
+    [PNCCCryptorWrapper releaseContextsForCipherKey:key];
+}
+
+
+#pragma mark - Tests :: Contexts pool
+
+- (void)testItShouldNotStoreCipherKeyInContextsPoolKey {
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *encryptPoolKey = [PNCCCryptorWrapper contextPoolKeyForCipherKey:key operation:kCCEncrypt];
+    NSData *decryptPoolKey = [PNCCCryptorWrapper contextPoolKeyForCipherKey:key operation:kCCDecrypt];
+
+    XCTAssertEqual(encryptPoolKey.length, CC_SHA256_DIGEST_LENGTH + 1);
+    XCTAssertNotEqualObjects(encryptPoolKey, decryptPoolKey);
+    XCTAssertEqual([encryptPoolKey rangeOfData:key options:0 range:NSMakeRange(0, encryptPoolKey.length)].location,
+                   NSNotFound);
+}
+
+- (void)testItShouldPurgeContextsWhenLastCipherKeyUserReleased {
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *initializationVector = [self randomDataWithLength:kCCBlockSizeAES128];
+    NSData *data = [self randomDataWithLength:64];
+    [PNCCCryptorWrapper retainContextsForCipherKey:key];
+    [PNCCCryptorWrapper retainContextsForCipherKey:key];
+
+    @autoreleasepool {
+        PNCCCryptorWrapper *encryptor = [PNCCCryptorWrapper AESCBCEncryptorWithCipherKey:key
+                                                                   initializationVector:initializationVector].data;
+        XCTAssertNotNil([encryptor processedDataFrom:data].data);
+    }
+    XCTAssertEqual([self pooledContextsCountForKey:key operation:kCCEncrypt], 1);
+
+    [PNCCCryptorWrapper releaseContextsForCipherKey:key];
+    XCTAssertEqual([self pooledContextsCountForKey:key operation:kCCEncrypt], 1);
+
+    [PNCCCryptorWrapper releaseContextsForCipherKey:key];
+    XCTAssertEqual([self pooledContextsCountForKey:key operation:kCCEncrypt], 0);
+}
+
+- (void)testItShouldNotPoolContextsForReleasedCipherKey {
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *initializationVector = [self randomDataWithLength:kCCBlockSizeAES128];
+
+    @autoreleasepool {
+        PNCCCryptorWrapper *encryptor = [PNCCCryptorWrapper AESCBCEncryptorWithCipherKey:key
+                                                                   initializationVector:initializationVector].data;
+        XCTAssertNotNil([encryptor processedDataFrom:[self randomDataWithLength:64]].data);
+    }
+
+    XCTAssertEqual([self pooledContextsCountForKey:key operation:kCCEncrypt], 0);
+}
+
+
+#pragma mark - Helpers
+
+- (NSUInteger)pooledContextsCountForKey:(NSData *)key operation:(CCOperation)operation {
+    NSData *poolKey = [PNCCCryptorWrapper contextPoolKeyForCipherKey:key operation:operation];
+    __block NSUInteger count = 0;
+
+    [PNCCCryptorWrapper accessContextsPoolWithBlock:^(NSMutableDictionary<NSData *, NSMutableArray<NSValue *> *> *pool,
+                                                      NSCountedSet<NSData *> *usage) {
+        count = pool[poolKey].count;
+    }];
+
+    return count;
+}
+
+- (NSData *)referenceEncryptedData:(NSData *)data withKey:(NSData *)key initializationVector:(NSData *)initializationVector {
+    NSMutableData *encrypted = [NSMutableData dataWithLength:data.length + kCCBlockSizeAES128];
+    size_t encryptedLength = 0;
+
+    CCCryptorStatus status = CCCrypt(kCCEncrypt, kCCAlgorithmAES128, kCCOptionPKCS7Padding,
+                                     key.bytes, key.length, initializationVector.bytes,
+                                     data.bytes, data.length,
+                                     encrypted.mutableBytes, encrypted.length, &encryptedLength);
+    XCTAssertEqual(status, kCCSuccess);
+    encrypted.length = encryptedLength;
+
+    return encrypted;
+}
+
+- (NSData *)randomDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    XCTAssertEqual(SecRandomCopyBytes(kSecRandomDefault, length, data.mutableBytes), errSecSuccess);
+
+    return data;
+}
+
+#pragma mark -
+
+
+@end
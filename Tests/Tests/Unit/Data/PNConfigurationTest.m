@@ -2,6 +2,7 @@
  * @author Serhii Mamontov
  * @copyright © 2010-2022 PubNub, Inc.
  */
+#import <PubNub/PubNub+CorePrivate.h>
 #import "PNRecordableTestCase.h"
 #import <XCTest/XCTest.h>
 
@@ -67,6 +68,66 @@ NS_ASSUME_NONNULL_END
     XCTAssertThrows(configuration.userID = @"    ", @"Should throw when UUID changed to empty.");
 }
 
+
+#pragma mark - Tests :: Connection pool
+
+- (void)testItShouldCopyConnectionPoolConfiguration {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo" userID:@"uuid"];
+    configuration.maximumServiceConnections = 16;
+    PNConfiguration *copiedConfiguration = [configuration copy];
+
+    XCTAssertEqual(copiedConfiguration.maximumServiceConnections, 16);
+    XCTAssertFalse(copiedConfiguration.shouldMultiplexRequests);
+    XCTAssertFalse(copiedConfiguration.shouldShareConnectionPool);
+}
+
+- (void)testItShouldShareServiceTransportBetweenClientsWithSameOrigin {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo" userID:@"uuid"];
+    configuration.origin = @"127.0.0.1";
+    configuration.shareConnectionPool = YES;
+    PubNub *client1 = [PubNub clientWithConfiguration:configuration];
+    PubNub *client2 = [PubNub clientWithConfiguration:configuration];
+    configuration.origin = @"localhost";
+    PubNub *client3 = [PubNub clientWithConfiguration:configuration];
+
+    id transport1 = [(id)client1.serviceNetwork valueForKeyPath:@"configuration.transport"];
+    id transport2 = [(id)client2.serviceNetwork valueForKeyPath:@"configuration.transport"];
+    id transport3 = [(id)client3.serviceNetwork valueForKeyPath:@"configuration.transport"];
+
+    XCTAssertEqual(transport1, transport2);
+    XCTAssertNotEqual(transport1, transport3);
+    XCTAssertNotEqual([(id)client1.subscriptionNetwork valueForKeyPath:@"configuration.transport"],
+                      [(id)client2.subscriptionNetwork valueForKeyPath:@"configuration.transport"]);
+}
+
+- (void)testItShouldNotShareServiceTransportByDefault {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo" userID:@"uuid"];
+    configuration.origin = @"127.0.0.1";
+    PubNub *client1 = [PubNub clientWithConfiguration:configuration];
+    PubNub *client2 = [PubNub clientWithConfiguration:configuration];
+
+    XCTAssertNotEqual([(id)client1.serviceNetwork valueForKeyPath:@"configuration.transport"],
+                      [(id)client2.serviceNetwork valueForKeyPath:@"configuration.transport"]);
+}
+
+
+#pragma mark - Tests :: Publish queue
+
+- (void)testItShouldCreatePublishQueueOnlyWhenConfigured {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo" userID:@"uuid"];
+    PubNub *client1 = [PubNub clientWithConfiguration:configuration];
+    configuration.maximumInFlightPublishRequests = 8;
+    configuration.maximumInFlightPublishRequestsPerChannel = 4;
+    configuration.maximumPublishQueueLength = 100;
+    PubNub *client2 = [PubNub clientWithConfiguration:configuration];
+
+    XCTAssertNil(client1.publishQueue);
+    XCTAssertEqual(client2.publishQueue.maximumInFlightRequests, 8);
+    XCTAssertEqual(client2.publishQueue.maximumInFlightRequestsPerChannel, 4);
+    XCTAssertEqual(client2.publishQueue.maximumLength, 100);
+    XCTAssertEqual(((PNConfiguration *)[configuration copy]).maximumPublishQueueLength, 100);
+}
+
 #pragma mark -
 
 #pragma clang diagnostic pop
@@ -0,0 +1,263 @@
+#import <PubNub/PNCryptorInputStream+Private.h>
+#import <PubNub/PNCCCryptorWrapper.h>
+#import <PubNub/PNEncryptedStream.h>
+#import <PubNub/PNAESCBCCryptor.h>
+#import <CommonCrypto/CommonCryptor.h>
+#import <CommonCrypto/CommonHMAC.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Static
+
+/// Length of data which is used for throughput measurement.
+static NSUInteger const kPNCryptorInputStreamBenchmarkDataLength = 16 * 1024 * 1024;
+
+/// Length of reader's buffer which is used for throughput measurement (similar to the one used by URL loading system).
+static NSUInteger const kPNCryptorInputStreamBenchmarkReadLength = 32 * 1024;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Cryptor input stream unit tests.
+@interface PNCryptorInputStreamTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create data filled with random bytes.
+///
+/// - Parameter length: Length of data which should be created.
+/// - Returns: Data with random bytes.
+- (NSData *)randomDataWithLength:(NSUInteger)length;
+
+/// Read whole stream content.
+///
+/// - Parameters:
+///   - stream: Stream from which data should be read.
+///   - bufferLength: Length of buffer which should be used for each `read` call.
+/// - Returns: Data which has been read from `stream`.
+- (NSData *)dataFromStream:(NSInputStream *)stream withBufferLength:(NSUInteger)bufferLength;
+
+/// Encrypt data with stream encryption.
+///
+/// - Parameters:
+///   - data: Data which should be encrypted.
+///   - cryptor: Cryptor which should be used for encryption.
+///   - bufferLength: Length of buffer which should be used for each `read` call.
+///   - initializationVector: Upon return contains initialization vector which has been used for encryption.
+/// - Returns: Encrypted data.
+- (NSData *)encryptedData:(NSData *)data
+              withCryptor:(PNAESCBCCryptor *)cryptor
+             bufferLength:(NSUInteger)bufferLength
+     initializationVector:(NSData * _Nullable * _Nonnull)initializationVector;
+
+/// Decrypt data with stream decryption.
+///
+/// - Parameters:
+///   - data: Data which should be decrypted.
+///   - cryptor: Cryptor which should be used for decryption.
+///   - bufferLength: Length of buffer which should be used for each `read` call.
+///   - initializationVector: Initialization vector which has been used for encryption.
+/// - Returns: Decrypted data.
+- (NSData *)decryptedData:(NSData *)data
+              withCryptor:(PNAESCBCCryptor *)cryptor
+             bufferLength:(NSUInteger)bufferLength
+     initializationVector:(NSData *)initializationVector;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNCryptorInputStreamTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Configuration
+
+- (void)testItShouldClampStreamChunkLength {
+    PNAESCBCCryptor *cryptor = [PNAESCBCCryptor cryptorWithCipherKey:@"enigma"];
+
+    XCTAssertEqual(cryptor.streamChunkLength, 64 * 1024);
+
+    cryptor.streamChunkLength = 16;
+    XCTAssertEqual(cryptor.streamChunkLength, 64 * 1024);
+
+    cryptor.streamChunkLength = 8 * 1024 * 1024;
+    XCTAssertEqual(cryptor.streamChunkLength, 1024 * 1024);
+}
+
+
+#pragma mark - Tests :: Processing
+
+- (void)testItShouldEncryptAndDecryptStreamWithDifferentChunkAndBufferLengths {
+    NSArray<NSNumber *> *chunkLengths = @[@(64 * 1024), @(256 * 1024), @(1024 * 1024)];
+    NSArray<NSNumber *> *bufferLengths = @[@1000, @(32 * 1024), @(2 * 1024 * 1024)];
+    NSArray<NSNumber *> *dataLengths = @[@1, @16, @(64 * 1024), @(300 * 1024 + 7)];
+    PNAESCBCCryptor *cryptor = [PNAESCBCCryptor cryptorWithCipherKey:@"enigma"];
+
+    for (NSNumber *chunkLength in chunkLengths) {
+        cryptor.streamChunkLength = chunkLength.unsignedIntegerValue;
+
+        for (NSNumber *bufferLength in bufferLengths) {
+            for (NSNumber *dataLength in dataLengths) {
+                NSData *data = [self randomDataWithLength:dataLength.unsignedIntegerValue];
+                NSData *initializationVector = nil;
+                NSData *encrypted = [self encryptedData:data
+                                            withCryptor:cryptor
+                                           bufferLength:bufferLength.unsignedIntegerValue
+                                   initializationVector:&initializationVector];
+
+                XCTAssertEqual(encrypted.length, (data.length / kCCBlockSizeAES128 + 1) * kCCBlockSizeAES128);
+
+                NSData *decrypted = [self decryptedData:encrypted
+                                            withCryptor:cryptor
+                                           bufferLength:bufferLength.unsignedIntegerValue
+                                   initializationVector:initializationVector];
+
+                XCTAssertEqualObjects(decrypted, data, @"Chunk: %@, buffer: %@, data: %@",
+                                      chunkLength, bufferLength, dataLength);
+            }
+        }
+    }
+}
+
+- (void)testItShouldProduceSameOutputAsBlockSizedChunks {
+    PNAESCBCCryptor *cryptor = [PNAESCBCCryptor cryptorWithCipherKey:@"enigma"];
+    NSData *data = [self randomDataWithLength:200 * 1024 + 3];
+    NSData *initializationVector = nil;
+    NSData *encrypted = [self encryptedData:data
+                                withCryptor:cryptor
+                               bufferLength:32 * 1024
+                       initializationVector:&initializationVector];
+
+    NSMutableData *key = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+    NSData *keyData = [@"enigma" dataUsingEncoding:NSUTF8StringEncoding];
+    CC_SHA256(keyData.bytes, (CC_LONG)keyData.length, key.mutableBytes);
+    PNCCCryptorWrapper *wrapper = [PNCCCryptorWrapper AESCBCEncryptorWithCipherKey:key
+                                                              initializationVector:initializationVector].data;
+    PNCryptorInputStream *stream = [PNCryptorInputStream inputStreamWithInputStream:[NSInputStream inputStreamWithData:data]
+                                                                         dataLength:data.length
+                                                                        chunkLength:kCCBlockSizeAES128
+                                                                    processingBlock:^PNResult<NSData *> *(uint8_t *buffer,
+                                                                                                          NSUInteger length,
+                                                                                                          BOOL finalyze) {
+        return [wrapper processDataFromDataChunk:buffer withLength:length andFinalised:finalyze];
+    }];
+
+    XCTAssertEqualObjects([self dataFromStream:stream withBufferLength:32 * 1024], encrypted);
+}
+
+
+#pragma mark - Tests :: Throughput
+
+- (void)testItShouldMeasureBlockSizedChunksEncryptionThroughput {
+    NSData *data = [self randomDataWithLength:kPNCryptorInputStreamBenchmarkDataLength];
+    NSData *key = [self randomDataWithLength:kCCKeySizeAES256];
+    NSData *initializationVector = [self randomDataWithLength:kCCBlockSizeAES128];
+
+    [self measureBlock:^{
+        PNCCCryptorWrapper *wrapper = [PNCCCryptorWrapper AESCBCEncryptorWithCipherKey:key
+                                                                  initializationVector:initializationVector].data;
+        NSInputStream *source = [NSInputStream inputStreamWithData:data];
+        PNCryptorInputStream *stream = [PNCryptorInputStream inputStreamWithInputStream:source
+                                                                             dataLength:data.length
+                                                                            chunkLength:kCCBlockSizeAES128
+                                                                        processingBlock:^PNResult<NSData *> *(uint8_t *buffer,
+                                                                                                              NSUInteger length,
+                                                                                                              BOOL finalyze) {
+            return [wrapper processDataFromDataChunk:buffer withLength:length andFinalised:finalyze];
+        }];
+
+        NSData *encrypted = [self dataFromStream:stream withBufferLength:kPNCryptorInputStreamBenchmarkReadLength];
+        XCTAssertGreaterThan(encrypted.length, data.length);
+    }];
+}
+
+- (void)testItShouldMeasureLargeChunksEncryptionThroughput {
+    PNAESCBCCryptor *cryptor = [PNAESCBCCryptor cryptorWithCipherKey:@"enigma"];
+    NSData *data = [self randomDataWithLength:kPNCryptorInputStreamBenchmarkDataLength];
+    cryptor.streamChunkLength = 1024 * 1024;
+
+    [self measureBlock:^{
+        NSData *initializationVector = nil;
+        NSData *encrypted = [self encryptedData:data
+                                    withCryptor:cryptor
+                                   bufferLength:kPNCryptorInputStreamBenchmarkReadLength
+                           initializationVector:&initializationVector];
+
+        XCTAssertGreaterThan(encrypted.length, data.length);
+    }];
+}
+
+
+#pragma mark - Helpers
+
+- (NSData *)randomDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    XCTAssertEqual(SecRandomCopyBytes(kSecRandomDefault, length, data.mutableBytes), errSecSuccess);
+
+    return data;
+}
+
+- (NSData *)dataFromStream:(NSInputStream *)stream withBufferLength:(NSUInteger)bufferLength {
+    NSMutableData *buffer = [NSMutableData dataWithLength:bufferLength];
+    NSMutableData *data = [NSMutableData new];
+    NSInteger bytesRead = 0;
+
+    [stream open];
+    while ((bytesRead = [stream read:buffer.mutableBytes maxLength:bufferLength]) > 0) {
+        [data appendBytes:buffer.bytes length:(NSUInteger)bytesRead];
+    }
+    [stream close];
+
+    XCTAssertEqual(bytesRead, 0);
+
+    return data;
+}
+
+- (NSData *)encryptedData:(NSData *)data
+              withCryptor:(PNAESCBCCryptor *)cryptor
+             bufferLength:(NSUInteger)bufferLength
+     initializationVector:(NSData **)initializationVector {
+    PNResult<PNEncryptedStream *> *result = [cryptor encryptStream:[NSInputStream inputStreamWithData:data]
+                                                        dataLength:data.length];
+    XCTAssertFalse(result.isError);
+    *initializationVector = result.data.metadata;
+
+    return [self dataFromStream:result.data.stream withBufferLength:bufferLength];
+}
+
+- (NSData *)decryptedData:(NSData *)data
+              withCryptor:(PNAESCBCCryptor *)cryptor
+             bufferLength:(NSUInteger)bufferLength
+     initializationVector:(NSData *)initializationVector {
+    PNCryptorInputStream *source = [PNCryptorInputStream inputStreamWithInputStream:[NSInputStream inputStreamWithData:data]
+                                                                          dataLength:data.length];
+    PNEncryptedStream *stream = [PNEncryptedStream encryptedStreamWithStream:source
+                                                                  dataLength:data.length
+                                                                    metadata:initializationVector];
+    PNResult<NSInputStream *> *result = [cryptor decryptStream:stream dataLength:data.length];
+    XCTAssertFalse(result.isError);
+
+    return [self dataFromStream:result.data withBufferLength:bufferLength];
+}
+
+#pragma mark -
+
+
+@end
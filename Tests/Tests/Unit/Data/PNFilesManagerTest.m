@@ -0,0 +1,95 @@
+#import <PubNub/PNFilesManager.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Files manager unit tests.
+@interface PNFilesManagerTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Files manager which is used by tests.
+@property(strong, nonatomic) PNFilesManager *manager;
+
+/// Unique identifier of the "downloaded" file.
+@property(copy, nonatomic) NSString *fileIdentifier;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNFilesManagerTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"
+                                                                           userID:@"tester"];
+    self.manager = [PNFilesManager filesManagerForClient:[PubNub clientWithConfiguration:configuration]];
+    self.fileIdentifier = NSUUID.UUID.UUIDString;
+}
+
+- (void)tearDown {
+    [self.manager storeResumeData:nil forFileWithIdentifier:self.fileIdentifier];
+
+    [super tearDown];
+}
+
+
+#pragma mark - Tests :: Resumable download
+
+- (void)testItShouldStoreResumeDataForFile {
+    NSData *resumeData = [@"partial-download" dataUsingEncoding:NSUTF8StringEncoding];
+
+    XCTAssertNil([self.manager resumeDataForFileWithIdentifier:self.fileIdentifier]);
+    [self.manager storeResumeData:resumeData forFileWithIdentifier:self.fileIdentifier];
+
+    XCTAssertEqualObjects([self.manager resumeDataForFileWithIdentifier:self.fileIdentifier], resumeData);
+    XCTAssertNil([self.manager resumeDataForFileWithIdentifier:NSUUID.UUID.UUIDString]);
+}
+
+- (void)testItShouldRemoveResumeDataForFile {
+    NSData *resumeData = [@"partial-download" dataUsingEncoding:NSUTF8StringEncoding];
+
+    [self.manager storeResumeData:resumeData forFileWithIdentifier:self.fileIdentifier];
+    [self.manager storeResumeData:nil forFileWithIdentifier:self.fileIdentifier];
+
+    XCTAssertNil([self.manager resumeDataForFileWithIdentifier:self.fileIdentifier]);
+}
+
+- (void)testItShouldStoreResumeDataForIdentifierWithPathSeparators {
+    NSData *resumeData = [@"partial-download" dataUsingEncoding:NSUTF8StringEncoding];
+    NSString *identifier = @"../files/identifier";
+
+    [self.manager storeResumeData:resumeData forFileWithIdentifier:identifier];
+
+    XCTAssertEqualObjects([self.manager resumeDataForFileWithIdentifier:identifier], resumeData);
+    [self.manager storeResumeData:nil forFileWithIdentifier:identifier];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,178 @@
+#import <PubNub/PNHeartbeatScheduler.h>
+#import <PubNub/PNHeartbeat.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Heartbeat manager which counts scheduler triggers instead of sending heartbeat requests.
+@interface PNTestHeartbeat : PNHeartbeat
+
+
+#pragma mark - Properties
+
+/// Block which is called when scheduler triggers heartbeat manager.
+@property(copy, nullable, nonatomic) dispatch_block_t timerBlock;
+
+#pragma mark -
+
+
+@end
+
+
+/// Shared heartbeat scheduler unit tests.
+@interface PNHeartbeatSchedulerTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// **PubNub** client which is used to create heartbeat managers.
+@property(strong, nonatomic) PubNub *testClient;
+
+/// Scheduled heartbeat managers which should be unscheduled after test.
+@property(strong, nonatomic) NSMutableArray<PNHeartbeat *> *heartbeats;
+
+
+#pragma mark - Helpers
+
+/// Create heartbeat manager which will be unscheduled after test.
+///
+/// - Returns: Test heartbeat manager.
+- (PNTestHeartbeat *)heartbeat;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNTestHeartbeat
+
+- (void)handleHeartbeatTimer {
+    if (self.timerBlock) self.timerBlock();
+}
+
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNHeartbeatSchedulerTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"
+                                                                           userID:@"tester"];
+    self.testClient = [PubNub clientWithConfiguration:configuration];
+    self.heartbeats = [NSMutableArray new];
+}
+
+- (void)tearDown {
+    for (PNHeartbeat *heartbeat in self.heartbeats) {
+        [[PNHeartbeatScheduler sharedScheduler] unscheduleHeartbeat:heartbeat];
+    }
+
+    [super tearDown];
+}
+
+
+#pragma mark - Tests :: Scheduling
+
+- (void)testItShouldShareTimerForHeartbeatsFromSameGroup {
+    PNHeartbeatScheduler *scheduler = [PNHeartbeatScheduler sharedScheduler];
+    NSUInteger timersCount = scheduler.timersCount;
+
+    [scheduler scheduleHeartbeat:[self heartbeat] withInterval:120.f group:@"origin|key-a"];
+    [scheduler scheduleHeartbeat:[self heartbeat] withInterval:120.f group:@"origin|key-a"];
+    XCTAssertEqual(scheduler.timersCount, timersCount + 1);
+
+    [scheduler scheduleHeartbeat:[self heartbeat] withInterval:120.f group:@"origin|key-b"];
+    [scheduler scheduleHeartbeat:[self heartbeat] withInterval:60.f group:@"origin|key-a"];
+    XCTAssertEqual(scheduler.timersCount, timersCount + 3);
+}
+
+- (void)testItShouldCancelGroupTimerWhenLastHeartbeatUnscheduled {
+    PNHeartbeatScheduler *scheduler = [PNHeartbeatScheduler sharedScheduler];
+    NSUInteger timersCount = scheduler.timersCount;
+    PNTestHeartbeat *heartbeat1 = [self heartbeat];
+    PNTestHeartbeat *heartbeat2 = [self heartbeat];
+
+    [scheduler scheduleHeartbeat:heartbeat1 withInterval:120.f group:@"origin|key-c"];
+    [scheduler scheduleHeartbeat:heartbeat2 withInterval:120.f group:@"origin|key-c"];
+
+    [scheduler unscheduleHeartbeat:heartbeat1];
+    XCTAssertEqual(scheduler.timersCount, timersCount + 1);
+
+    [scheduler unscheduleHeartbeat:heartbeat2];
+    XCTAssertEqual(scheduler.timersCount, timersCount);
+}
+
+- (void)testItShouldMoveHeartbeatToNewGroupWhenRescheduled {
+    PNHeartbeatScheduler *scheduler = [PNHeartbeatScheduler sharedScheduler];
+    NSUInteger timersCount = scheduler.timersCount;
+    PNTestHeartbeat *heartbeat = [self heartbeat];
+
+    [scheduler scheduleHeartbeat:heartbeat withInterval:120.f group:@"origin|key-d"];
+    [scheduler scheduleHeartbeat:heartbeat withInterval:30.f group:@"origin|key-d"];
+
+    XCTAssertEqual(scheduler.timersCount, timersCount + 1);
+}
+
+- (void)testItShouldTriggerAllHeartbeatsFromGroupWithSingleTimer {
+    XCTestExpectation *triggerExpectation = [self expectationWithDescription:@"Heartbeats triggered"];
+    PNHeartbeatScheduler *scheduler = [PNHeartbeatScheduler sharedScheduler];
+    triggerExpectation.expectedFulfillmentCount = 2;
+    triggerExpectation.assertForOverFulfill = NO;
+    PNTestHeartbeat *heartbeat1 = [self heartbeat];
+    PNTestHeartbeat *heartbeat2 = [self heartbeat];
+    __block BOOL heartbeat1Triggered = NO;
+    __block BOOL heartbeat2Triggered = NO;
+
+    heartbeat1.timerBlock = ^{
+        if (!heartbeat1Triggered) [triggerExpectation fulfill];
+        heartbeat1Triggered = YES;
+    };
+    heartbeat2.timerBlock = ^{
+        if (!heartbeat2Triggered) [triggerExpectation fulfill];
+        heartbeat2Triggered = YES;
+    };
+
+    [scheduler scheduleHeartbeat:heartbeat1 withInterval:0.5f group:@"origin|key-e"];
+    [scheduler scheduleHeartbeat:heartbeat2 withInterval:0.5f group:@"origin|key-e"];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+}
+
+
+#pragma mark - Helpers
+
+- (PNTestHeartbeat *)heartbeat {
+    PNTestHeartbeat *heartbeat = [PNTestHeartbeat heartbeatForClient:self.testClient];
+    [self.heartbeats addObject:heartbeat];
+
+    return heartbeat;
+}
+
+#pragma mark -
+
+
+@end
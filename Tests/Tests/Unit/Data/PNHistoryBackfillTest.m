@@ -0,0 +1,290 @@
+#import <PubNub/PNStatus+Private.h>
+#import <PubNub/PNHistoryBackfill.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Constants
+
+/// Timetoken of the oldest message in fake history.
+static unsigned long long const kPNTestBaseTimetoken = 17000000000000000;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// History backfill engine unit tests.
+@interface PNHistoryBackfillTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Queue on which fake pages are "received".
+@property(strong, nonatomic) dispatch_queue_t networkQueue;
+
+/// Queue on which engine calls batch and completion blocks.
+@property(strong, nonatomic) dispatch_queue_t callbackQueue;
+
+/// Fake channels' history.
+@property(strong, nonatomic) NSDictionary<NSString *, NSArray<NSNumber *> *> *history;
+
+/// Number of in-flight fake requests.
+@property(assign, nonatomic) NSUInteger activeRequests;
+
+/// Maximum number of concurrent fake requests.
+@property(assign, nonatomic) NSUInteger maximumActiveRequests;
+
+
+#pragma mark - Helpers
+
+/// Create fetch block which returns pages from fake history.
+///
+/// - Parameters:
+///   - pageSize: Maximum number of messages in each page.
+///   - failedChannel: Name of channel for which request should fail or `nil`.
+/// - Returns: Fetch block for history backfill engine.
+- (PNHistoryBackfillFetchBlock)fetchBlockWithPageSize:(NSUInteger)pageSize
+                                        failedChannel:(nullable NSString *)failedChannel;
+
+/// Run history backfill.
+///
+/// - Parameters:
+///   - request: Request with information about backfill range and channels.
+///   - budget: Maximum number of concurrent requests.
+///   - failedChannel: Name of channel for which request should fail or `nil`.
+///   - stopAfter: Number of batches after which backfill should be stopped or `NSNotFound`.
+///   - messages: List where received messages should be stored.
+///   - batchesCount: Pointer to the variable where number of received batches should be stored.
+/// - Returns: Progress and status passed to the completion block.
+- (NSArray *)backfillWithRequest:(PNHistoryBackfillRequest *)request
+                          budget:(NSUInteger)budget
+                   failedChannel:(nullable NSString *)failedChannel
+                       stopAfter:(NSUInteger)stopAfter
+                        messages:(NSMutableArray<NSDictionary *> *)messages
+                    batchesCount:(NSUInteger *)batchesCount;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNHistoryBackfillTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.networkQueue = dispatch_queue_create("com.pubnub.test.network", DISPATCH_QUEUE_SERIAL);
+    self.callbackQueue = dispatch_queue_create("com.pubnub.test.callback", DISPATCH_QUEUE_SERIAL);
+
+    NSMutableArray<NSNumber *> *chat = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *news = [NSMutableArray new];
+    for (unsigned long long offset = 0; offset < 1000; offset += 3) [chat addObject:@(kPNTestBaseTimetoken + offset)];
+    for (unsigned long long offset = 1; offset < 1000; offset += 7) [news addObject:@(kPNTestBaseTimetoken + offset)];
+    self.history = @{ @"chat": chat, @"news": news };
+}
+
+
+#pragma mark - Tests :: Backfill
+
+- (void)testItShouldStreamAllMessagesInTimetokenOrder {
+    PNHistoryBackfillRequest *request = [PNHistoryBackfillRequest requestWithChannels:@[@"chat", @"news"]
+                                                                                 start:@(kPNTestBaseTimetoken)
+                                                                                   end:@(kPNTestBaseTimetoken + 999)];
+    NSMutableArray<NSDictionary *> *messages = [NSMutableArray new];
+    NSUInteger batchesCount = 0;
+    request.windowsCount = 4;
+
+    NSArray *result = [self backfillWithRequest:request
+                                         budget:3
+                                  failedChannel:nil
+                                      stopAfter:NSNotFound
+                                       messages:messages
+                                   batchesCount:&batchesCount];
+    PNHistoryBackfillProgress *progress = result.firstObject;
+
+    XCTAssertEqual(result.count, 1);
+    XCTAssertEqual(batchesCount, 4);
+    XCTAssertEqual(messages.count, self.history[@"chat"].count + self.history[@"news"].count);
+    XCTAssertEqual(progress.messagesCount, messages.count);
+    XCTAssertEqual(progress.completedWindows, 4);
+    XCTAssertEqual(progress.totalWindows, 4);
+    XCTAssertGreaterThan(progress.requestsCount, 8);
+    XCTAssertLessThanOrEqual(self.maximumActiveRequests, 3);
+
+    for (NSUInteger idx = 1; idx < messages.count; idx++) {
+        XCTAssertLessThan([messages[idx - 1][@"timetoken"] compare:messages[idx][@"timetoken"]], NSOrderedDescending);
+    }
+
+    NSArray *chat = [[messages filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"channel = 'chat'"]]
+                     valueForKey:@"timetoken"];
+    XCTAssertEqualObjects(chat, self.history[@"chat"]);
+}
+
+- (void)testItShouldResumeBackfillWithProgressToken {
+    PNHistoryBackfillRequest *request = [PNHistoryBackfillRequest requestWithChannels:@[@"chat", @"news"]
+                                                                                 start:@(kPNTestBaseTimetoken)
+                                                                                   end:@(kPNTestBaseTimetoken + 999)];
+    NSMutableArray<NSDictionary *> *messages = [NSMutableArray new];
+    NSUInteger batchesCount = 0;
+    request.windowsCount = 5;
+
+    NSArray *result = [self backfillWithRequest:request
+                                         budget:2
+                                  failedChannel:nil
+                                      stopAfter:2
+                                       messages:messages
+                                   batchesCount:&batchesCount];
+    PNHistoryBackfillProgress *progress = result.firstObject;
+    XCTAssertEqual(batchesCount, 2);
+    XCTAssertEqual(progress.completedWindows, 2);
+
+    request.progressToken = progress.token;
+    request.windowsCount = 10;
+    result = [self backfillWithRequest:request
+                                budget:2
+                         failedChannel:nil
+                             stopAfter:NSNotFound
+                              messages:messages
+                          batchesCount:&batchesCount];
+    progress = result.firstObject;
+
+    XCTAssertEqual(result.count, 1);
+    XCTAssertEqual(batchesCount, 3);
+    XCTAssertEqual(progress.completedWindows, 5);
+    XCTAssertEqual(messages.count, self.history[@"chat"].count + self.history[@"news"].count);
+}
+
+- (void)testItShouldCompleteWithErrorWhenPageFetchFails {
+    PNHistoryBackfillRequest *request = [PNHistoryBackfillRequest requestWithChannels:@[@"chat", @"broken"]
+                                                                                 start:@(kPNTestBaseTimetoken)
+                                                                                   end:@(kPNTestBaseTimetoken + 999)];
+    NSMutableArray<NSDictionary *> *messages = [NSMutableArray new];
+    NSUInteger batchesCount = 0;
+
+    NSArray *result = [self backfillWithRequest:request
+                                         budget:4
+                                  failedChannel:@"broken"
+                                      stopAfter:NSNotFound
+                                       messages:messages
+                                   batchesCount:&batchesCount];
+    PNHistoryBackfillProgress *progress = result.firstObject;
+
+    XCTAssertEqual(result.count, 2);
+    XCTAssertEqual(batchesCount, 0);
+    XCTAssertEqual(progress.completedWindows, 0);
+    XCTAssertNotNil(progress.token);
+}
+
+- (void)testItShouldCompleteWithErrorForInvalidRange {
+    PNHistoryBackfillRequest *request = [PNHistoryBackfillRequest requestWithChannels:@[@"chat"]
+                                                                                 start:@(kPNTestBaseTimetoken + 10)
+                                                                                   end:@(kPNTestBaseTimetoken)];
+    NSMutableArray<NSDictionary *> *messages = [NSMutableArray new];
+    NSUInteger batchesCount = 0;
+
+    NSArray *result = [self backfillWithRequest:request
+                                         budget:1
+                                  failedChannel:nil
+                                      stopAfter:NSNotFound
+                                       messages:messages
+                                   batchesCount:&batchesCount];
+
+    XCTAssertEqual(result.count, 2);
+    XCTAssertEqual(((PNErrorStatus *)result.lastObject).category, PNBadRequestCategory);
+    XCTAssertEqual(batchesCount, 0);
+}
+
+
+#pragma mark - Helpers
+
+- (PNHistoryBackfillFetchBlock)fetchBlockWithPageSize:(NSUInteger)pageSize
+                                        failedChannel:(NSString *)failedChannel {
+    dispatch_queue_t queue = self.networkQueue;
+
+    return ^(NSString *channel, NSNumber *lowerBound, NSNumber *upperBound, PNHistoryBackfillPageBlock pageBlock) {
+        dispatch_async(queue, ^{
+            self.activeRequests++;
+            self.maximumActiveRequests = MAX(self.maximumActiveRequests, self.activeRequests);
+        });
+
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.01f * NSEC_PER_SEC)), queue, ^{
+            self.activeRequests--;
+
+            if ([channel isEqualToString:failedChannel]) {
+                pageBlock(nil, nil, [PNErrorStatus objectWithOperation:PNHistoryOperation
+                                                              category:PNBadRequestCategory
+                                                              response:nil]);
+                return;
+            }
+
+            NSPredicate *predicate = [NSPredicate predicateWithFormat:@"SELF >= %@ AND SELF < %@",
+                                      lowerBound, upperBound];
+            NSArray<NSNumber *> *timetokens = [self.history[channel] filteredArrayUsingPredicate:predicate];
+            // Service returns newest messages from range.
+            if (timetokens.count > pageSize) {
+                timetokens = [timetokens subarrayWithRange:NSMakeRange(timetokens.count - pageSize, pageSize)];
+            }
+
+            NSMutableArray<NSDictionary *> *messages = [NSMutableArray new];
+            for (NSNumber *timetoken in timetokens) {
+                [messages addObject:@{ @"message": @"hello", @"timetoken": timetoken }];
+            }
+
+            pageBlock(messages, timetokens.count == pageSize ? timetokens.firstObject : nil, nil);
+        });
+    };
+}
+
+- (NSArray *)backfillWithRequest:(PNHistoryBackfillRequest *)request
+                          budget:(NSUInteger)budget
+                   failedChannel:(NSString *)failedChannel
+                       stopAfter:(NSUInteger)stopAfter
+                        messages:(NSMutableArray<NSDictionary *> *)messages
+                    batchesCount:(NSUInteger *)batchesCount {
+    XCTestExpectation *completionExpectation = [self expectationWithDescription:@"Backfill completed"];
+    NSMutableArray *result = [NSMutableArray new];
+    __block NSUInteger count = 0;
+
+    PNHistoryBackfill *backfill = [PNHistoryBackfill backfillWithRequest:request
+                                               maximumConcurrentRequests:budget
+                                                              fetchBlock:[self fetchBlockWithPageSize:10
+                                                                                        failedChannel:failedChannel]
+                                                           callbackQueue:self.callbackQueue
+                                                              batchBlock:^(NSArray *batch,
+                                                                           PNHistoryBackfillProgress *progress,
+                                                                           BOOL *stop) {
+        [messages addObjectsFromArray:batch];
+        *stop = ++count == stopAfter;
+    } completionBlock:^(PNHistoryBackfillProgress *progress, PNErrorStatus *status) {
+        [result addObject:progress];
+        if (status) [result addObject:status];
+        [completionExpectation fulfill];
+    }];
+    [backfill start];
+
+    [self waitForExpectationsWithTimeout:10.f handler:nil];
+    *batchesCount = count;
+
+    return result;
+}
+
+#pragma mark -
+
+
+@end
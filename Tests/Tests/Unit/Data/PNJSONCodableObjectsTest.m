@@ -0,0 +1,168 @@
+#import <PubNub/PNJSONCodableObjects.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+#import <stdatomic.h>
+
+
+#pragma mark Constants
+
+/// Number of coding plan lookups which is done by each thread in stress test.
+static NSUInteger const kPNTestCodecPlanLookupsCount = 20000;
+
+/// Number of threads which concurrently look up coding plans.
+static NSUInteger const kPNTestCodecPlanThreadsCount = 8;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// First codable model for coding plans tests.
+@interface PNTestCodableModelA : NSObject
+
+
+#pragma mark - Properties
+
+/// Model name.
+@property(strong, nonatomic) NSString *name;
+
+#pragma mark -
+
+
+@end
+
+
+/// Second codable model for coding plans tests.
+@interface PNTestCodableModelB : NSObject
+
+
+#pragma mark - Properties
+
+/// Model value.
+@property(strong, nonatomic) NSNumber *value;
+
+#pragma mark -
+
+
+@end
+
+
+/// Third codable model for coding plans tests.
+@interface PNTestCodableModelC : NSObject
+
+
+#pragma mark - Properties
+
+/// Model items.
+@property(strong, nonatomic) NSArray<NSString *> *items;
+
+#pragma mark -
+
+
+@end
+
+
+/// Codable objects manager coding plans unit tests.
+@interface PNJSONCodableObjectsTest : PNRecordableTestCase
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNTestCodableModelA
+@end
+
+
+@implementation PNTestCodableModelB
+@end
+
+
+@implementation PNTestCodableModelC
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNJSONCodableObjectsTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)tearDown {
+    [PNJSONCodableObjects clearAllClasses];
+
+    [super tearDown];
+}
+
+
+#pragma mark - Tests :: Lookup
+
+- (void)testItShouldReturnSamePlanForClass {
+    PNJSONCodecPlan *plan = [PNJSONCodableObjects codecPlanForClass:[PNTestCodableModelA class]];
+
+    XCTAssertNotNil(plan);
+    XCTAssertEqual(plan.codableClass, [PNTestCodableModelA class]);
+    XCTAssertEqualObjects(plan.codingKeys, @{ @"name": @"name" });
+    XCTAssertEqual([PNJSONCodableObjects codecPlanForClass:[PNTestCodableModelA class]], plan);
+}
+
+- (void)testItShouldNotReturnPlanForFoundationClass {
+    XCTAssertNil([PNJSONCodableObjects codecPlanForClass:[NSDictionary class]]);
+}
+
+- (void)testItShouldCreateNewPlanAfterClear {
+    PNJSONCodecPlan *plan = [PNJSONCodableObjects codecPlanForClass:[PNTestCodableModelB class]];
+
+    [PNJSONCodableObjects clearAllClasses];
+    PNJSONCodecPlan *newPlan = [PNJSONCodableObjects codecPlanForClass:[PNTestCodableModelB class]];
+
+    XCTAssertNotEqual(newPlan, plan);
+    XCTAssertEqual(newPlan.codableClass, [PNTestCodableModelB class]);
+    XCTAssertEqualObjects(plan.codingKeys, newPlan.codingKeys);
+}
+
+
+#pragma mark - Tests :: Concurrency
+
+- (void)testItShouldReturnPlanOfRequestedClassWhileClearedConcurrently {
+    NSArray<Class> *classes = @[[PNTestCodableModelA class], [PNTestCodableModelB class], [PNTestCodableModelC class]];
+    __block _Atomic(NSUInteger) mismatchesCount = 0;
+    __block _Atomic(BOOL) lookupsCompleted = NO;
+    XCTestExpectation *clearExpectation = [self expectationWithDescription:@"Clear completed"];
+
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        while (!atomic_load(&lookupsCompleted)) [PNJSONCodableObjects clearAllClasses];
+        [clearExpectation fulfill];
+    });
+
+    dispatch_apply(kPNTestCodecPlanThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t iteration) {
+        for (NSUInteger idx = 0; idx < kPNTestCodecPlanLookupsCount; idx++) {
+            Class aClass = classes[(idx + iteration) % classes.count];
+            PNJSONCodecPlan *plan = [PNJSONCodableObjects codecPlanForClass:aClass];
+            if (plan.codableClass != aClass || plan.codingKeys.count != 1) atomic_fetch_add(&mismatchesCount, 1);
+        }
+    });
+
+    atomic_store(&lookupsCompleted, YES);
+    [self waitForExpectations:@[clearExpectation] timeout:10.f];
+
+    XCTAssertEqual(atomic_load(&mismatchesCount), 0);
+}
+
+#pragma mark -
+
+
+@end
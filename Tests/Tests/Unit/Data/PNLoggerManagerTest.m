@@ -0,0 +1,315 @@
+#import <PubNub/PNDictionaryLogEntry+Private.h>
+#import <PubNub/PNLoggerManager+Private.h>
+#import <PubNub/PNStringLogEntry+Private.h>
+#import <PubNub/PNLogRingBuffer.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Constants
+
+/// Number of log entries which are logged in benchmarks.
+static NSUInteger const kPNTestLoggerEntriesCount = 10000;
+
+/// Number of threads which concurrently add entries to the buffer.
+static NSUInteger const kPNTestLoggerThreadsCount = 8;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// Logger which stores received log entries.
+@interface PNTestRecordingLogger : NSObject <PNLogger>
+
+
+#pragma mark - Properties
+
+/// Log entries in order in which they have been received.
+@property(strong, nonatomic) NSMutableArray<PNLogEntry *> *entries;
+
+/// Semaphore which blocks logger until signalled.
+@property(strong, nullable, atomic) dispatch_semaphore_t gate;
+
+#pragma mark -
+
+
+@end
+
+
+/// Loggers' manager asynchronous pipeline unit tests.
+@interface PNLoggerManagerTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Logger which is used by loggers' manager.
+@property(strong, nonatomic) PNTestRecordingLogger *logger;
+
+
+#pragma mark - Helpers
+
+/// Create loggers' manager with recording logger.
+///
+/// - Parameter bufferSize: Maximum number of log entries which can wait for logger.
+/// - Returns: Loggers' manager for tests.
+- (PNLoggerManager *)managerWithBufferSize:(NSUInteger)bufferSize;
+
+/// Create text log entry.
+///
+/// - Parameter text: Log entry message.
+/// - Returns: Log entry for tests.
+- (PNLogEntry *)entryWithText:(NSString *)text;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNTestRecordingLogger
+
+- (instancetype)init {
+    if ((self = [super init])) _entries = [NSMutableArray new];
+
+    return self;
+}
+
+- (void)recordMessage:(PNLogEntry *)message {
+    if (self.gate) dispatch_semaphore_wait(self.gate, DISPATCH_TIME_FOREVER);
+    @synchronized (self.entries) {
+        [self.entries addObject:message];
+    }
+}
+
+- (void)traceWithMessage:(PNLogEntry *)message {
+    [self recordMessage:message];
+}
+
+- (void)debugWithMessage:(PNLogEntry *)message {
+    [self recordMessage:message];
+}
+
+- (void)infoWithMessage:(PNLogEntry *)message {
+    [self recordMessage:message];
+}
+
+- (void)warnWithMessage:(PNLogEntry *)message {
+    [self recordMessage:message];
+}
+
+- (void)errorWithMessage:(PNLogEntry *)message {
+    [self recordMessage:message];
+}
+
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNLoggerManagerTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.logger = [PNTestRecordingLogger new];
+}
+
+
+#pragma mark - Tests :: Ring buffer
+
+- (void)testItShouldReturnEntriesInOrderInWhichTheyHaveBeenAdded {
+    PNLogRingBuffer *buffer = [PNLogRingBuffer bufferWithCapacity:4];
+    PNLogEntry *entry1 = [self entryWithText:@"1"];
+    PNLogEntry *entry2 = [self entryWithText:@"2"];
+
+    XCTAssertTrue([buffer enqueueEntry:entry1]);
+    XCTAssertTrue([buffer enqueueEntry:entry2]);
+
+    XCTAssertEqual(buffer.count, 2);
+    XCTAssertEqual([buffer dequeueEntry], entry1);
+    XCTAssertEqual([buffer dequeueEntry], entry2);
+    XCTAssertNil([buffer dequeueEntry]);
+}
+
+- (void)testItShouldRejectEntryWhenBufferIsFull {
+    PNLogRingBuffer *buffer = [PNLogRingBuffer bufferWithCapacity:3];
+
+    XCTAssertEqual(buffer.capacity, 4);
+    for (NSUInteger idx = 0; idx < buffer.capacity; idx++) {
+        XCTAssertTrue([buffer enqueueEntry:[self entryWithText:@"a"]]);
+    }
+    XCTAssertFalse([buffer enqueueEntry:[self entryWithText:@"b"]]);
+
+    [buffer dequeueEntry];
+
+    XCTAssertTrue([buffer enqueueEntry:[self entryWithText:@"b"]]);
+}
+
+- (void)testItShouldNotLoseEntriesAddedFromMultipleThreads {
+    NSUInteger capacity = kPNTestLoggerEntriesCount * kPNTestLoggerThreadsCount;
+    PNLogRingBuffer *buffer = [PNLogRingBuffer bufferWithCapacity:capacity];
+    PNLogEntry *entry = [self entryWithText:@"a"];
+
+    dispatch_apply(kPNTestLoggerThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t iteration) {
+        for (NSUInteger idx = 0; idx < kPNTestLoggerEntriesCount; idx++) XCTAssertTrue([buffer enqueueEntry:entry]);
+    });
+
+    NSUInteger count = 0;
+    while ([buffer dequeueEntry]) count++;
+
+    XCTAssertEqual(count, capacity);
+}
+
+
+#pragma mark - Tests :: Delivery
+
+- (void)testItShouldPassEntriesToLoggersSynchronouslyWhenBufferDisabled {
+    PNLoggerManager *manager = [self managerWithBufferSize:0];
+
+    [manager debugWithLocation:@"test" andMessage:[self entryWithText:@"1"]];
+
+    XCTAssertEqual(self.logger.entries.count, 1);
+}
+
+- (void)testItShouldPassBufferedEntriesToLoggersInOrder {
+    PNLoggerManager *manager = [self managerWithBufferSize:16];
+
+    for (NSUInteger idx = 0; idx < 10; idx++) {
+        [manager debugWithLocation:@"test" andMessage:[self entryWithText:@(idx).stringValue]];
+    }
+    [manager flush];
+
+    XCTAssertEqualObjects([self.logger.entries valueForKey:@"message"],
+                          (@[@"0", @"1", @"2", @"3", @"4", @"5", @"6", @"7", @"8", @"9"]));
+}
+
+- (void)testItShouldComposeLazyMessageOnWriterQueue {
+    PNLoggerManager *manager = [self managerWithBufferSize:16];
+    __block NSThread *compositionThread;
+    __block NSUInteger compositionsCount = 0;
+    PNLogEntry *entry = [PNDictionaryLogEntry entryWithMessageFactory:^NSDictionary * {
+        compositionThread = NSThread.currentThread;
+        compositionsCount++;
+
+        return @{ @"a": @1 };
+    } details:nil operation:PNUnknownLogMessageOperation];
+
+    [manager debugWithLocation:@"test" andMessage:entry];
+    [manager flush];
+
+    XCTAssertEqualObjects(self.logger.entries.firstObject.message, @{ @"a": @1 });
+    XCTAssertNotEqualObjects(compositionThread, NSThread.currentThread);
+    XCTAssertEqual(compositionsCount, 1);
+}
+
+
+#pragma mark - Tests :: Overload
+
+- (void)testItShouldDropAndReportEntriesWhenLoggersCantKeepUp {
+    PNLoggerManager *manager = [self managerWithBufferSize:8];
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    self.logger.gate = gate;
+
+    for (NSUInteger idx = 0; idx < 20; idx++) {
+        [manager infoWithLocation:@"test" andMessage:[self entryWithText:@(idx).stringValue]];
+    }
+
+    XCTAssertGreaterThan(manager.droppedEntriesCount, 0);
+
+    self.logger.gate = nil;
+    dispatch_semaphore_signal(gate);
+    [manager flush];
+
+    PNLogEntry *report = self.logger.entries.lastObject;
+    XCTAssertEqual(report.logLevel, PNWarnLogLevel);
+    XCTAssertTrue([report.message containsString:@(manager.droppedEntriesCount).stringValue]);
+}
+
+- (void)testItShouldSampleDebugEntriesWhenBufferIsAlmostFull {
+    PNLoggerManager *manager = [self managerWithBufferSize:64];
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    self.logger.gate = gate;
+
+    for (NSUInteger idx = 0; idx < 64; idx++) [manager debugWithLocation:@"test" andMessage:[self entryWithText:@"a"]];
+    NSUInteger droppedDebugEntriesCount = manager.droppedEntriesCount;
+    for (NSUInteger idx = 0; idx < 8; idx++) [manager infoWithLocation:@"test" andMessage:[self entryWithText:@"b"]];
+
+    XCTAssertGreaterThan(droppedDebugEntriesCount, 0);
+    XCTAssertEqual(manager.droppedEntriesCount, droppedDebugEntriesCount);
+
+    self.logger.gate = nil;
+    dispatch_semaphore_signal(gate);
+    [manager flush];
+
+    NSPredicate *infoEntries = [NSPredicate predicateWithFormat:@"logLevel = %@", @(PNInfoLogLevel)];
+    XCTAssertEqual([self.logger.entries filteredArrayUsingPredicate:infoEntries].count, 8);
+}
+
+- (void)testItShouldPassErrorEntryToLoggersBeforeReturnAfterBufferedEntries {
+    PNLoggerManager *manager = [self managerWithBufferSize:16];
+
+    [manager debugWithLocation:@"test" andMessage:[self entryWithText:@"debug"]];
+    [manager warnWithLocation:@"test" andMessage:[self entryWithText:@"warn"]];
+    [manager errorWithLocation:@"test" andMessage:[self entryWithText:@"error"]];
+
+    XCTAssertEqualObjects([self.logger.entries valueForKey:@"message"], (@[@"debug", @"warn", @"error"]));
+}
+
+
+#pragma mark - Tests :: Benchmarks
+
+- (void)testItShouldMeasureSynchronousLogging {
+    PNLoggerManager *manager = [self managerWithBufferSize:0];
+
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestLoggerEntriesCount; idx++) {
+            [manager debugWithLocation:@"test" andMessage:[self entryWithText:@"a"]];
+        }
+    }];
+}
+
+- (void)testItShouldMeasureBufferedLogging {
+    PNLoggerManager *manager = [self managerWithBufferSize:kPNTestLoggerEntriesCount];
+
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestLoggerEntriesCount; idx++) {
+            [manager debugWithLocation:@"test" andMessage:[self entryWithText:@"a"]];
+        }
+    }];
+
+    [manager flush];
+}
+
+
+#pragma mark - Helpers
+
+- (PNLoggerManager *)managerWithBufferSize:(NSUInteger)bufferSize {
+    return [PNLoggerManager managerWithClientIdentifier:@"test"
+                                               logLevel:PNTraceLogLevel
+                                             bufferSize:bufferSize
+                                             andLoggers:@[self.logger]];
+}
+
+- (PNLogEntry *)entryWithText:(NSString *)text {
+    return [PNStringLogEntry entryWithMessage:text operation:PNUnknownLogMessageOperation];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,122 @@
+#import "PNRecordableTestCase.h"
+#import <PubNub/PNMessageDeduplicationCache.h>
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+@interface PNMessageDeduplicationCacheTest : PNRecordableTestCase
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNMessageDeduplicationCacheTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Storage
+
+- (void)testItShouldStoreNewMessage {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+
+    XCTAssertTrue([cache storeMessageWithTimetoken:17000000000000000 channel:@"test" fingerprint:1]);
+    XCTAssertEqual(cache.count, 1);
+}
+
+- (void)testItShouldDetectDuplicateMessage {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+
+    XCTAssertTrue([cache storeMessageWithTimetoken:17000000000000000 channel:@"test" fingerprint:1]);
+    XCTAssertFalse([cache storeMessageWithTimetoken:17000000000000000 channel:@"test" fingerprint:1]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:17000000000000000 channel:@"test" fingerprint:2]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:17000000000000000 channel:@"test-2" fingerprint:1]);
+    XCTAssertEqual(cache.count, 3);
+}
+
+- (void)testItShouldEvictOldestMessageWhenFull {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:3];
+
+    for (uint64_t timetoken = 1; timetoken <= 4; timetoken++) {
+        XCTAssertTrue([cache storeMessageWithTimetoken:timetoken channel:@"test" fingerprint:1]);
+    }
+
+    XCTAssertEqual(cache.count, 3);
+    XCTAssertTrue([cache storeMessageWithTimetoken:1 channel:@"test" fingerprint:1]);
+    XCTAssertFalse([cache storeMessageWithTimetoken:4 channel:@"test" fingerprint:1]);
+}
+
+- (void)testItShouldRemoveMessagesNewerThanTimetoken {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+
+    for (uint64_t timetoken = 1; timetoken <= 6; timetoken++) {
+        [cache storeMessageWithTimetoken:timetoken channel:@"test" fingerprint:1];
+    }
+
+    [cache removeMessagesNewerThan:4];
+
+    XCTAssertEqual(cache.count, 3);
+    XCTAssertFalse([cache storeMessageWithTimetoken:3 channel:@"test" fingerprint:1]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:5 channel:@"test" fingerprint:1]);
+}
+
+- (void)testItShouldRemoveMessagesNewerThanTimetokenWhenStoredOutOfOrder {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+
+    [cache storeMessageWithTimetoken:5 channel:@"test" fingerprint:1];
+    [cache storeMessageWithTimetoken:2 channel:@"test" fingerprint:1];
+    [cache storeMessageWithTimetoken:7 channel:@"test" fingerprint:1];
+    [cache storeMessageWithTimetoken:3 channel:@"test" fingerprint:1];
+
+    [cache removeMessagesNewerThan:4];
+
+    XCTAssertEqual(cache.count, 2);
+    XCTAssertFalse([cache storeMessageWithTimetoken:2 channel:@"test" fingerprint:1]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:5 channel:@"test" fingerprint:1]);
+}
+
+- (void)testItShouldKeepNewestMessagesWhenShrink {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+
+    for (uint64_t timetoken = 1; timetoken <= 10; timetoken++) {
+        [cache storeMessageWithTimetoken:timetoken channel:@"test" fingerprint:1];
+    }
+
+    [cache resizeToCapacity:4];
+
+    XCTAssertEqual(cache.capacity, 4);
+    XCTAssertEqual(cache.count, 4);
+    XCTAssertFalse([cache storeMessageWithTimetoken:10 channel:@"test" fingerprint:1]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:6 channel:@"test" fingerprint:1]);
+}
+
+- (void)testItShouldCopyStoredMessages {
+    PNMessageDeduplicationCache *cache = [PNMessageDeduplicationCache cacheWithCapacity:10];
+    [cache storeMessageWithTimetoken:1 channel:@"test" fingerprint:1];
+
+    PNMessageDeduplicationCache *copy = [cache copy];
+    [cache removeAllMessages];
+
+    XCTAssertEqual(copy.count, 1);
+    XCTAssertFalse([copy storeMessageWithTimetoken:1 channel:@"test" fingerprint:1]);
+    XCTAssertTrue([cache storeMessageWithTimetoken:1 channel:@"test" fingerprint:1]);
+}
+
+#pragma mark -
+
+
+@end
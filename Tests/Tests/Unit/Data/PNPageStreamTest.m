@@ -0,0 +1,209 @@
+#import <PubNub/PNStatus+Private.h>
+#import <PubNub/PNPageStream.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Multi-page objects stream unit tests.
+@interface PNPageStreamTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Queue on which fake pages are "received".
+@property(strong, nonatomic) dispatch_queue_t networkQueue;
+
+/// Queue on which stream calls batch and completion blocks.
+@property(strong, nonatomic) dispatch_queue_t callbackQueue;
+
+
+#pragma mark - Helpers
+
+/// Create fetch block which returns fake pages.
+///
+/// - Parameters:
+///   - pagesCount: Number of pages which should be returned by fetch block.
+///   - pageSize: Number of objects in each page.
+///   - failedPage: Index of page which should fail or `NSNotFound`.
+///   - fetches: List where indices of requested pages should be stored.
+/// - Returns: Fetch block for multi-page objects stream.
+- (PNPageStreamFetchBlock)fetchBlockWithPagesCount:(NSUInteger)pagesCount
+                                          pageSize:(NSUInteger)pageSize
+                                        failedPage:(NSUInteger)failedPage
+                                           fetches:(NSMutableArray<NSNumber *> *)fetches;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNPageStreamTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.networkQueue = dispatch_queue_create("com.pubnub.test.network", DISPATCH_QUEUE_SERIAL);
+    self.callbackQueue = dispatch_queue_create("com.pubnub.test.callback", DISPATCH_QUEUE_SERIAL);
+}
+
+
+#pragma mark - Tests :: Streaming
+
+- (void)testItShouldStreamAllPagesInOrder {
+    XCTestExpectation *completionExpectation = [self expectationWithDescription:@"Stream completed"];
+    NSMutableArray *objects = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *fetches = [NSMutableArray new];
+    __block NSUInteger batchesCount = 0;
+
+    PNPageStream *stream = [PNPageStream streamWithFetchBlock:[self fetchBlockWithPagesCount:5
+                                                                                    pageSize:10
+                                                                                  failedPage:NSNotFound
+                                                                                     fetches:fetches]
+                                                callbackQueue:self.callbackQueue
+                                                   batchBlock:^(NSArray *batch, BOOL *stop) {
+        [objects addObjectsFromArray:batch];
+        batchesCount++;
+    } completionBlock:^(NSUInteger count, PNErrorStatus *status) {
+        XCTAssertEqual(count, 50);
+        XCTAssertNil(status);
+        [completionExpectation fulfill];
+    }];
+    [stream start];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+
+    XCTAssertEqual(batchesCount, 5);
+    XCTAssertEqual(fetches.count, 5);
+    for (NSUInteger idx = 0; idx < objects.count; idx++) XCTAssertEqualObjects(objects[idx], @(idx));
+}
+
+- (void)testItShouldNotPrefetchMoreThanOnePageWhileBatchIsProcessed {
+    XCTestExpectation *completionExpectation = [self expectationWithDescription:@"Stream completed"];
+    NSMutableArray<NSNumber *> *fetches = [NSMutableArray new];
+    __block NSUInteger batchesCount = 0;
+
+    PNPageStream *stream = [PNPageStream streamWithFetchBlock:[self fetchBlockWithPagesCount:4
+                                                                                    pageSize:1
+                                                                                  failedPage:NSNotFound
+                                                                                     fetches:fetches]
+                                                callbackQueue:self.callbackQueue
+                                                   batchBlock:^(NSArray *batch, BOOL *stop) {
+        batchesCount++;
+        // Give stream time to fetch pages if it would ignore prefetch limit.
+        [NSThread sleepForTimeInterval:0.1f];
+        dispatch_sync(self.networkQueue, ^{
+            XCTAssertLessThanOrEqual(fetches.count, batchesCount + 1);
+        });
+    } completionBlock:^(NSUInteger count, PNErrorStatus *status) {
+        [completionExpectation fulfill];
+    }];
+    [stream start];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+
+    XCTAssertEqual(batchesCount, 4);
+}
+
+- (void)testItShouldStopStreamingWhenRequested {
+    XCTestExpectation *completionExpectation = [self expectationWithDescription:@"Stream completed"];
+    NSMutableArray<NSNumber *> *fetches = [NSMutableArray new];
+    __block NSUInteger batchesCount = 0;
+
+    PNPageStream *stream = [PNPageStream streamWithFetchBlock:[self fetchBlockWithPagesCount:10
+                                                                                    pageSize:10
+                                                                                  failedPage:NSNotFound
+                                                                                     fetches:fetches]
+                                                callbackQueue:self.callbackQueue
+                                                   batchBlock:^(NSArray *batch, BOOL *stop) {
+        *stop = ++batchesCount == 2;
+    } completionBlock:^(NSUInteger count, PNErrorStatus *status) {
+        XCTAssertEqual(count, 20);
+        XCTAssertNil(status);
+        [completionExpectation fulfill];
+    }];
+    [stream start];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+
+    XCTAssertEqual(batchesCount, 2);
+    XCTAssertLessThanOrEqual(fetches.count, 3);
+}
+
+- (void)testItShouldCompleteWithErrorAfterDeliveringFetchedPages {
+    XCTestExpectation *completionExpectation = [self expectationWithDescription:@"Stream completed"];
+    NSMutableArray<NSNumber *> *fetches = [NSMutableArray new];
+    __block NSUInteger batchesCount = 0;
+
+    PNPageStream *stream = [PNPageStream streamWithFetchBlock:[self fetchBlockWithPagesCount:10
+                                                                                    pageSize:10
+                                                                                  failedPage:3
+                                                                                     fetches:fetches]
+                                                callbackQueue:self.callbackQueue
+                                                   batchBlock:^(NSArray *batch, BOOL *stop) {
+        batchesCount++;
+    } completionBlock:^(NSUInteger count, PNErrorStatus *status) {
+        XCTAssertEqual(count, 30);
+        XCTAssertNotNil(status);
+        [completionExpectation fulfill];
+    }];
+    [stream start];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+
+    XCTAssertEqual(batchesCount, 3);
+}
+
+
+#pragma mark - Helpers
+
+- (PNPageStreamFetchBlock)fetchBlockWithPagesCount:(NSUInteger)pagesCount
+                                          pageSize:(NSUInteger)pageSize
+                                        failedPage:(NSUInteger)failedPage
+                                           fetches:(NSMutableArray<NSNumber *> *)fetches {
+    dispatch_queue_t queue = self.networkQueue;
+
+    return ^(PNPageStreamPageBlock pageBlock) {
+        dispatch_async(queue, ^{
+            NSUInteger idx = fetches.count;
+            [fetches addObject:@(idx)];
+
+            if (idx == failedPage) {
+                pageBlock(nil, NO, [PNErrorStatus objectWithOperation:PNFetchAllUUIDMetadataOperation
+                                                             category:PNBadRequestCategory
+                                                             response:nil]);
+                return;
+            }
+
+            NSMutableArray *objects = [NSMutableArray arrayWithCapacity:pageSize];
+            for (NSUInteger objectIdx = 0; objectIdx < pageSize; objectIdx++) {
+                [objects addObject:@(idx * pageSize + objectIdx)];
+            }
+
+            pageBlock(objects, idx + 1 < pagesCount, nil);
+        });
+    };
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,259 @@
+#import <PubNub/PubNub+CorePrivate.h>
+#import <PubNub/PNPublishQueue.h>
+#import "PNRecordableTestCase.h"
+#import <OCMock/OCMock.h>
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Client-side publish requests queue unit tests.
+@interface PNPublishQueueTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Completion blocks of publish requests which are being sent.
+@property(strong, nonatomic) NSMutableArray<dispatch_block_t> *completions;
+
+/// Identifiers of publish requests in order in which they have been sent.
+@property(strong, nonatomic) NSMutableArray<NSString *> *sentRequests;
+
+
+#pragma mark - Helpers
+
+/// Add publish request to the queue.
+///
+/// - Parameters:
+///   - identifier: Publish request identifier.
+///   - channel: Name of channel to which message will be published.
+///   - queue: Queue to which publish request should be added.
+/// - Returns: Whether publish request has been added or not.
+- (BOOL)enqueueRequest:(NSString *)identifier forChannel:(NSString *)channel toQueue:(PNPublishQueue *)queue;
+
+/// Complete oldest publish request which is being sent.
+- (void)completeOldestRequest;
+
+/// Create **PubNub** client with client-side publish queue.
+///
+/// - Parameters:
+///   - count: Maximum number of simultaneously sent publish requests.
+///   - length: Maximum number of publish requests which can be waiting or being sent.
+/// - Returns: Configured **PubNub** client.
+- (PubNub *)clientWithMaximumInFlightPublishRequests:(NSUInteger)count maximumLength:(NSUInteger)length;
+
+/// Publish message and wait for completion.
+///
+/// - Parameters:
+///   - channel: Name of channel to which message should be published.
+///   - client: **PubNub** client which should be used to publish message.
+/// - Returns: Publish request processing status.
+- (PNPublishStatus *)publishToChannel:(NSString *)channel withClient:(PubNub *)client;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNPublishQueueTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.completions = [NSMutableArray new];
+    self.sentRequests = [NSMutableArray new];
+}
+
+
+#pragma mark - Tests :: Ordering
+
+- (void)testItShouldSendNextRequestToChannelOnlyAfterPreviousCompletion {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:4 maximumLength:10];
+
+    [self enqueueRequest:@"a1" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"a2" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"b1" forChannel:@"b" toQueue:queue];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"b1"]));
+    XCTAssertEqual(queue.inFlightCount, 2);
+    XCTAssertEqual(queue.depth, 1);
+
+    [self completeOldestRequest];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"b1", @"a2"]));
+}
+
+- (void)testItShouldLimitNumberOfRequestsInFlight {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:2 maximumLength:10];
+
+    [self enqueueRequest:@"a1" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"b1" forChannel:@"b" toQueue:queue];
+    [self enqueueRequest:@"c1" forChannel:@"c" toQueue:queue];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"b1"]));
+
+    [self completeOldestRequest];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"b1", @"c1"]));
+    XCTAssertEqual(queue.inFlightCount, 2);
+    XCTAssertEqual(queue.depth, 0);
+}
+
+- (void)testItShouldSendMultipleRequestsToChannelWhenPerChannelLimitAllows {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:4 perChannel:2 maximumLength:10];
+
+    [self enqueueRequest:@"a1" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"a2" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"a3" forChannel:@"a" toQueue:queue];
+    [self enqueueRequest:@"b1" forChannel:@"b" toQueue:queue];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"a2", @"b1"]));
+    XCTAssertEqual(queue.inFlightCount, 3);
+    XCTAssertEqual(queue.depth, 1);
+
+    [self completeOldestRequest];
+
+    XCTAssertEqualObjects(self.sentRequests, (@[@"a1", @"a2", @"b1", @"a3"]));
+}
+
+- (void)testItShouldLimitRequestsPerChannelByMaximumInFlightRequests {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:2 perChannel:8 maximumLength:10];
+
+    XCTAssertEqual(queue.maximumInFlightRequestsPerChannel, 2);
+}
+
+
+#pragma mark - Tests :: Backpressure
+
+- (void)testItShouldRejectRequestWhenQueueIsFull {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:1 maximumLength:2];
+
+    XCTAssertTrue([self enqueueRequest:@"a1" forChannel:@"a" toQueue:queue]);
+    XCTAssertTrue([self enqueueRequest:@"a2" forChannel:@"a" toQueue:queue]);
+    XCTAssertFalse([self enqueueRequest:@"a3" forChannel:@"a" toQueue:queue]);
+
+    [self completeOldestRequest];
+
+    XCTAssertTrue([self enqueueRequest:@"a3" forChannel:@"a" toQueue:queue]);
+}
+
+
+#pragma mark - Tests :: Client
+
+- (void)testItShouldSendPublishRequestThroughQueue {
+    PubNub *client = [self clientWithMaximumInFlightPublishRequests:1 maximumLength:2];
+    id clientMock = OCMPartialMock(client);
+    OCMStub([clientMock performRequest:[OCMArg any] withParser:[OCMArg any] completion:[OCMArg any]]);
+
+    [client publishWithRequest:[PNPublishRequest requestWithChannel:@"a"] completion:^(PNPublishStatus *status) {}];
+    [client publishWithRequest:[PNPublishRequest requestWithChannel:@"a"] completion:^(PNPublishStatus *status) {}];
+
+    XCTAssertEqual(client.publishQueueInFlightCount, 1);
+    XCTAssertEqual(client.publishQueueDepth, 1);
+    OCMVerify(times(1), [clientMock performRequest:[OCMArg any] withParser:[OCMArg any] completion:[OCMArg any]]);
+    [clientMock stopMocking];
+}
+
+- (void)testItShouldCompleteWithQueueFullStatusWhenPublishQueueIsFull {
+    PubNub *client = [self clientWithMaximumInFlightPublishRequests:1 maximumLength:1];
+    id clientMock = OCMPartialMock(client);
+    OCMStub([clientMock performRequest:[OCMArg any] withParser:[OCMArg any] completion:[OCMArg any]]);
+
+    [client publishWithRequest:[PNPublishRequest requestWithChannel:@"a"] completion:^(PNPublishStatus *status) {}];
+    PNPublishStatus *status = [self publishToChannel:@"b" withClient:client];
+
+    XCTAssertTrue(status.isError);
+    XCTAssertEqual(status.category, PNPublishQueueFullCategory);
+    XCTAssertEqual(client.publishQueueDepth, 0);
+    [clientMock stopMocking];
+}
+
+- (void)testItShouldNotEnqueuePublishRequestWithoutChannel {
+    PubNub *client = [self clientWithMaximumInFlightPublishRequests:1 maximumLength:1];
+
+    PNPublishStatus *status = [self publishToChannel:@"" withClient:client];
+
+    XCTAssertTrue(status.isError);
+    XCTAssertNotEqual(status.category, PNPublishQueueFullCategory);
+    XCTAssertEqual(client.publishQueueInFlightCount, 0);
+    XCTAssertEqual(client.publishQueueDepth, 0);
+}
+
+
+#pragma mark - Tests :: Metrics
+
+- (void)testItShouldTrackAverageLatency {
+    PNPublishQueue *queue = [PNPublishQueue queueWithMaximumInFlightRequests:1 maximumLength:2];
+
+    XCTAssertEqual(queue.averageLatency, 0.f);
+
+    [self enqueueRequest:@"a1" forChannel:@"a" toQueue:queue];
+    [NSThread sleepForTimeInterval:0.05f];
+    [self completeOldestRequest];
+
+    XCTAssertGreaterThanOrEqual(queue.averageLatency, 0.05f);
+}
+
+
+#pragma mark - Helpers
+
+- (BOOL)enqueueRequest:(NSString *)identifier forChannel:(NSString *)channel toQueue:(PNPublishQueue *)queue {
+    return [queue enqueueForChannel:channel withBlock:^(dispatch_block_t completion) {
+        [self.sentRequests addObject:identifier];
+        [self.completions addObject:completion];
+    }];
+}
+
+- (void)completeOldestRequest {
+    dispatch_block_t completion = self.completions.firstObject;
+    [self.completions removeObjectAtIndex:0];
+
+    completion();
+}
+
+- (PubNub *)clientWithMaximumInFlightPublishRequests:(NSUInteger)count maximumLength:(NSUInteger)length {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"
+                                                                           userID:@"uuid"];
+    dispatch_queue_t callbackQueue = dispatch_queue_create("com.pubnub.test.publish-queue", DISPATCH_QUEUE_SERIAL);
+    configuration.maximumInFlightPublishRequests = count;
+    configuration.maximumPublishQueueLength = length;
+
+    return [PubNub clientWithConfiguration:configuration callbackQueue:callbackQueue];
+}
+
+- (PNPublishStatus *)publishToChannel:(NSString *)channel withClient:(PubNub *)client {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Publish completion"];
+    __block PNPublishStatus *publishStatus;
+
+    [client publishWithRequest:[PNPublishRequest requestWithChannel:channel] completion:^(PNPublishStatus *status) {
+        publishStatus = status;
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectations:@[expectation] timeout:5.f];
+
+    return publishStatus;
+}
+
+#pragma mark -
+
+
+@end
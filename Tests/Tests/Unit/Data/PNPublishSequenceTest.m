@@ -0,0 +1,143 @@
+#import <PubNub/PNPublishSequence.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Constants
+
+/// Number of threads which concurrently request sequence numbers.
+static NSUInteger const kPNTestPublishThreadsCount = 8;
+
+/// Number of sequence numbers requested by each thread.
+static NSUInteger const kPNTestPublishesPerThread = 20000;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// Published messages sequence manager unit tests.
+@interface PNPublishSequenceTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create sequence manager for client with unique publish key.
+///
+/// - Returns: Sequence manager which is not shared with other tests.
+- (PNPublishSequence *)sequence;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNPublishSequenceTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Sequence number
+
+- (void)testItShouldIncrementSequenceNumberWhenRequested {
+    PNPublishSequence *sequence = [self sequence];
+
+    XCTAssertEqual([sequence nextSequenceNumber:YES], 1);
+    XCTAssertEqual([sequence nextSequenceNumber:YES], 2);
+    XCTAssertEqual(sequence.sequenceNumber, 2);
+}
+
+- (void)testItShouldNotChangeSequenceNumberWhenNotRequested {
+    PNPublishSequence *sequence = [self sequence];
+    [sequence nextSequenceNumber:YES];
+
+    XCTAssertEqual([sequence nextSequenceNumber:NO], 2);
+    XCTAssertEqual([sequence nextSequenceNumber:NO], 2);
+    XCTAssertEqual(sequence.sequenceNumber, 1);
+}
+
+- (void)testItShouldResetSequenceNumber {
+    PNPublishSequence *sequence = [self sequence];
+    [sequence nextSequenceNumber:YES];
+    [sequence nextSequenceNumber:YES];
+
+    [sequence reset];
+
+    XCTAssertEqual(sequence.sequenceNumber, 0);
+    XCTAssertEqual([sequence nextSequenceNumber:YES], 1);
+}
+
+- (void)testItShouldReuseSequenceManagerForSamePublishKey {
+    NSString *publishKey = [NSUUID UUID].UUIDString;
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:publishKey
+                                                                     subscribeKey:@"demo"
+                                                                           userID:@"tester"];
+
+    PNPublishSequence *sequence1 = [PNPublishSequence sequenceForClient:[PubNub clientWithConfiguration:configuration]];
+    PNPublishSequence *sequence2 = [PNPublishSequence sequenceForClient:[PubNub clientWithConfiguration:configuration]];
+
+    XCTAssertEqual(sequence1, sequence2);
+}
+
+
+#pragma mark - Tests :: Contention
+
+- (void)testItShouldProvideUniqueSequenceNumbersForConcurrentPublish {
+    NSUInteger count = kPNTestPublishThreadsCount * kPNTestPublishesPerThread;
+    NSMutableData *numbersData = [NSMutableData dataWithLength:count * sizeof(NSUInteger)];
+    NSUInteger *numbers = numbersData.mutableBytes;
+    PNPublishSequence *sequence = [self sequence];
+
+    dispatch_apply(kPNTestPublishThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t thread) {
+        for (NSUInteger idx = 0; idx < kPNTestPublishesPerThread; idx++) {
+            numbers[thread * kPNTestPublishesPerThread + idx] = [sequence nextSequenceNumber:YES];
+        }
+    });
+
+    NSMutableIndexSet *uniqueNumbers = [NSMutableIndexSet new];
+    for (NSUInteger idx = 0; idx < count; idx++) [uniqueNumbers addIndex:numbers[idx]];
+
+    XCTAssertEqual(uniqueNumbers.count, count);
+    XCTAssertEqual(uniqueNumbers.firstIndex, 1);
+    XCTAssertEqual(uniqueNumbers.lastIndex, count);
+    XCTAssertEqual(sequence.sequenceNumber, count);
+}
+
+- (void)testItShouldMeasureSequenceNumberContention {
+    PNPublishSequence *sequence = [self sequence];
+
+    [self measureBlock:^{
+        dispatch_apply(kPNTestPublishThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t __unused thread) {
+            for (NSUInteger idx = 0; idx < kPNTestPublishesPerThread; idx++) {
+                [sequence nextSequenceNumber:YES];
+                [sequence nextSequenceNumber:NO];
+            }
+        });
+    }];
+}
+
+
+#pragma mark - Helpers
+
+- (PNPublishSequence *)sequence {
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:[NSUUID UUID].UUIDString
+                                                                     subscribeKey:@"demo"
+                                                                           userID:@"tester"];
+
+    return [PNPublishSequence sequenceForClient:[PubNub clientWithConfiguration:configuration]];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,275 @@
+#import <PubNub/PNOperationResult+Private.h>
+#import <PubNub/PubNub+CorePrivate.h>
+#import <PubNub/PNStateListener.h>
+#import <PubNub/PNSubscribeData.h>
+#import <PubNub/PNJSONDecoder.h>
+#import <PubNub/PubNub.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Real-time updates listener which store names of channels from which messages has been received.
+@interface PNStateListenerTestObserver : NSObject <PNEventsListener>
+
+
+#pragma mark - Properties
+
+/// Names of channels from which messages has been received.
+@property(strong, nonatomic) NSMutableArray<NSString *> *channels;
+
+#pragma mark -
+
+
+@end
+
+
+/// Real-time updates listener which store batches of received messages.
+@interface PNStateListenerTestBatchObserver : NSObject <PNEventsListener>
+
+
+#pragma mark - Properties
+
+/// Names of channels from received messages batches.
+@property(strong, nonatomic) NSMutableArray<NSArray<NSString *> *> *batches;
+
+/// Number of single message callback calls.
+@property(assign, nonatomic) NSUInteger singleMessagesCount;
+
+#pragma mark -
+
+
+@end
+
+
+/// Listeners manager unit tests.
+@interface PNStateListenerTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Deliver messages through listeners manager.
+///
+/// - Parameters:
+///   - messages: List of `channel` / `subscription` pairs for which messages should be created.
+///   - manager: Listeners manager which should deliver messages.
+///   - client: Client which is used by listeners manager.
+- (void)deliverMessages:(NSArray<NSArray<NSString *> *> *)messages
+            withManager:(PNStateListener *)manager
+              forClient:(PubNub *)client;
+
+/// Deliver messages through listeners manager.
+///
+/// - Parameters:
+///   - messages: List of `channel` / `subscription` pairs for which messages should be created.
+///   - manager: Listeners manager which should deliver messages.
+///   - client: Client which is used by listeners manager.
+///   - batched: Whether messages should be delivered as events from single subscribe response or not.
+- (void)deliverMessages:(NSArray<NSArray<NSString *> *> *)messages
+            withManager:(PNStateListener *)manager
+              forClient:(PubNub *)client
+                batched:(BOOL)batched;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNStateListenerTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Routing
+
+- (void)testItShouldRouteMessagesToInterestedListeners {
+    dispatch_queue_t callbackQueue = dispatch_queue_create("com.pubnub.test.listener", DISPATCH_QUEUE_SERIAL);
+    PubNub *client = [PubNub clientWithConfiguration:[self defaultConfiguration] callbackQueue:callbackQueue];
+    PNStateListener *manager = [PNStateListener stateListenerForClient:client];
+    PNStateListenerTestObserver *broadcast = [PNStateListenerTestObserver new];
+    PNStateListenerTestObserver *channel = [PNStateListenerTestObserver new];
+    PNStateListenerTestObserver *group = [PNStateListenerTestObserver new];
+    PNStateListenerTestObserver *wildcard = [PNStateListenerTestObserver new];
+
+    [manager addListener:broadcast];
+    [manager addListener:channel forChannels:@[@"chat"] channelGroups:nil];
+    [manager addListener:group forChannels:nil channelGroups:@[@"friends"]];
+    [manager addListener:wildcard forChannels:@[@"news.*", @"chat"] channelGroups:nil];
+
+    NSArray *messages = @[
+        @[@"chat", @"chat"], @[@"news.sports", @"news.*"], @[@"bob", @"friends"], @[@"misc", @"misc"]
+    ];
+    [self deliverMessages:messages withManager:manager forClient:client];
+
+    XCTAssertEqualObjects(broadcast.channels, (@[@"chat", @"news.sports", @"bob", @"misc"]));
+    XCTAssertEqualObjects(channel.channels, @[@"chat"]);
+    XCTAssertEqualObjects(group.channels, @[@"bob"]);
+    XCTAssertEqualObjects(wildcard.channels, (@[@"chat", @"news.sports"]));
+}
+
+- (void)testItShouldNotRouteMessagesToRemovedListener {
+    dispatch_queue_t callbackQueue = dispatch_queue_create("com.pubnub.test.listener", DISPATCH_QUEUE_SERIAL);
+    PubNub *client = [PubNub clientWithConfiguration:[self defaultConfiguration] callbackQueue:callbackQueue];
+    PNStateListener *manager = [PNStateListener stateListenerForClient:client];
+    PNStateListenerTestObserver *listener = [PNStateListenerTestObserver new];
+
+    [manager addListener:listener forChannels:@[@"chat"] channelGroups:@[@"friends"]];
+    [manager removeListener:listener];
+
+    [self deliverMessages:@[@[@"chat", @"chat"], @[@"bob", @"friends"]] withManager:manager forClient:client];
+
+    XCTAssertEqual(listener.channels.count, 0);
+}
+
+
+#pragma mark - Tests :: Batching
+
+- (void)testItShouldDeliverMessagesFromSubscribeResponseWithSingleBatch {
+    dispatch_queue_t callbackQueue = dispatch_queue_create("com.pubnub.test.listener", DISPATCH_QUEUE_SERIAL);
+    PubNub *client = [PubNub clientWithConfiguration:[self defaultConfiguration] callbackQueue:callbackQueue];
+    PNStateListener *manager = [PNStateListener stateListenerForClient:client];
+    PNStateListenerTestBatchObserver *batch = [PNStateListenerTestBatchObserver new];
+    PNStateListenerTestBatchObserver *routed = [PNStateListenerTestBatchObserver new];
+    PNStateListenerTestObserver *single = [PNStateListenerTestObserver new];
+
+    [manager addListener:batch];
+    [manager addListener:single];
+    [manager addListener:routed forChannels:@[@"chat"] channelGroups:nil];
+
+    NSArray *messages = @[@[@"chat", @"chat"], @[@"news", @"news"], @[@"chat", @"chat"]];
+    [self deliverMessages:messages withManager:manager forClient:client batched:YES];
+
+    XCTAssertEqualObjects(batch.batches, (@[@[@"chat", @"news", @"chat"]]));
+    XCTAssertEqualObjects(routed.batches, (@[@[@"chat", @"chat"]]));
+    XCTAssertEqualObjects(single.channels, (@[@"chat", @"news", @"chat"]));
+    XCTAssertEqual(batch.singleMessagesCount, 0);
+}
+
+- (void)testItShouldDeliverMessageOutsideOfBatchAsSingleElementBatch {
+    dispatch_queue_t callbackQueue = dispatch_queue_create("com.pubnub.test.listener", DISPATCH_QUEUE_SERIAL);
+    PubNub *client = [PubNub clientWithConfiguration:[self defaultConfiguration] callbackQueue:callbackQueue];
+    PNStateListener *manager = [PNStateListener stateListenerForClient:client];
+    PNStateListenerTestBatchObserver *batch = [PNStateListenerTestBatchObserver new];
+
+    [manager addListener:batch];
+    [self deliverMessages:@[@[@"chat", @"chat"], @[@"news", @"news"]] withManager:manager forClient:client batched:NO];
+
+    XCTAssertEqualObjects(batch.batches, (@[@[@"chat"], @[@"news"]]));
+}
+
+
+#pragma mark - Helpers
+
+- (void)deliverMessages:(NSArray<NSArray<NSString *> *> *)messages
+            withManager:(PNStateListener *)manager
+              forClient:(PubNub *)client {
+    [self deliverMessages:messages withManager:manager forClient:client batched:NO];
+}
+
+- (void)deliverMessages:(NSArray<NSArray<NSString *> *> *)messages
+            withManager:(PNStateListener *)manager
+              forClient:(PubNub *)client
+                batched:(BOOL)batched {
+    XCTestExpectation *deliveryExpectation = [self expectationWithDescription:@"Messages delivered"];
+    NSMutableArray *updates = [NSMutableArray new];
+
+    for (NSArray<NSString *> *message in messages) {
+        [updates addObject:@{
+            @"a": @"3",
+            @"f": @0,
+            @"p": @{ @"t": @"17000000000000000", @"r": @1 },
+            @"c": message[0],
+            @"b": message[1],
+            @"d": @{ @"text": @"hello" }
+        }];
+    }
+
+    NSDictionary *response = @{ @"t": @{ @"t": @"17000000000000001", @"r": @1 }, @"m": updates };
+    PNSubscribeData *data = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                 fromDictionary:response
+                                                      withError:nil];
+
+    [manager notifyWithBlock:^{
+        if (batched) [manager beginEventsBatch];
+
+        for (PNSubscribeEventData *update in data.updates) {
+            [manager notifyMessage:[PNMessageResult objectWithOperation:PNSubscribeOperation response:update]];
+        }
+
+        if (batched) [manager flushEventsBatch];
+
+        dispatch_async(client.callbackQueue, ^{
+            [deliveryExpectation fulfill];
+        });
+    }];
+
+    [self waitForExpectationsWithTimeout:5.f handler:nil];
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation PNStateListenerTestObserver
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+    if ((self = [super init])) _channels = [NSMutableArray new];
+    return self;
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)__unused client didReceiveMessage:(PNMessageResult *)message {
+    [self.channels addObject:message.data.channel];
+}
+
+#pragma mark -
+
+
+@end
+
+
+@implementation PNStateListenerTestBatchObserver
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+    if ((self = [super init])) _batches = [NSMutableArray new];
+    return self;
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)__unused client didReceiveMessage:(PNMessageResult *)__unused message {
+    self.singleMessagesCount++;
+}
+
+- (void)client:(PubNub *)__unused client didReceiveMessages:(NSArray<PNMessageResult *> *)messages {
+    [self.batches addObject:[messages valueForKeyPath:@"data.channel"]];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,186 @@
+#import <PubNub/PNDate.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Constants
+
+/// Number of conversions performed in benchmarks.
+static NSUInteger const kPNTestDateConversionsCount = 100000;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// Date codec unit tests and benchmarks against system formatters.
+@interface PNDateTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create date formatter configured for service date strings.
+///
+/// - Parameter format: Date format which should be used by formatter.
+/// - Returns: Configured date formatter.
+- (NSDateFormatter *)formatterWithFormat:(NSString *)format;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNDateTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: ISO8601 parsing
+
+- (void)testItShouldParseDateSameWayAsFormatter {
+    NSDateFormatter *formatter = [self formatterWithFormat:@"yyyy-MM-dd'T'HH:mm:ss.SSS'Z'"];
+    NSArray<NSString *> *dates = @[
+        @"2024-02-29T12:34:56.789Z", @"1970-01-01T00:00:00.000Z", @"2099-12-31T23:59:59.999Z"
+    ];
+
+    for (NSString *date in dates) {
+        XCTAssertEqualWithAccuracy([PNDate dateFromISO8601String:date].timeIntervalSince1970,
+                                   [formatter dateFromString:date].timeIntervalSince1970, 0.0001f);
+    }
+}
+
+- (void)testItShouldParseDateWithoutMilliseconds {
+    NSDateFormatter *formatter = [self formatterWithFormat:@"yyyy-MM-dd'T'HH:mm:ss'Z'"];
+    NSString *date = @"2020-07-22T19:19:11Z";
+
+    XCTAssertEqualObjects([PNDate dateFromISO8601String:date], [formatter dateFromString:date]);
+}
+
+- (void)testItShouldParseDateWithTimeZoneOffset {
+    NSDate *expected = [PNDate dateFromISO8601String:@"2024-01-01T00:00:00Z"];
+
+    XCTAssertEqualObjects([PNDate dateFromISO8601String:@"2024-01-01T01:30:00+01:30"], expected);
+    XCTAssertEqualObjects([PNDate dateFromISO8601String:@"2023-12-31T22:00:00-0200"], expected);
+}
+
+- (void)testItShouldNotParseMalformedDate {
+    NSArray<NSString *> *dates = @[
+        @"", @"2024-01-01", @"2024-01-01T00:00:00", @"2024-01-01T00:00:00.Z", @"2023-02-29T00:00:00Z",
+        @"2024-13-01T00:00:00Z", @"2024-01-01T24:00:00Z", @"2024-01-01T00:00:00Zx", @"2024-01-01T00:00:00+1:00",
+        @"2024-01-01Т00:00:00Z"
+    ];
+
+    for (NSString *date in dates) XCTAssertNil([PNDate dateFromISO8601String:date], @"'%@' parsed", date);
+}
+
+
+#pragma mark - Tests :: ISO8601 formatting
+
+- (void)testItShouldFormatDateSameWayAsFormatter {
+    NSDateFormatter *formatter = [self formatterWithFormat:@"yyyy-MM-dd'T'HH:mm:ss.SSS'Z'"];
+    NSArray<NSNumber *> *intervals = @[@0, @1709210096.789, @-0.5, @4102444799.999];
+
+    for (NSNumber *interval in intervals) {
+        NSDate *date = [NSDate dateWithTimeIntervalSince1970:interval.doubleValue];
+
+        XCTAssertEqualObjects([PNDate ISO8601StringFromDate:date withMilliseconds:YES],
+                              [formatter stringFromDate:date]);
+    }
+}
+
+- (void)testItShouldFormatDateWithoutMilliseconds {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1595445551.5];
+
+    XCTAssertEqualObjects([PNDate ISO8601StringFromDate:date withMilliseconds:NO], @"2020-07-22T19:19:11Z");
+    XCTAssertEqualObjects([PNDate RFC3339StringFromDate:date], @"2020-07-22T19:19:11Z");
+}
+
+
+#pragma mark - Tests :: Timetoken
+
+- (void)testItShouldConvertTimetokenToDate {
+    NSDate *date = [PNDate dateFromTimetoken:17092100967890000];
+
+    XCTAssertEqualObjects([PNDate ISO8601StringFromDate:date withMilliseconds:YES], @"2024-02-29T12:34:56.789Z");
+    XCTAssertEqualObjects([PNDate dateFromTimetokenString:@"17092100967890000"], date);
+}
+
+- (void)testItShouldConvertDateToTimetoken {
+    NSDate *date = [PNDate dateFromISO8601String:@"2024-02-29T12:34:56.789Z"];
+
+    XCTAssertEqual([PNDate timetokenFromDate:date], 17092100967890000);
+}
+
+- (void)testItShouldNotParseMalformedTimetoken {
+    NSArray<NSString *> *timetokens = @[@"", @"1709210096789000", @"170921009678900000", @"1709210096789000a"];
+
+    for (NSString *timetoken in timetokens) XCTAssertNil([PNDate dateFromTimetokenString:timetoken]);
+}
+
+
+#pragma mark - Tests :: Benchmarks
+
+- (void)testItShouldMeasureFormatterParsing {
+    NSDateFormatter *formatter = [self formatterWithFormat:@"yyyy-MM-dd'T'HH:mm:ss.SSS'Z'"];
+
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestDateConversionsCount; idx++) {
+            [formatter dateFromString:@"2024-02-29T12:34:56.789Z"];
+        }
+    }];
+}
+
+- (void)testItShouldMeasureCodecParsing {
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestDateConversionsCount; idx++) {
+            [PNDate dateFromISO8601String:@"2024-02-29T12:34:56.789Z"];
+        }
+    }];
+}
+
+- (void)testItShouldMeasureFormatterFormatting {
+    NSISO8601DateFormatter *formatter = [NSISO8601DateFormatter new];
+    formatter.formatOptions = NSISO8601DateFormatWithInternetDateTime|NSISO8601DateFormatWithFractionalSeconds;
+    NSDate *date = [NSDate date];
+
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestDateConversionsCount; idx++) [formatter stringFromDate:date];
+    }];
+}
+
+- (void)testItShouldMeasureCodecFormatting {
+    NSDate *date = [NSDate date];
+
+    [self measureBlock:^{
+        for (NSUInteger idx = 0; idx < kPNTestDateConversionsCount; idx++) {
+            [PNDate ISO8601StringFromDate:date withMilliseconds:YES];
+        }
+    }];
+}
+
+
+#pragma mark - Helpers
+
+- (NSDateFormatter *)formatterWithFormat:(NSString *)format {
+    NSDateFormatter *formatter = [NSDateFormatter new];
+    formatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    formatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+    formatter.dateFormat = format;
+
+    return formatter;
+}
+
+#pragma mark -
+
+
+@end
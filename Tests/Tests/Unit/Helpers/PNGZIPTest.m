@@ -0,0 +1,156 @@
+#import <PubNub/PNGZIP.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+#import <zlib.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// GZIP helper unit tests.
+@interface PNGZIPTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create compressible data with specified length.
+///
+/// - Parameter length: Length of data which should be created.
+/// - Returns: Data with repeated JSON-like content.
+- (NSData *)compressibleDataWithLength:(NSUInteger)length;
+
+/// Read whole stream content.
+///
+/// - Parameters:
+///   - stream: Stream from which data should be read.
+///   - bufferLength: Length of buffer which should be used for each `read` call.
+/// - Returns: Data which has been read from `stream`.
+- (NSData *)dataFromStream:(NSInputStream *)stream withBufferLength:(NSUInteger)bufferLength;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNGZIPTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Compression
+
+- (void)testItShouldCompressAndDecompressData {
+    for (NSNumber *length in @[@1, @100, @(64 * 1024), @(3 * 1024 * 1024 + 5)]) {
+        NSData *data = [self compressibleDataWithLength:length.unsignedIntegerValue];
+        NSData *compressed = [PNGZIP GZIPDeflatedData:data];
+
+        XCTAssertNotNil(compressed);
+        XCTAssertTrue([PNGZIP isCompressedData:compressed]);
+        XCTAssertEqualObjects([PNGZIP GZIPInflatedData:compressed], data, @"Length: %@", length);
+    }
+}
+
+- (void)testItShouldCompressWithProvidedLevelAndStrategy {
+    NSData *data = [self compressibleDataWithLength:256 * 1024];
+    NSData *stored = [PNGZIP GZIPDeflatedData:data level:0 strategy:PNGZIPDefaultStrategy];
+    NSData *best = [PNGZIP GZIPDeflatedData:data level:9 strategy:PNGZIPFilteredStrategy];
+    NSData *rle = [PNGZIP GZIPDeflatedData:data level:PNGZIPDefaultCompressionLevel strategy:PNGZIPRLEStrategy];
+
+    XCTAssertGreaterThan(stored.length, data.length);
+    XCTAssertLessThan(best.length, stored.length);
+    XCTAssertEqualObjects([PNGZIP GZIPInflatedData:stored], data);
+    XCTAssertEqualObjects([PNGZIP GZIPInflatedData:best], data);
+    XCTAssertEqualObjects([PNGZIP GZIPInflatedData:rle], data);
+}
+
+- (void)testItShouldNotCompressEmptyData {
+    XCTAssertNil([PNGZIP GZIPDeflatedData:[NSData new]]);
+}
+
+- (void)testItShouldCompressStream {
+    NSData *data = [self compressibleDataWithLength:1024 * 1024 + 17];
+
+    for (NSNumber *bufferLength in @[@7, @(32 * 1024), @(2 * 1024 * 1024)]) {
+        NSInputStream *stream = [PNGZIP GZIPDeflatedInputStream:[NSInputStream inputStreamWithData:data]
+                                                          level:PNGZIPDefaultCompressionLevel
+                                                       strategy:PNGZIPDefaultStrategy];
+        NSData *compressed = [self dataFromStream:stream withBufferLength:bufferLength.unsignedIntegerValue];
+
+        XCTAssertLessThan(compressed.length, data.length);
+        XCTAssertEqualObjects([PNGZIP GZIPInflatedData:compressed], data, @"Buffer: %@", bufferLength);
+    }
+}
+
+
+#pragma mark - Tests :: Decompression
+
+- (void)testItShouldDecompressZlibData {
+    NSData *data = [self compressibleDataWithLength:10 * 1024];
+    NSMutableData *compressed = [NSMutableData dataWithLength:compressBound(data.length)];
+    uLongf compressedLength = compressed.length;
+
+    XCTAssertEqual(compress(compressed.mutableBytes, &compressedLength, data.bytes, data.length), Z_OK);
+    compressed.length = compressedLength;
+
+    XCTAssertTrue([PNGZIP isCompressedData:compressed]);
+    XCTAssertEqualObjects([PNGZIP GZIPInflatedData:compressed], data);
+}
+
+- (void)testItShouldNotDecompressTruncatedOrPlainData {
+    NSData *data = [self compressibleDataWithLength:10 * 1024];
+    NSData *compressed = [PNGZIP GZIPDeflatedData:data];
+
+    XCTAssertNil([PNGZIP GZIPInflatedData:[compressed subdataWithRange:NSMakeRange(0, compressed.length / 2)]]);
+    XCTAssertFalse([PNGZIP isCompressedData:data]);
+    XCTAssertNil([PNGZIP GZIPInflatedData:data]);
+}
+
+
+#pragma mark - Helpers
+
+- (NSData *)compressibleDataWithLength:(NSUInteger)length {
+    NSData *pattern = [@"{\"message\":\"hello\",\"channel\":\"test\"}," dataUsingEncoding:NSUTF8StringEncoding];
+    NSMutableData *data = [NSMutableData dataWithCapacity:length];
+    NSUInteger idx = 0;
+
+    while (data.length < length) {
+        [data appendData:pattern];
+        [data appendBytes:&idx length:MIN(sizeof(idx), length - data.length)];
+        idx++;
+    }
+    data.length = length;
+
+    return data;
+}
+
+- (NSData *)dataFromStream:(NSInputStream *)stream withBufferLength:(NSUInteger)bufferLength {
+    NSMutableData *buffer = [NSMutableData dataWithLength:bufferLength];
+    NSMutableData *data = [NSMutableData new];
+    NSInteger bytesRead = 0;
+
+    [stream open];
+    while ((bytesRead = [stream read:buffer.mutableBytes maxLength:bufferLength]) > 0) {
+        [data appendBytes:buffer.bytes length:(NSUInteger)bytesRead];
+    }
+    [stream close];
+
+    XCTAssertEqual(bytesRead, 0);
+
+    return data;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,153 @@
+#import <PubNub/NSInputStream+PNURL.h>
+#import <PubNub/PNCryptoModule.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Input stream to file writer unit tests.
+@interface PNInputStreamURLTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Temporary files which should be removed after test.
+@property(strong, nonatomic) NSMutableArray<NSURL *> *files;
+
+
+#pragma mark - Helpers
+
+/// Create data filled with random bytes.
+///
+/// - Parameter length: Length of data which should be created.
+/// - Returns: Data with random bytes.
+- (NSData *)randomDataWithLength:(NSUInteger)length;
+
+/// Create URL for temporary file.
+///
+/// - Returns: URL which can be used to store file in temporary directory.
+- (NSURL *)temporaryFileURL;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNInputStreamURLTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.files = [NSMutableArray new];
+}
+
+- (void)tearDown {
+    for (NSURL *url in self.files) [NSFileManager.defaultManager removeItemAtURL:url error:nil];
+
+    [super tearDown];
+}
+
+
+#pragma mark - Tests :: Write
+
+- (void)testItShouldWriteStreamContentToFile {
+    NSData *data = [self randomDataWithLength:3 * 1024 * 1024 + 5];
+
+    for (NSNumber *bufferSize in @[@7, @(16 * 1024), @(4 * 1024 * 1024)]) {
+        NSInputStream *stream = [NSInputStream inputStreamWithData:data];
+        NSURL *url = [self temporaryFileURL];
+        NSError *error = nil;
+
+        [stream pn_writeToFileAtURL:url withBufferSize:bufferSize.unsignedIntegerValue error:&error];
+
+        XCTAssertNil(error);
+        XCTAssertEqual(stream.streamStatus, NSStreamStatusClosed);
+        XCTAssertEqualObjects([NSData dataWithContentsOfURL:url], data, @"Buffer: %@", bufferSize);
+    }
+}
+
+- (void)testItShouldWriteEmptyStreamToFile {
+    NSURL *url = [self temporaryFileURL];
+    NSError *error = nil;
+
+    [[NSInputStream inputStreamWithData:[NSData new]] pn_writeToFileAtURL:url withBufferSize:1024 error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertEqual([NSData dataWithContentsOfURL:url].length, 0);
+}
+
+- (void)testItShouldReportErrorWhenFileCantBeWritten {
+    NSURL *url = [[self temporaryFileURL] URLByAppendingPathComponent:@"missing-directory/file"];
+    NSError *error = nil;
+
+    [[NSInputStream inputStreamWithData:[self randomDataWithLength:1024]] pn_writeToFileAtURL:url
+                                                                                withBufferSize:128
+                                                                                         error:&error];
+
+    XCTAssertNotNil(error);
+}
+
+- (void)testItShouldDecryptFileWhileWritingIt {
+    PNCryptoModule *cryptoModule = [PNCryptoModule AESCBCCryptoModuleWithCipherKey:@"enigma"
+                                                        randomInitializationVector:YES];
+    NSData *data = [self randomDataWithLength:2 * 1024 * 1024 + 13];
+    NSURL *encryptedURL = [self temporaryFileURL];
+    NSURL *decryptedURL = [self temporaryFileURL];
+    NSError *error = nil;
+
+    NSInputStream *encryptedStream = [cryptoModule encryptStream:[NSInputStream inputStreamWithData:data]
+                                                      dataLength:data.length].data;
+    [encryptedStream pn_writeToFileAtURL:encryptedURL withBufferSize:32 * 1024 error:&error];
+    XCTAssertNil(error);
+
+    NSDictionary *attributes = [NSFileManager.defaultManager attributesOfItemAtPath:encryptedURL.path error:nil];
+    NSUInteger encryptedLength = ((NSNumber *)attributes[NSFileSize]).unsignedIntegerValue;
+    NSInputStream *sourceStream = [NSInputStream inputStreamWithURL:encryptedURL];
+    PNResult<NSInputStream *> *decryptResult = [cryptoModule decryptStream:sourceStream dataLength:encryptedLength];
+    XCTAssertFalse(decryptResult.isError);
+
+    [decryptResult.data pn_writeToFileAtURL:decryptedURL withBufferSize:256 * 1024 error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:decryptedURL], data);
+}
+
+
+#pragma mark - Helpers
+
+- (NSData *)randomDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    arc4random_buf(data.mutableBytes, length);
+
+    return data;
+}
+
+- (NSURL *)temporaryFileURL {
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+    [self.files addObject:url];
+
+    return url;
+}
+
+#pragma mark -
+
+
+@end
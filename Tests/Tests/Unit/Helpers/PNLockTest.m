@@ -0,0 +1,218 @@
+#import <PubNub/PNLock.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+#pragma mark Constants
+
+/// Number of lock accesses performed by each thread in benchmarks.
+static NSUInteger const kPNTestLockAccessesCount = 100000;
+
+/// Number of threads which concurrently access lock in contended benchmarks.
+static NSUInteger const kPNTestLockThreadsCount = 8;
+
+/// Number of `read` accesses for each `write` access in contended benchmarks.
+static NSUInteger const kPNTestLockReadsPerWrite = 10;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Interface declaration
+
+/// Shared resources lock unit tests and backends benchmarks.
+@interface PNLockTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create lock with specified backend.
+///
+/// - Parameter backend: Primitive which should be used by lock.
+/// - Returns: Lock for tests.
+- (PNLock *)lockWithBackend:(PNLockBackend)backend;
+
+/// Measure single thread `read` and `write` access latency.
+///
+/// - Parameter backend: Primitive which should be used by lock.
+- (void)measureUncontendedAccessWithBackend:(PNLockBackend)backend;
+
+/// Measure `read` and `write` access latency from multiple threads.
+///
+/// - Parameter backend: Primitive which should be used by lock.
+- (void)measureContendedAccessWithBackend:(PNLockBackend)backend;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNLockTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Access
+
+- (void)testItShouldSerializeWriteAccess {
+    for (NSNumber *backend in @[@(PNLockGCDBackend), @(PNLockUnfairBackend), @(PNLockReadWriteBackend)]) {
+        PNLock *lock = [self lockWithBackend:backend.unsignedIntegerValue];
+        __block NSUInteger counter = 0;
+
+        dispatch_apply(kPNTestLockThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t __unused thread) {
+            for (NSUInteger idx = 0; idx < 1000; idx++) {
+                [lock syncWriteAccessWithBlock:^{ counter++; }];
+            }
+        });
+
+        XCTAssertEqual(counter, kPNTestLockThreadsCount * 1000, @"Backend: %@", backend);
+    }
+}
+
+- (void)testItShouldReadValueStoredWithAsynchronousWrite {
+    for (NSNumber *backend in @[@(PNLockGCDBackend), @(PNLockUnfairBackend), @(PNLockReadWriteBackend)]) {
+        PNLock *lock = [self lockWithBackend:backend.unsignedIntegerValue];
+        __block NSUInteger value = 0;
+        __block NSUInteger readValue = 0;
+
+        [lock writeAccessWithBlock:^{ value = 10; }];
+        [lock readAccessWithBlock:^{ readValue = value; }];
+
+        XCTAssertEqual(readValue, 10, @"Backend: %@", backend);
+    }
+}
+
+- (void)testItShouldNotBlockCallerOnAsynchronousWrite {
+    for (NSNumber *backend in @[@(PNLockGCDBackend), @(PNLockUnfairBackend), @(PNLockReadWriteBackend)]) {
+        PNLock *lock = [self lockWithBackend:backend.unsignedIntegerValue];
+        dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+        __block BOOL written = NO;
+        __block BOOL readValue = NO;
+
+        [lock writeAccessWithBlock:^{ dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER); }];
+        [lock writeAccessWithBlock:^{ written = YES; }];
+        dispatch_semaphore_signal(gate);
+        [lock readAccessWithBlock:^{ readValue = written; }];
+
+        XCTAssertTrue(readValue, @"Backend: %@", backend);
+    }
+}
+
+- (void)testItShouldQueueNestedAsynchronousWrite {
+    for (NSNumber *backend in @[@(PNLockGCDBackend), @(PNLockUnfairBackend), @(PNLockReadWriteBackend)]) {
+        XCTestExpectation *expectation = [self expectationWithDescription:backend.stringValue];
+        PNLock *lock = [self lockWithBackend:backend.unsignedIntegerValue];
+        __block NSMutableArray<NSNumber *> *order = [NSMutableArray new];
+
+        [lock syncWriteAccessWithBlock:^{
+            [lock writeAccessWithBlock:^{
+                [order addObject:@2];
+                [lock writeAccessWithBlock:^{
+                    [order addObject:@3];
+                    [expectation fulfill];
+                }];
+            }];
+            [order addObject:@1];
+        }];
+
+        [self waitForExpectations:@[expectation] timeout:5.f];
+        __block NSArray<NSNumber *> *readOrder;
+        [lock readAccessWithBlock:^{ readOrder = [order copy]; }];
+
+        XCTAssertEqualObjects(readOrder, (@[@1, @2, @3]), @"Backend: %@", backend);
+    }
+}
+
+- (void)testItShouldCallAsynchronousReadBlock {
+    for (NSNumber *backend in @[@(PNLockGCDBackend), @(PNLockUnfairBackend), @(PNLockReadWriteBackend)]) {
+        XCTestExpectation *expectation = [self expectationWithDescription:backend.stringValue];
+        PNLock *lock = [self lockWithBackend:backend.unsignedIntegerValue];
+
+        [lock asyncReadAccessWithBlock:^{ [expectation fulfill]; }];
+
+        [self waitForExpectations:@[expectation] timeout:5.f];
+    }
+}
+
+
+#pragma mark - Tests :: Benchmarks
+
+- (void)testItShouldMeasureGCDBackendUncontendedAccess {
+    [self measureUncontendedAccessWithBackend:PNLockGCDBackend];
+}
+
+- (void)testItShouldMeasureUnfairBackendUncontendedAccess {
+    [self measureUncontendedAccessWithBackend:PNLockUnfairBackend];
+}
+
+- (void)testItShouldMeasureReadWriteBackendUncontendedAccess {
+    [self measureUncontendedAccessWithBackend:PNLockReadWriteBackend];
+}
+
+- (void)testItShouldMeasureGCDBackendContendedAccess {
+    [self measureContendedAccessWithBackend:PNLockGCDBackend];
+}
+
+- (void)testItShouldMeasureUnfairBackendContendedAccess {
+    [self measureContendedAccessWithBackend:PNLockUnfairBackend];
+}
+
+- (void)testItShouldMeasureReadWriteBackendContendedAccess {
+    [self measureContendedAccessWithBackend:PNLockReadWriteBackend];
+}
+
+
+#pragma mark - Helpers
+
+- (PNLock *)lockWithBackend:(PNLockBackend)backend {
+    return [PNLock lockWithIsolationQueueName:[NSUUID UUID].UUIDString
+                     subsystemQueueIdentifier:@"com.pubnub.tests.lock"
+                                      backend:backend];
+}
+
+- (void)measureUncontendedAccessWithBackend:(PNLockBackend)backend {
+    PNLock *lock = [self lockWithBackend:backend];
+    __block NSUInteger value = 0;
+
+    [self measureBlock:^{
+        __block NSUInteger readValue = 0;
+
+        for (NSUInteger idx = 0; idx < kPNTestLockAccessesCount; idx++) {
+            [lock syncWriteAccessWithBlock:^{ value++; }];
+            [lock syncReadAccessWithBlock:^{ readValue = value; }];
+        }
+
+        XCTAssertGreaterThan(readValue, 0);
+    }];
+}
+
+- (void)measureContendedAccessWithBackend:(PNLockBackend)backend {
+    NSUInteger accessesPerThread = kPNTestLockAccessesCount / kPNTestLockThreadsCount;
+    PNLock *lock = [self lockWithBackend:backend];
+    __block NSUInteger value = 0;
+
+    [self measureBlock:^{
+        dispatch_apply(kPNTestLockThreadsCount, DISPATCH_APPLY_AUTO, ^(size_t __unused thread) {
+            __block NSUInteger readValue = 0;
+
+            for (NSUInteger idx = 0; idx < accessesPerThread; idx++) {
+                if (idx % kPNTestLockReadsPerWrite == 0) [lock syncWriteAccessWithBlock:^{ value++; }];
+                else [lock syncReadAccessWithBlock:^{ readValue = value; }];
+            }
+        });
+    }];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,169 @@
+#import <PubNub/PNOperationDataParser.h>
+#import <PubNub/PNJSONSerialization.h>
+#import <PubNub/PNSignalStatus.h>
+#import <PubNub/PNJSONCoder.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Object which is decoded from test JSON data.
+@interface PNTestParsedObject : NSObject
+
+
+#pragma mark - Properties
+
+/// Object name.
+@property(strong, nullable, nonatomic) NSString *name;
+
+/// Object counter.
+@property(strong, nullable, nonatomic) NSNumber *count;
+
+#pragma mark -
+
+
+@end
+
+
+/// Transport response which is used to feed parser with test data.
+@interface PNTestTransportResponse : NSObject <PNTransportResponse>
+
+
+#pragma mark - Properties
+
+@property(strong, nullable, nonatomic) NSDictionary<NSString *, NSString *> *headers;
+@property(strong, nullable, nonatomic) NSInputStream *bodyStream;
+@property(strong, nullable, nonatomic) NSString *MIMEType;
+@property(assign, nonatomic) BOOL bodyStreamAvailable;
+@property(strong, nullable, nonatomic) NSData *body;
+@property(assign, nonatomic) NSUInteger statusCode;
+@property(strong, nonatomic) NSString *url;
+
+#pragma mark -
+
+
+@end
+
+
+/// Service response parser unit tests.
+@interface PNOperationDataParserTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Objects serializer which is used by parser.
+@property(strong, nonatomic) PNJSONCoder *coder;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNTestParsedObject
+@end
+
+
+@implementation PNTestTransportResponse
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNOperationDataParserTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.coder = [PNJSONCoder coderWithJSONSerializer:[PNJSONSerialization new]];
+}
+
+
+#pragma mark - Tests :: Shared JSON object
+
+- (void)testItShouldStoreParsedJSONObjectForNextDecodingAttempts {
+    NSData *data = [@"{\"name\":\"test\",\"count\":10}" dataUsingEncoding:NSUTF8StringEncoding];
+    id jsonObject = nil;
+    NSError *error;
+
+    PNTestParsedObject *object = [self.coder objectOfClass:[PNTestParsedObject class]
+                                                  fromData:data
+                                                jsonObject:&jsonObject
+                                            withAdditional:nil
+                                                     error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(object.name, @"test");
+    XCTAssertTrue([jsonObject isKindOfClass:[NSDictionary class]]);
+    XCTAssertEqualObjects(((NSDictionary *)jsonObject)[@"count"], @10);
+}
+
+- (void)testItShouldDecodeFromSharedJSONObjectWithoutDataParsing {
+    NSData *data = [@"{\"name\":\"test\",\"count\":10}" dataUsingEncoding:NSUTF8StringEncoding];
+    id jsonObject = nil;
+    NSError *error;
+
+    [self.coder objectOfClass:[PNTestParsedObject class]
+                     fromData:data
+                   jsonObject:&jsonObject
+               withAdditional:nil
+                        error:&error];
+    // Data which can't be parsed to ensure that decoder use shared JSON object.
+    PNTestParsedObject *object = [self.coder objectOfClass:[PNTestParsedObject class]
+                                                  fromData:[@"{" dataUsingEncoding:NSUTF8StringEncoding]
+                                                jsonObject:&jsonObject
+                                            withAdditional:nil
+                                                     error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(object.count, @10);
+}
+
+
+#pragma mark - Tests :: Metrics
+
+- (void)testItShouldCountFallbacksForMalformedResponse {
+    NSUInteger statusDataFallbacksCount = PNOperationDataParser.statusDataFallbacksCount;
+    NSUInteger errorDataFallbacksCount = PNOperationDataParser.errorDataFallbacksCount;
+    NSUInteger malformedResponsesCount = PNOperationDataParser.malformedResponsesCount;
+    PNOperationDataParser *parser = [PNOperationDataParser parserWithSerializer:self.coder
+                                                                         result:nil
+                                                                         status:[PNSignalStatus class]
+                                                             withAdditionalData:nil];
+    PNTestTransportResponse *response = [PNTestTransportResponse new];
+    response.headers = @{ @"content-type": @"application/json" };
+    response.statusCode = 200;
+
+    PNOperationDataParseResult *result = [parser parseOperation:PNSignalOperation
+                                                    withRequest:[PNTransportRequest new]
+                                                       response:response
+                                                           data:[@"{\"status\":" dataUsingEncoding:NSUTF8StringEncoding]
+                                                          error:nil];
+
+    XCTAssertTrue(((PNStatus *)result.status).isError);
+    XCTAssertEqual(PNOperationDataParser.statusDataFallbacksCount, statusDataFallbacksCount);
+    XCTAssertEqual(PNOperationDataParser.errorDataFallbacksCount, errorDataFallbacksCount + 1);
+    XCTAssertEqual(PNOperationDataParser.malformedResponsesCount, malformedResponsesCount + 1);
+}
+
+#pragma mark -
+
+
+@end
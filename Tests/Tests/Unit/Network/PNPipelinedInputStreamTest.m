@@ -0,0 +1,158 @@
+#import <PubNub/PNPipelinedInputStream.h>
+#import <PubNub/PNSequenceInputStream.h>
+#import <PubNub/PNCryptoModule.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Pipelined input stream unit tests.
+@interface PNPipelinedInputStreamTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create data filled with random bytes.
+///
+/// - Parameter length: Length of data which should be created.
+/// - Returns: Data with random bytes.
+- (NSData *)randomDataWithLength:(NSUInteger)length;
+
+/// Read whole stream content.
+///
+/// - Parameters:
+///   - stream: Stream from which data should be read.
+///   - chunkSize: Maximum number of bytes which should be requested with single `read` call.
+/// - Returns: Data which has been read from stream or `nil` in case of read error.
+- (nullable NSData *)readStream:(NSInputStream *)stream withChunkSize:(NSUInteger)chunkSize;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNPipelinedInputStreamTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Read
+
+- (void)testItShouldPassSourceStreamContent {
+    NSData *data = [self randomDataWithLength:1024 * 1024 + 17];
+
+    for (NSNumber *chunkSize in @[@1000, @(64 * 1024), @(2 * 1024 * 1024)]) {
+        NSInputStream *source = [NSInputStream inputStreamWithData:data];
+        PNPipelinedInputStream *stream = [PNPipelinedInputStream inputStreamWithInputStream:source
+                                                                                 bufferSize:32 * 1024
+                                                                               buffersCount:3];
+        [stream open];
+
+        XCTAssertEqualObjects([self readStream:stream withChunkSize:chunkSize.unsignedIntegerValue], data);
+        XCTAssertEqual(stream.bytesRead, data.length);
+        XCTAssertEqual(stream.streamStatus, NSStreamStatusClosed);
+        XCTAssertGreaterThanOrEqual(stream.duration, stream.readerStallTime);
+    }
+}
+
+- (void)testItShouldPassEmptySourceStream {
+    NSInputStream *source = [NSInputStream inputStreamWithData:[NSData new]];
+    PNPipelinedInputStream *stream = [PNPipelinedInputStream inputStreamWithInputStream:source
+                                                                             bufferSize:1024
+                                                                           buffersCount:2];
+    [stream open];
+
+    XCTAssertEqual([self readStream:stream withChunkSize:1024].length, 0);
+    XCTAssertEqual(stream.bytesRead, 0);
+}
+
+- (void)testItShouldPipelineEncryptedStreamInsideSequenceStream {
+    PNCryptoModule *cryptoModule = [PNCryptoModule AESCBCCryptoModuleWithCipherKey:@"enigma"
+                                                        randomInitializationVector:YES];
+    NSData *head = [@"--boundary\r\n" dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *tail = [@"\r\n--boundary--" dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *data = [self randomDataWithLength:512 * 1024 + 3];
+
+    NSInputStream *encrypted = [cryptoModule encryptStream:[NSInputStream inputStreamWithData:data]
+                                                dataLength:data.length].data;
+    NSInputStream *reference = [cryptoModule encryptStream:[NSInputStream inputStreamWithData:data]
+                                                dataLength:data.length].data;
+    NSData *encryptedData = [self readStream:reference withChunkSize:4096];
+    PNPipelinedInputStream *pipelined = [PNPipelinedInputStream inputStreamWithInputStream:encrypted
+                                                                                bufferSize:16 * 1024
+                                                                              buffersCount:4];
+    NSArray *lengths = @[@(head.length), @(encryptedData.length), @(tail.length)];
+    NSArray *streams = @[
+        [NSInputStream inputStreamWithData:head], pipelined, [NSInputStream inputStreamWithData:tail]
+    ];
+    PNSequenceInputStream *sequence = [PNSequenceInputStream inputStreamWithInputStreams:streams lengths:lengths];
+    [sequence open];
+
+    NSData *body = [self readStream:sequence withChunkSize:10000];
+
+    XCTAssertEqual(body.length, head.length + encryptedData.length + tail.length);
+    XCTAssertEqualObjects([body subdataWithRange:NSMakeRange(0, head.length)], head);
+    XCTAssertEqualObjects([body subdataWithRange:NSMakeRange(body.length - tail.length, tail.length)], tail);
+
+    NSData *encryptedBody = [body subdataWithRange:NSMakeRange(head.length, body.length - head.length - tail.length)];
+    PNResult<NSData *> *decryptResult = [cryptoModule decryptData:encryptedBody];
+    XCTAssertEqualObjects(decryptResult.data, data);
+    XCTAssertEqual(pipelined.bytesRead, encryptedBody.length);
+}
+
+- (void)testItShouldStopWorkerWhenClosedBeforeSourceEnd {
+    NSData *data = [self randomDataWithLength:1024 * 1024];
+    NSInputStream *source = [NSInputStream inputStreamWithData:data];
+    PNPipelinedInputStream *stream = [PNPipelinedInputStream inputStreamWithInputStream:source
+                                                                             bufferSize:1024
+                                                                           buffersCount:2];
+    uint8_t buffer[512];
+    [stream open];
+
+    XCTAssertEqual([stream read:buffer maxLength:sizeof(buffer)], sizeof(buffer));
+    [stream close];
+
+    XCTAssertEqual([stream read:buffer maxLength:sizeof(buffer)], 0);
+    XCTAssertEqual(stream.bytesRead, sizeof(buffer));
+}
+
+
+#pragma mark - Helpers
+
+- (NSData *)randomDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    arc4random_buf(data.mutableBytes, length);
+
+    return data;
+}
+
+- (NSData *)readStream:(NSInputStream *)stream withChunkSize:(NSUInteger)chunkSize {
+    NSMutableData *buffer = [NSMutableData dataWithLength:chunkSize];
+    NSMutableData *data = [NSMutableData new];
+    NSInteger bytesRead = 0;
+
+    if (stream.streamStatus == NSStreamStatusNotOpen) [stream open];
+    while ((bytesRead = [stream read:buffer.mutableBytes maxLength:chunkSize]) > 0) {
+        [data appendBytes:buffer.bytes length:(NSUInteger)bytesRead];
+    }
+
+    return bytesRead < 0 ? nil : data;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,212 @@
+#import <PubNub/PNPublishMessageEncoder.h>
+#import <PubNub/PNCryptoModule.h>
+#import <PubNub/PNString.h>
+#import <PubNub/PNResult.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Crypto provider which returns data without modifications.
+@interface PNTestIdentityCryptoProvider : NSObject <PNCryptoProvider>
+@end
+
+
+/// Publish message encoder unit tests.
+@interface PNPublishMessageEncoderTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Encode message with mobile push payloads.
+///
+/// - Parameters:
+///   - message: Message which should be encoded.
+///   - cryptoModule: Crypto module which should be used for message encryption.
+///   - payloads: Mobile push payloads which should be merged with message.
+/// - Returns: Parsed encoded message.
+- (nullable id)JSONObjectFromMessage:(nullable id)message
+                    withCryptoModule:(nullable id<PNCryptoProvider>)cryptoModule
+                            payloads:(nullable NSDictionary *)payloads;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNTestIdentityCryptoProvider
+
+- (PNResult<NSData *> *)encryptData:(NSData *)data {
+    return [PNResult resultWithData:[data copy] error:nil];
+}
+
+- (PNResult<NSData *> *)decryptData:(NSData *)data {
+    return [PNResult resultWithData:[data copy] error:nil];
+}
+
+- (PNResult<NSInputStream *> *)encryptStream:(NSInputStream *)stream dataLength:(NSUInteger)length {
+    return [PNResult resultWithData:stream error:nil];
+}
+
+- (PNResult<NSInputStream *> *)decryptStream:(NSInputStream *)stream dataLength:(NSUInteger)length {
+    return [PNResult resultWithData:stream error:nil];
+}
+
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNPublishMessageEncoderTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Serialization
+
+- (void)testItShouldSerializeDictionaryMessage {
+    id message = @{ @"text": @"Hello", @"values": @[@1, @2] };
+
+    XCTAssertEqualObjects([self JSONObjectFromMessage:message withCryptoModule:nil payloads:nil], message);
+}
+
+- (void)testItShouldWrapPlainStringMessageInQuotes {
+    PNPublishMessageEncoder *encoder = [PNPublishMessageEncoder encoderWithMessage:@"Hello 🌍"];
+    [encoder serializeWithError:nil];
+
+    NSString *encoded = [[NSString alloc] initWithData:encoder.data encoding:NSUTF8StringEncoding];
+
+    XCTAssertEqualObjects(encoded, @"\"Hello 🌍\"");
+}
+
+- (void)testItShouldNotWriteAnythingForMissingMessage {
+    PNPublishMessageEncoder *encoder = [PNPublishMessageEncoder encoderWithMessage:nil];
+
+    XCTAssertTrue([encoder serializeWithError:nil]);
+    XCTAssertEqual(encoder.data.length, 0);
+}
+
+
+#pragma mark - Tests :: Encryption
+
+- (void)testItShouldWriteBase64EncodedCiphertext {
+    id<PNCryptoProvider> cryptoModule = [PNCryptoModule legacyCryptoModuleWithCipherKey:@"enigma"
+                                                             randomInitializationVector:YES];
+    NSString *base64 = [self JSONObjectFromMessage:@{ @"text": @"Hello" } withCryptoModule:cryptoModule payloads:nil];
+    NSData *ciphertext = [[NSData alloc] initWithBase64EncodedString:base64 options:(NSDataBase64DecodingOptions)0];
+    PNResult<NSData *> *result = [cryptoModule decryptData:ciphertext];
+
+    XCTAssertFalse(result.isError);
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:result.data options:0 error:nil],
+                          @{ @"text": @"Hello" });
+}
+
+- (void)testItShouldEncodeCiphertextOfAnyLength {
+    for (NSUInteger length = 0; length < 8; length++) {
+        NSString *message = [@"abcdefg" substringToIndex:length];
+        PNPublishMessageEncoder *encoder = [PNPublishMessageEncoder encoderWithMessage:message];
+        // Identity provider returns serialized message as ciphertext.
+        NSData *ciphertext = [[NSString stringWithFormat:@"\"%@\"", message] dataUsingEncoding:NSUTF8StringEncoding];
+        NSString *expected = [NSString stringWithFormat:@"\"%@\"", [ciphertext base64EncodedStringWithOptions:0]];
+
+        [encoder serializeWithError:nil];
+        [encoder encryptWithCryptoModule:[PNTestIdentityCryptoProvider new] error:nil];
+
+        XCTAssertEqualObjects([[NSString alloc] initWithData:encoder.data encoding:NSUTF8StringEncoding], expected);
+    }
+}
+
+
+#pragma mark - Tests :: Mobile push payloads
+
+- (void)testItShouldAppendPayloadsToDictionaryMessage {
+    NSDictionary *payloads = @{ @"aps": @{ @"alert": @"Hi" }, @"fcm": @{ @"data": @{ @"a": @1 } } };
+    id object = [self JSONObjectFromMessage:@{ @"text": @"Hello" } withCryptoModule:nil payloads:payloads];
+
+    XCTAssertEqualObjects(object, (@{
+        @"text": @"Hello",
+        @"pn_apns": @{ @"aps": @{ @"alert": @"Hi" } },
+        @"pn_fcm": @{ @"data": @{ @"a": @1 } }
+    }));
+}
+
+- (void)testItShouldAppendPayloadsToEmptyDictionaryMessage {
+    id object = [self JSONObjectFromMessage:@{} withCryptoModule:nil payloads:@{ @"pn_gcm": @{ @"a": @1 } }];
+
+    XCTAssertEqualObjects(object, (@{ @"pn_gcm": @{ @"a": @1 } }));
+}
+
+- (void)testItShouldWrapNonDictionaryMessageWhenMergedWithPayloads {
+    NSDictionary *payloads = @{ @"gcm": @{ @"a": @1 } };
+
+    XCTAssertEqualObjects([self JSONObjectFromMessage:@[@"a"] withCryptoModule:nil payloads:payloads],
+                          (@{ @"pn_other": @[@"a"], @"pn_gcm": @{ @"a": @1 } }));
+    XCTAssertEqualObjects([self JSONObjectFromMessage:@"Hello \"world\"" withCryptoModule:nil payloads:payloads],
+                          (@{ @"pn_other": @"Hello \"world\"", @"pn_gcm": @{ @"a": @1 } }));
+    XCTAssertEqualObjects([self JSONObjectFromMessage:@YES withCryptoModule:nil payloads:payloads],
+                          (@{ @"pn_other": @YES, @"pn_gcm": @{ @"a": @1 } }));
+    XCTAssertEqualObjects([self JSONObjectFromMessage:nil withCryptoModule:nil payloads:payloads],
+                          (@{ @"pn_gcm": @{ @"a": @1 } }));
+}
+
+- (void)testItShouldOverrideMessageKeyWithPayload {
+    NSDictionary *message = @{ @"pn_gcm": @"original", @"text": @"Hello" };
+    id object = [self JSONObjectFromMessage:message withCryptoModule:nil payloads:@{ @"gcm": @{ @"a": @1 } }];
+
+    XCTAssertEqualObjects(object, (@{ @"pn_gcm": @{ @"a": @1 }, @"text": @"Hello" }));
+}
+
+- (void)testItShouldWrapEncryptedMessageWhenMergedWithPayloads {
+    NSData *data = [@"{\"text\":\"Hello\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSString *encrypted = [NSString stringWithFormat:@"\"%@\"", [data base64EncodedStringWithOptions:0]];
+    NSDictionary *object = [self JSONObjectFromMessage:@{ @"text": @"Hello" }
+                                      withCryptoModule:[PNTestIdentityCryptoProvider new]
+                                              payloads:@{ @"gcm": @{ @"a": @1 } }];
+
+    XCTAssertEqualObjects(object, (@{ @"pn_other": encrypted, @"pn_gcm": @{ @"a": @1 } }));
+}
+
+
+#pragma mark - Tests :: Path segment
+
+- (void)testItShouldPercentEscapeDataSameWayAsString {
+    NSString *message = @"{\"text\":\"Hello /world/?&=+ 🌍\nline\r\"}";
+    NSData *data = [message dataUsingEncoding:NSUTF8StringEncoding];
+
+    XCTAssertEqualObjects([PNString percentEscapedStringFromUTF8Data:data], [PNString percentEscapedString:message]);
+}
+
+
+#pragma mark - Helpers
+
+- (id)JSONObjectFromMessage:(id)message
+            withCryptoModule:(id<PNCryptoProvider>)cryptoModule
+                    payloads:(NSDictionary *)payloads {
+    PNPublishMessageEncoder *encoder = [PNPublishMessageEncoder encoderWithMessage:message];
+    NSError *error;
+
+    XCTAssertTrue([encoder serializeWithError:&error]);
+    if (cryptoModule) XCTAssertTrue([encoder encryptWithCryptoModule:cryptoModule error:&error]);
+    if (payloads) XCTAssertTrue([encoder mergeMobilePushPayloads:payloads error:&error]);
+    XCTAssertNil(error);
+
+    return [NSJSONSerialization JSONObjectWithData:encoder.data options:NSJSONReadingFragmentsAllowed error:nil];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,412 @@
+#import <PubNub/PNSubscribeMessageEventData+Private.h>
+#import <PubNub/PNSubscribeEventData+Private.h>
+#import <PubNub/PNFunctions.h>
+#import <PubNub/PNJSONSerialization.h>
+#import <PubNub/PNSubscribeData.h>
+#import <PubNub/PNJSONDecoder.h>
+#import <PubNub/PubNub.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+#import <stdatomic.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Custom JSON serializer which counts de-serialized JSON data.
+@interface PNSubscribeDataTestSerializer : NSObject <PNJSONSerializer>
+
+
+#pragma mark - Properties
+
+/// Number of JSON data objects which has been de-serialized by serializer.
+@property(assign, nonatomic) NSUInteger deserializationsCount;
+
+/// Serializer which does actual JSON processing.
+@property(strong, nonatomic) PNJSONSerialization *serializer;
+
+#pragma mark -
+
+
+@end
+
+
+/// Custom cryptor which tracks number of concurrent calls.
+@interface PNSubscribeDataTestCryptor : NSObject <PNCryptor> {
+    /// Number of currently active cryptor calls.
+    _Atomic(NSUInteger) _activeCallsCount;
+
+    /// Maximum number of cryptor calls which has been active at the same time.
+    _Atomic(NSUInteger) _maximumActiveCallsCount;
+}
+
+
+#pragma mark - Properties
+
+/// Maximum number of cryptor calls which has been active at the same time.
+@property(assign, nonatomic, readonly) NSUInteger maximumActiveCallsCount;
+
+/// Cryptor which does actual data processing.
+@property(strong, nonatomic) id<PNCryptor> cryptor;
+
+
+#pragma mark - Initialization and configuration
+
+/// Create cryptor which tracks calls to the wrapped cryptor.
+///
+/// - Parameter cryptor: Cryptor which does actual data processing.
+/// - Returns: Ready to use cryptor.
++ (instancetype)cryptorWithCryptor:(id<PNCryptor>)cryptor;
+
+#pragma mark -
+
+
+@end
+
+
+/// Subscribe response data unit tests.
+@interface PNSubscribeDataTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Crypto module which is used to encrypt and decrypt messages.
+@property(strong, nonatomic) id<PNCryptoProvider> cryptoModule;
+
+
+#pragma mark - Helpers
+
+/// Create raw subscribe response with single message.
+///
+/// - Parameter payload: JSON-encoded message payload which should be placed into response as is.
+/// - Returns: Subscribe response JSON data.
+- (NSData *)subscribeResponseDataWithPayload:(NSString *)payload;
+
+/// Create subscribe response with encrypted messages.
+///
+/// - Parameters:
+///   - count: Number of messages in response.
+///   - corruptedIdx: Index of message which should have payload which can't be decrypted.
+/// - Returns: Subscribe response dictionary.
+- (NSDictionary *)subscribeResponseWithMessagesCount:(NSUInteger)count corruptedMessageAtIndex:(NSUInteger)corruptedIdx;
+
+/// Verify that decoded updates has been decrypted and follow order from response.
+///
+/// - Parameters:
+///   - data: Decoded subscribe response data.
+///   - count: Expected number of messages in response.
+///   - corruptedIdx: Index of message which should have decryption error.
+- (void)assertDecryptedUpdatesInData:(nullable PNSubscribeData *)data
+                               count:(NSUInteger)count
+             corruptedMessageAtIndex:(NSUInteger)corruptedIdx;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNSubscribeDataTestSerializer
+
+- (instancetype)init {
+    if ((self = [super init])) _serializer = [PNJSONSerialization new];
+
+    return self;
+}
+
+- (NSData *)dataWithJSONObject:(id)object error:(PNError **)error {
+    return [self.serializer dataWithJSONObject:object error:error];
+}
+
+- (id)JSONObjectWithData:(NSData *)data error:(PNError **)error {
+    return [self JSONObjectWithData:data options:(PNJSONReadingOptions)0 error:error];
+}
+
+- (id)JSONObjectWithData:(NSData *)data options:(PNJSONReadingOptions)options error:(PNError **)error {
+    self.deserializationsCount++;
+
+    return [self.serializer JSONObjectWithData:data options:options error:error];
+}
+
+- (BOOL)isValidJSONObject:(id)object {
+    return [self.serializer isValidJSONObject:object];
+}
+
+@end
+
+
+@implementation PNSubscribeDataTestCryptor
+
+
+#pragma mark - Properties
+
+- (NSUInteger)maximumActiveCallsCount {
+    return atomic_load(&_maximumActiveCallsCount);
+}
+
+
+#pragma mark - Initialization and configuration
+
++ (instancetype)cryptorWithCryptor:(id<PNCryptor>)cryptor {
+    PNSubscribeDataTestCryptor *testCryptor = [self new];
+    testCryptor.cryptor = cryptor;
+
+    return testCryptor;
+}
+
+
+#pragma mark - Data processing
+
+- (NSData *)identifier {
+    return self.cryptor.identifier;
+}
+
+- (PNResult<PNEncryptedData *> *)encryptData:(NSData *)data {
+    return [self.cryptor encryptData:data];
+}
+
+- (PNResult<NSData *> *)decryptData:(PNEncryptedData *)data {
+    NSUInteger activeCallsCount = atomic_fetch_add(&_activeCallsCount, 1) + 1;
+    NSUInteger maximumCount = atomic_load(&_maximumActiveCallsCount);
+    while (activeCallsCount > maximumCount &&
+           !atomic_compare_exchange_weak(&_maximumActiveCallsCount, &maximumCount, activeCallsCount)) {}
+
+    // Give other workers time to enter cryptor if they are running.
+    usleep(100);
+    PNResult<NSData *> *result = [self.cryptor decryptData:data];
+    atomic_fetch_sub(&_activeCallsCount, 1);
+
+    return result;
+}
+
+- (PNResult<PNEncryptedStream *> *)encryptStream:(NSInputStream *)stream dataLength:(NSUInteger)length {
+    return [self.cryptor encryptStream:stream dataLength:length];
+}
+
+- (PNResult<NSInputStream *> *)decryptStream:(PNEncryptedStream *)stream dataLength:(NSUInteger)length {
+    return [self.cryptor decryptStream:stream dataLength:length];
+}
+
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNSubscribeDataTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    self.cryptoModule = [PNCryptoModule AESCBCCryptoModuleWithCipherKey:@"enigma" randomInitializationVector:YES];
+}
+
+
+#pragma mark - Tests :: Decryption
+
+- (void)testItShouldDecryptSmallBatchInOrder {
+    NSDictionary *response = [self subscribeResponseWithMessagesCount:5 corruptedMessageAtIndex:2];
+    NSData *data = [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions)0 error:nil];
+    NSError *error;
+
+    PNSubscribeData *subscribeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                                fromData:data
+                                                          withSerializer:nil
+                                                          additionalData:@{ @"cryptoModule": self.cryptoModule }
+                                                                   error:&error];
+
+    XCTAssertNil(error);
+    [self assertDecryptedUpdatesInData:subscribeData count:5 corruptedMessageAtIndex:2];
+}
+
+- (void)testItShouldDecryptLargeBatchConcurrentlyInOrder {
+    NSDictionary *response = [self subscribeResponseWithMessagesCount:300 corruptedMessageAtIndex:150];
+    NSData *data = [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions)0 error:nil];
+    NSError *error;
+
+    PNSubscribeData *subscribeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                                fromData:data
+                                                          withSerializer:nil
+                                                          additionalData:@{ @"cryptoModule": self.cryptoModule }
+                                                                   error:&error];
+
+    XCTAssertNil(error);
+    [self assertDecryptedUpdatesInData:subscribeData count:300 corruptedMessageAtIndex:150];
+}
+
+- (void)testItShouldDecryptLargeBatchFromDictionaryConcurrentlyInOrder {
+    NSDictionary *response = [self subscribeResponseWithMessagesCount:300 corruptedMessageAtIndex:7];
+    NSError *error;
+
+    PNSubscribeData *subscribeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                          fromDictionary:response
+                                                      withAdditionalData:@{ @"cryptoModule": self.cryptoModule }
+                                                                   error:&error];
+
+    XCTAssertNil(error);
+    [self assertDecryptedUpdatesInData:subscribeData count:300 corruptedMessageAtIndex:7];
+}
+
+- (void)testItShouldDecryptLargeBatchSeriallyWithCustomCryptor {
+    NSDictionary *response = [self subscribeResponseWithMessagesCount:300 corruptedMessageAtIndex:NSNotFound];
+    PNAESCBCCryptor *aesCryptor = [PNAESCBCCryptor cryptorWithCipherKey:@"enigma"];
+    PNSubscribeDataTestCryptor *cryptor = [PNSubscribeDataTestCryptor cryptorWithCryptor:aesCryptor];
+    self.cryptoModule = [PNCryptoModule moduleWithDefaultCryptor:cryptor cryptors:nil];
+    NSError *error;
+
+    PNSubscribeData *subscribeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                          fromDictionary:response
+                                                      withAdditionalData:@{ @"cryptoModule": self.cryptoModule }
+                                                                   error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertEqual(cryptor.maximumActiveCallsCount, 1);
+    [self assertDecryptedUpdatesInData:subscribeData count:300 corruptedMessageAtIndex:NSNotFound];
+}
+
+
+#pragma mark - Tests :: Serializer
+
+- (void)testItShouldDecodeWithCustomSerializerWhenConfigured {
+    NSDictionary *response = [self subscribeResponseWithMessagesCount:5 corruptedMessageAtIndex:NSNotFound];
+    NSData *data = [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions)0 error:nil];
+    PNSubscribeDataTestSerializer *serializer = [PNSubscribeDataTestSerializer new];
+    NSError *error;
+
+    PNSubscribeData *subscribeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                                fromData:data
+                                                          withSerializer:serializer
+                                                          additionalData:@{ @"cryptoModule": self.cryptoModule }
+                                                                   error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertGreaterThan(serializer.deserializationsCount, 0);
+    [self assertDecryptedUpdatesInData:subscribeData count:5 corruptedMessageAtIndex:NSNotFound];
+}
+
+
+#pragma mark - Tests :: Fingerprint
+
+- (void)testItShouldComputeFingerprintFromRawPayloadBytes {
+    NSArray<NSString *> *payloads = @[
+        @"\"Hello \\\"real-time\\\" world\"", @"\"caf\\u00e9 \\/ bar\"", @"1.0", @"1e3", @"42.50", @"true",
+        @"{\"such\":[\"object\",1],\"a\":{\"z\":1.0,\"y\":\"\\/\"}}"
+    ];
+
+    for (NSString *payload in payloads) {
+        NSData *payloadData = [payload dataUsingEncoding:NSUTF8StringEncoding];
+        uint32_t expected = PNMessageFingerprintFromBytes(payloadData.bytes, payloadData.length);
+        NSData *data = [self subscribeResponseDataWithPayload:payload];
+        NSError *error;
+
+        PNSubscribeData *envelopeData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                                   fromData:data
+                                                             withSerializer:nil
+                                                             additionalData:nil
+                                                                      error:&error];
+        PNSubscribeData *decodedData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                                  fromData:data
+                                                            withSerializer:[PNSubscribeDataTestSerializer new]
+                                                            additionalData:nil
+                                                                     error:&error];
+
+        XCTAssertNil(error, @"Payload: %@", payload);
+        XCTAssertEqual(envelopeData.updates.firstObject.pnFingerprintValue, expected, @"Payload: %@", payload);
+        XCTAssertEqual(decodedData.updates.firstObject.pnFingerprintValue, expected, @"Payload: %@", payload);
+    }
+}
+
+- (void)testItShouldComputeSameFingerprintForParsedPayloadWithDifferentKeysOrder {
+    NSArray<NSString *> *payloads = @[
+        @"{\"b\":1.5,\"a\":{\"d\":\"caf\\u00e9\",\"c\":[1,2]}}", @"{\"a\":{\"c\":[1,2],\"d\":\"café\"},\"b\":1.5}"
+    ];
+    NSMutableSet<NSNumber *> *fingerprints = [NSMutableSet new];
+
+    for (NSString *payload in payloads) {
+        NSData *data = [self subscribeResponseDataWithPayload:payload];
+        NSDictionary *dictionary = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:nil];
+        NSError *error;
+
+        PNSubscribeData *parsedData = [PNJSONDecoder decodedObjectOfClass:[PNSubscribeData class]
+                                                           fromDictionary:dictionary
+                                                       withAdditionalData:nil
+                                                                    error:&error];
+
+        XCTAssertNil(error, @"Payload: %@", payload);
+        XCTAssertEqual(parsedData.updates.firstObject.pnFingerprintValue,
+                       PNMessageFingerprintValue(dictionary[@"m"][0][@"d"]), @"Payload: %@", payload);
+        [fingerprints addObject:@(parsedData.updates.firstObject.pnFingerprintValue)];
+    }
+
+    XCTAssertEqual(fingerprints.count, 1);
+}
+
+
+#pragma mark - Helpers
+
+- (NSData *)subscribeResponseDataWithPayload:(NSString *)payload {
+    NSString *message = [NSString stringWithFormat:@"{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"17000000000000000\","
+                         "\"r\":1},\"c\":\"channel\",\"d\":%@}", payload];
+    NSString *response = [NSString stringWithFormat:@"{\"t\":{\"t\":\"17000000000000001\",\"r\":1},"
+                          "\"m\":[%@]}", message];
+
+    return [response dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSDictionary *)subscribeResponseWithMessagesCount:(NSUInteger)count corruptedMessageAtIndex:(NSUInteger)corruptedIdx {
+    NSMutableArray *messages = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger idx = 0; idx < count; idx++) {
+        NSData *payload = [[NSString stringWithFormat:@"{\"idx\":%@}", @(idx)] dataUsingEncoding:NSUTF8StringEncoding];
+        NSString *encrypted = [[self.cryptoModule encryptData:payload].data base64EncodedStringWithOptions:0];
+        if (idx == corruptedIdx) encrypted = @"bm90LWVuY3J5cHRlZA==";
+
+        [messages addObject:@{
+            @"a": @"3",
+            @"f": @0,
+            @"p": @{ @"t": [NSString stringWithFormat:@"%@", @(17000000000000000ULL + idx)], @"r": @1 },
+            @"c": @"channel",
+            @"d": encrypted
+        }];
+    }
+
+    return @{ @"t": @{ @"t": @"17000000000000001", @"r": @1 }, @"m": messages };
+}
+
+- (void)assertDecryptedUpdatesInData:(PNSubscribeData *)data
+                               count:(NSUInteger)count
+             corruptedMessageAtIndex:(NSUInteger)corruptedIdx {
+    XCTAssertEqual(data.updates.count, count);
+
+    [data.updates enumerateObjectsUsingBlock:^(PNSubscribeEventData *update, NSUInteger idx, BOOL *stop) {
+        PNSubscribeMessageEventData *message = (PNSubscribeMessageEventData *)update;
+        XCTAssertEqualObjects(message.timetoken, @(17000000000000000ULL + idx));
+
+        if (idx == corruptedIdx) {
+            XCTAssertNotNil(message.decryptionError);
+            XCTAssertEqualObjects(message.message, @"bm90LWVuY3J5cHRlZA==");
+        } else {
+            XCTAssertNil(message.decryptionError);
+            XCTAssertEqualObjects(message.message, @{ @"idx": @(idx) });
+        }
+    }];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,161 @@
+#import <PubNub/PNSubscribeMessageEventData+Private.h>
+#import <PubNub/PNSubscribeEventData+Private.h>
+#import <PubNub/PNSubscribeEnvelopeParser.h>
+#import <PubNub/PNSubscribeSignalEventData.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// Subscribe response envelope parser unit tests.
+@interface PNSubscribeEnvelopeParserTest : PNRecordableTestCase
+
+
+#pragma mark - Helpers
+
+/// Create parser for JSON string.
+///
+/// - Parameter json: Subscribe response JSON string.
+/// - Returns: Configured subscribe response envelope parser.
+- (PNSubscribeEnvelopeParser *)parserWithJSON:(NSString *)json;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Tests
+
+@implementation PNSubscribeEnvelopeParserTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Tests :: Cursor
+
+- (void)testItShouldParseCursor {
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:@"{\"t\":{\"t\":\"17000000000000001\",\"r\":12},\"m\":[]}"];
+
+    XCTAssertTrue([parser parse]);
+    XCTAssertEqualObjects(parser.cursor.timetoken, @(17000000000000001ULL));
+    XCTAssertEqualObjects(parser.cursor.region, @12);
+    XCTAssertEqual(parser.updates.count, 0);
+}
+
+
+#pragma mark - Tests :: Updates
+
+- (void)testItShouldCreateMessageEventFromScannedFields {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"i\":\"user\",\"s\":5,\"p\":{\"t\":\"1\","
+                      "\"r\":1},\"c\":\"ch\\\"1\",\"d\":{\"text\":\"hello\"},\"b\":\"ch.*\",\"u\":{\"k\":1},\"cmt\":\"t\"}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+    XCTAssertEqual(parser.updates.count, 1);
+    XCTAssertEqual(parser.fingerprints.length, sizeof(uint32_t));
+
+    PNSubscribeMessageEventData *event = parser.updates.firstObject;
+    XCTAssertTrue([event isMemberOfClass:[PNSubscribeMessageEventData class]]);
+    XCTAssertEqualObjects(event.message, @{ @"text": @"hello" });
+    XCTAssertEqualObjects(event.channel, @"ch\"1");
+    XCTAssertEqualObjects(event.subscription, @"ch.*");
+    XCTAssertEqualObjects(event.senderIdentifier, @"user");
+    XCTAssertEqualObjects(event.sequenceNumber, @5);
+    XCTAssertEqualObjects(event.userMetadata, @{ @"k": @1 });
+    XCTAssertEqualObjects(event.customMessageType, @"t");
+    XCTAssertEqualObjects(event.timetoken, @1);
+}
+
+- (void)testItShouldCreateSignalEventFromScannedFields {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"e\":1,\"p\":{\"t\":\"1\",\"r\":1},"
+                      "\"c\":\"ch\",\"d\":\"signal\"}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+    XCTAssertTrue([parser.updates.firstObject isKindOfClass:[PNSubscribeSignalEventData class]]);
+    XCTAssertEqualObjects(((PNSubscribeSignalEventData *)parser.updates.firstObject).message, @"signal");
+}
+
+- (void)testItShouldMaterializeOtherEventsAsDictionary {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"1\",\"r\":1},"
+                      "\"c\":\"ch-pnpres\",\"d\":{\"action\":\"join\"}}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+    XCTAssertTrue([parser.updates.firstObject isKindOfClass:[NSDictionary class]]);
+    XCTAssertEqualObjects(parser.updates.firstObject[@"c"], @"ch-pnpres");
+}
+
+- (void)testItShouldComputeSameFingerprintForSamePayload {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"1\",\"r\":1},"
+                      "\"c\":\"ch\",\"d\":[1,2]},{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"1\",\"r\":1},\"c\":\"ch-2\","
+                      "\"d\":[1,2]}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+
+    const uint32_t *fingerprints = parser.fingerprints.bytes;
+    XCTAssertEqual(fingerprints[0], fingerprints[1]);
+}
+
+- (void)testItShouldDeserializePayloadOnFirstAccess {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"1\",\"r\":1},"
+                      "\"c\":\"ch\",\"d\":{\"text\":[\"caf\\u00e9\",1.5]}}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+
+    PNSubscribeMessageEventData *event = parser.updates.firstObject;
+    XCTAssertNotNil([event valueForKey:@"messageData"]);
+    XCTAssertEqualObjects(event.message, (@{ @"text": @[@"café", @1.5] }));
+    XCTAssertNil([event valueForKey:@"messageData"]);
+    XCTAssertEqual(event.message, event.message);
+}
+
+- (void)testItShouldReplaceLazyPayloadWhenMessageSet {
+    NSString *json = @"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\",\"f\":0,\"p\":{\"t\":\"1\",\"r\":1},"
+                      "\"c\":\"ch\",\"d\":\"encrypted\"}]}";
+    PNSubscribeEnvelopeParser *parser = [self parserWithJSON:json];
+
+    XCTAssertTrue([parser parse]);
+
+    PNSubscribeMessageEventData *event = parser.updates.firstObject;
+    event.message = @{ @"decrypted": @YES };
+
+    XCTAssertNil([event valueForKey:@"messageData"]);
+    XCTAssertEqualObjects(event.message, @{ @"decrypted": @YES });
+}
+
+
+#pragma mark - Tests :: Malformed
+
+- (void)testItShouldFailWhenEnvelopeIsTruncated {
+    XCTAssertFalse([[self parserWithJSON:@"{\"t\":{\"t\":\"2\",\"r\":1},\"m\":[{\"a\":\"3\""] parse]);
+}
+
+- (void)testItShouldFailWhenCursorIsMissing {
+    XCTAssertFalse([[self parserWithJSON:@"{\"m\":[]}"] parse]);
+}
+
+
+#pragma mark - Helpers
+
+- (PNSubscribeEnvelopeParser *)parserWithJSON:(NSString *)json {
+    return [PNSubscribeEnvelopeParser parserWithData:[json dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,279 @@
+#import "PNTransportConfiguration+Private.h"
+#import "PNTransportRequest+Private.h"
+#import <PubNub/PNURLSessionTransport.h>
+#import <PubNub/PNLock.h>
+#import "PNRecordableTestCase.h"
+#import <XCTest/XCTest.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Interface declaration
+
+/// URL protocol which completes requests to the `/complete` path immediately and never completes loading for others,
+/// so their session tasks stay in flight until cancelled.
+@interface PNURLSessionTransportTestProtocol : NSURLProtocol
+@end
+
+
+#pragma mark - Private transport methods exposure
+
+@interface PNURLSessionTransport (TestAccess)
+
+
+#pragma mark - Properties
+
+/// Map of the currently active tagged requests to their tags.
+@property(strong, nonatomic)
+    NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, PNTransportRequest *> *> *taggedRequests;
+
+/// Session tasks which wait for a free slot in the connections budget.
+@property(strong, nonatomic) NSMutableArray<NSURLSessionTask *> *pendingTasks;
+
+/// Resources access lock.
+@property(strong, nonatomic) PNLock *lock;
+
+
+#pragma mark - State
+
+/// Resume session task if there is a free slot in the connections budget.
+- (void)resumeTask:(NSURLSessionTask *)task;
+
+/// Release connections budget slot occupied by completed session task.
+- (void)releaseTask:(NSURLSessionTask *)task;
+
+@end
+
+
+/// URL session transport unit tests.
+@interface PNURLSessionTransportTest : PNRecordableTestCase
+
+
+#pragma mark - Properties
+
+/// Session which is used to create tasks with ``PNURLSessionTransportTestProtocol`` protocol.
+@property(strong, nonatomic) NSURLSession *session;
+
+
+#pragma mark - Helpers
+
+/// Create and configure transport.
+///
+/// - Parameter maximumConnections: Maximum number of concurrent connections (requests).
+/// - Returns: Configured and ready to use transport.
+- (PNURLSessionTransport *)transportWithMaximumConnections:(NSUInteger)maximumConnections;
+
+/// Create session task which won't complete until cancelled.
+///
+/// - Returns: Suspended session task.
+- (NSURLSessionTask *)task;
+
+/// Create cancellable transport request.
+///
+/// - Parameters:
+///   - path: Request path (requests to `/complete` complete immediately).
+///   - tag: Tag of the group of requests to which request belongs.
+/// - Returns: Transport request for tests.
+- (PNTransportRequest *)requestWithPath:(NSString *)path tag:(nullable NSString *)tag;
+
+/// Wait until transport completes all scheduled state changes.
+///
+/// - Parameter transport: Transport for which state changes should be awaited.
+- (void)waitForTransport:(PNURLSessionTransport *)transport;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interfaces implementation
+
+@implementation PNURLSessionTransportTestProtocol
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return YES;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    if (![self.request.URL.path hasPrefix:@"/complete"]) return;
+
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"Content-Type": @"application/json"}];
+    [self.client URLProtocol:self didReceiveResponse:response cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    [self.client URLProtocol:self didLoadData:[@"{}" dataUsingEncoding:NSUTF8StringEncoding]];
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {}
+
+@end
+
+
+#pragma mark - Tests
+
+@implementation PNURLSessionTransportTest
+
+
+#pragma mark - VCR configuration
+
+- (BOOL)shouldSetupVCR {
+    return NO;
+}
+
+
+#pragma mark - Setup / Tear down
+
+- (void)setUp {
+    [super setUp];
+
+    NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    configuration.protocolClasses = @[[PNURLSessionTransportTestProtocol class]];
+    self.session = [NSURLSession sessionWithConfiguration:configuration];
+}
+
+- (void)tearDown {
+    [self.session invalidateAndCancel];
+
+    [super tearDown];
+}
+
+
+#pragma mark - Tests :: Connections budget
+
+- (void)testItShouldKeepTasksAboveBudgetSuspendedUntilSlotReleased {
+    PNURLSessionTransport *transport = [self transportWithMaximumConnections:2];
+    NSArray<NSURLSessionTask *> *tasks = @[[self task], [self task], [self task]];
+
+    for (NSURLSessionTask *task in tasks) [transport resumeTask:task];
+    [self waitForTransport:transport];
+
+    XCTAssertNotEqual(tasks[0].state, NSURLSessionTaskStateSuspended);
+    XCTAssertNotEqual(tasks[1].state, NSURLSessionTaskStateSuspended);
+    XCTAssertEqual(tasks[2].state, NSURLSessionTaskStateSuspended);
+    XCTAssertEqualObjects(transport.pendingTasks, @[tasks[2]]);
+
+    [tasks[0] cancel];
+    [transport releaseTask:tasks[0]];
+    [self waitForTransport:transport];
+
+    XCTAssertNotEqual(tasks[2].state, NSURLSessionTaskStateSuspended);
+    XCTAssertEqual(transport.pendingTasks.count, 0);
+}
+
+- (void)testItShouldSkipCancelledPendingTaskWhenSlotReleased {
+    PNURLSessionTransport *transport = [self transportWithMaximumConnections:1];
+    NSArray<NSURLSessionTask *> *tasks = @[[self task], [self task], [self task]];
+
+    for (NSURLSessionTask *task in tasks) [transport resumeTask:task];
+    [tasks[1] cancel];
+    [tasks[0] cancel];
+    [transport releaseTask:tasks[0]];
+    [self waitForTransport:transport];
+
+    XCTAssertNotEqual(tasks[2].state, NSURLSessionTaskStateSuspended);
+    XCTAssertEqual(transport.pendingTasks.count, 0);
+}
+
+
+#pragma mark - Tests :: Tagged requests
+
+- (void)testItShouldRegisterTaggedRequest {
+    PNURLSessionTransport *transport = [self transportWithMaximumConnections:2];
+    PNTransportRequest *request = [self requestWithPath:@"/hang" tag:@"subscribe"];
+
+    [transport sendRequest:request withCompletionBlock:^(PNTransportRequest *req, id response, PNError *error) {}];
+    [self waitForTransport:transport];
+
+    XCTAssertEqualObjects(transport.taggedRequests[@"subscribe"].allValues, @[request]);
+
+    request.cancel();
+}
+
+- (void)testItShouldCancelOnlyRequestsWithTag {
+    PNURLSessionTransport *transport = [self transportWithMaximumConnections:3];
+    PNTransportRequest *untaggedRequest = [self requestWithPath:@"/hang" tag:nil];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Tagged requests cancelled"];
+    expectation.expectedFulfillmentCount = 2;
+
+    for (NSUInteger idx = 0; idx < 2; idx++) {
+        PNTransportRequest *request = [self requestWithPath:@"/hang" tag:@"subscribe"];
+        [transport sendRequest:request withCompletionBlock:^(PNTransportRequest *req, id response, PNError *error) {
+            XCTAssertTrue(req.cancelled);
+            [expectation fulfill];
+        }];
+    }
+    [transport sendRequest:untaggedRequest withCompletionBlock:^(PNTransportRequest *req, id res, PNError *error) {}];
+    [self waitForTransport:transport];
+
+    [transport cancelRequestsWithTag:@"subscribe"];
+    [self waitForExpectations:@[expectation] timeout:5.f];
+    [self waitForTransport:transport];
+
+    XCTAssertNil(transport.taggedRequests[@"subscribe"]);
+    XCTAssertFalse(untaggedRequest.cancelled);
+
+    untaggedRequest.cancel();
+}
+
+- (void)testItShouldRemoveTaggedRequestWhenCompleted {
+    PNURLSessionTransport *transport = [self transportWithMaximumConnections:2];
+    PNTransportRequest *request = [self requestWithPath:@"/complete" tag:@"subscribe"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Request completed"];
+
+    [transport sendRequest:request withCompletionBlock:^(PNTransportRequest *req, id response, PNError *error) {
+        XCTAssertNil(error);
+        [expectation fulfill];
+    }];
+    [self waitForExpectations:@[expectation] timeout:5.f];
+    [self waitForTransport:transport];
+
+    XCTAssertNil(transport.taggedRequests[@"subscribe"]);
+}
+
+
+#pragma mark - Helpers
+
+- (PNURLSessionTransport *)transportWithMaximumConnections:(NSUInteger)maximumConnections {
+    PNTransportConfiguration *configuration = [PNTransportConfiguration new];
+    PNURLSessionTransport *transport = [PNURLSessionTransport new];
+    configuration.maximumConnections = maximumConnections;
+    [transport setupWithConfiguration:configuration];
+    [transport setValue:self.session forKey:@"session"];
+
+    return transport;
+}
+
+- (NSURLSessionTask *)task {
+    return [self.session dataTaskWithURL:[NSURL URLWithString:@"https://ps.pndsn.com/time/0"]];
+}
+
+- (PNTransportRequest *)requestWithPath:(NSString *)path tag:(NSString *)tag {
+    PNTransportRequest *request = [PNTransportRequest new];
+    request.origin = @"https://ps.pndsn.com";
+    request.cancellable = YES;
+    request.retriable = NO;
+    request.timeout = 10;
+    request.path = path;
+    request.tag = tag;
+
+    return request;
+}
+
+- (void)waitForTransport:(PNURLSessionTransport *)transport {
+    // Read access is queued after all previously scheduled write access blocks.
+    [transport.lock syncReadAccessWithBlock:^{}];
+}
+
+#pragma mark -
+
+
+@end